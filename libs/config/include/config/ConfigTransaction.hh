@@ -0,0 +1,100 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef WORKRAVE_CONFIG_CONFIGTRANSACTION_HH
+#define WORKRAVE_CONFIG_CONFIGTRANSACTION_HH
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+#include "config/IConfigurator.hh"
+
+namespace workrave::config
+{
+  //! Stages configuration changes and applies them together.
+  /*!
+   *  Staged values are not visible through the configurator until
+   *  commit(), which sets them all without delays, stores them in the
+   *  backend in one go (a single save of a configuration file, or one
+   *  GSettings apply per schema) and only then notifies listeners: once per
+   *  listener and prefix it registered, through config_changes_notify(),
+   *  with all of the changed keys under that prefix. A transaction that is
+   *  not committed changes nothing.
+   */
+  class ConfigTransaction : public boost::noncopyable
+  {
+  public:
+    explicit ConfigTransaction(IConfigurator::Ptr config)
+      : config(std::move(config))
+    {
+    }
+
+    void set_value(const std::string &key, const std::string &v)
+    {
+      values.emplace_back(key, v);
+    }
+
+    void set_value(const std::string &key, const char *v)
+    {
+      values.emplace_back(key, std::string(v));
+    }
+
+    void set_value(const std::string &key, int32_t v)
+    {
+      values.emplace_back(key, v);
+    }
+
+    void set_value(const std::string &key, int64_t v)
+    {
+      values.emplace_back(key, v);
+    }
+
+    void set_value(const std::string &key, bool v)
+    {
+      values.emplace_back(key, v);
+    }
+
+    void set_value(const std::string &key, double v)
+    {
+      values.emplace_back(key, v);
+    }
+
+    bool empty() const
+    {
+      return values.empty();
+    }
+
+    //! Applies the staged values. The transaction is empty afterwards, also if this throws.
+    void commit()
+    {
+      auto staged = std::move(values);
+      values.clear();
+      if (!staged.empty())
+        {
+          config->set_values(staged);
+        }
+    }
+
+  private:
+    IConfigurator::Ptr config;
+    std::vector<std::pair<std::string, ConfigValue>> values;
+  };
+} // namespace workrave::config
+
+#endif // WORKRAVE_CONFIG_CONFIGTRANSACTION_HH
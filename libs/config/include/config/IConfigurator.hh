@@ -21,7 +21,9 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <variant>
+#include <vector>
 #include <optional>
 
 namespace workrave::config
@@ -70,6 +72,13 @@ namespace workrave::config
     virtual void set_delay(const std::string &key, int delay) = 0;
 
     virtual void heartbeat() = 0;
+
+    //! Monotonic time, in seconds, at which heartbeat() next has a delayed change or save to do, or 0 if none is pending.
+    [[nodiscard]] virtual int64_t get_next_heartbeat_time() const = 0;
+
+    //! Changes whenever a value may have changed, through this configurator or in the backend.
+    [[nodiscard]] virtual uint64_t get_generation() const = 0;
+
     virtual bool load(std::string filename) = 0;
     virtual void save() = 0;
 
@@ -141,6 +150,9 @@ namespace workrave::config
                            double v,
                            workrave::config::ConfigFlags flags = workrave::config::CONFIG_FLAG_NONE) = 0;
 
+    //! Sets all values at once, ignoring delays; see ConfigTransaction.
+    virtual void set_values(const std::vector<std::pair<std::string, ConfigValue>> &values) = 0;
+
     virtual bool add_listener(const std::string &key_prefix, workrave::config::IConfiguratorListener *listener) = 0;
     virtual bool remove_listener(workrave::config::IConfiguratorListener *listener) = 0;
     virtual bool remove_listener(const std::string &key_prefix, workrave::config::IConfiguratorListener *listener) = 0;
@@ -19,6 +19,7 @@
 #define WORKRAVE_CONFIG_ICONFIGURATORLISTENER_HH
 
 #include <string>
+#include <vector>
 
 namespace workrave::config
 {
@@ -30,6 +31,19 @@ namespace workrave::config
 
     //! The configuration item with specified key has changed.
     virtual void config_changed_notify(const std::string &key) = 0;
+
+    //! Several configuration items have changed together, e.g. by a ConfigTransaction.
+    /*!
+     *  keys holds every changed key under the prefix the listener registered.
+     *  By default, each one is passed on to config_changed_notify().
+     */
+    virtual void config_changes_notify(const std::vector<std::string> &keys)
+    {
+      for (const std::string &key: keys)
+        {
+          config_changed_notify(key);
+        }
+    }
   };
 } // namespace workrave::config
 
@@ -28,9 +28,12 @@
 
 #include <utility>
 #include <chrono>
+#include <cstdint>
+#include <optional>
 
 #include "utils/Enum.hh"
 #include "utils/Signals.hh"
+#include "config/ConfigTransaction.hh"
 #include "config/IConfigurator.hh"
 #include "config/IConfiguratorListener.hh"
 
@@ -267,16 +270,18 @@ namespace workrave
 
       R get() const
       {
-        T ret = T();
-        if (has_default_value)
+        if (!cached)
           {
-            config->get_value_with_default(setting, ret, setting_cast<T>(default_value));
+            return read();
           }
-        else
+
+        const uint64_t generation = config->get_generation();
+        if (!cached_value.has_value() || generation != cached_generation)
           {
-            config->get_value(setting, ret);
+            cached_value.emplace(read());
+            cached_generation = generation;
           }
-        return setting_cast<R>(ret);
+        return *cached_value;
       }
 
       R get(const R def) const
@@ -286,11 +291,27 @@ namespace workrave
         return setting_cast<R>(ret);
       }
 
+      // Keeps the decoded value until the configurator reports a change (see
+      // IConfigurator::get_generation()), so that get() no longer goes
+      // through the backend and lexical_cast. For settings read on every
+      // tick. Not thread-safe, like the configurator itself.
+      void set_cached(bool enabled)
+      {
+        cached = enabled;
+        cached_value.reset();
+      }
+
       void set(const R &val)
       {
         config->set_value(setting, setting_cast<T>(val));
       }
 
+      //! Stages the value in transaction, to be set when it commits.
+      void set(ConfigTransaction &transaction, const R &val)
+      {
+        transaction.set_value(setting, setting_cast<T>(val));
+      }
+
       template<typename F>
       auto connect(workrave::utils::Trackable *track_target, F func)
       {
@@ -334,6 +355,20 @@ namespace workrave
       }
 
     private:
+      R read() const
+      {
+        T ret = T();
+        if (has_default_value)
+          {
+            config->get_value_with_default(setting, ret, setting_cast<T>(default_value));
+          }
+        else
+          {
+            config->get_value(setting, ret);
+          }
+        return setting_cast<R>(ret);
+      }
+
       void config_changed_notify(const std::string &key) override
       {
         (void)key;
@@ -354,6 +389,9 @@ namespace workrave
       bool has_default_value;
       R default_value;
       NotifyType signal;
+      bool cached{false};
+      mutable std::optional<R> cached_value;
+      mutable uint64_t cached_generation{0};
     };
 
     template<class T, class R>
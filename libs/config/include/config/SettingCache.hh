@@ -18,8 +18,13 @@
 #ifndef WORKRAVE_CONFIG_SETTINGCACHE_HH
 #define WORKRAVE_CONFIG_SETTINGCACHE_HH
 
-#include <map>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <boost/noncopyable.hpp>
 
 #include "config/IConfigurator.hh"
@@ -27,59 +32,141 @@
 
 namespace workrave::config
 {
-  class SettingCache : public boost::noncopyable
+  //! Name of a setting that remembers its slot in the SettingCache.
+  /*!
+   *  The first lookup interns the name and stores the index of its slot in
+   *  the key, so later lookups need neither the name nor a map. Keys with
+   *  the same name share a slot. Declare keys once, e.g. as function-local
+   *  statics: from a literal they are constant-initialized and interned on
+   *  first use; a key built at run time (e.g. for one break) is interned
+   *  when constructed.
+   */
+  class SettingKey : public boost::noncopyable
   {
-  private:
-    static auto &get_cache()
+  public:
+    consteval SettingKey(const char *name)
+      : name(name)
+    {
+    }
+
+    consteval SettingKey(std::string_view name)
+      : name(name)
     {
-      static std::map<std::string, std::shared_ptr<SettingBase>> cache;
-      return cache;
     }
 
+    explicit SettingKey(const std::string &name);
+
+    //! Index of the slot, interning the name on first use. Thread-safe.
+    std::size_t slot() const
+    {
+      const std::size_t index = slot_index.load(std::memory_order_acquire);
+      return index != unassigned ? index : intern();
+    }
+
+  private:
+    std::size_t intern() const;
+
+    static constexpr std::size_t unassigned = SIZE_MAX;
+
+    std::string_view name;
+    mutable std::atomic<std::size_t> slot_index{unassigned};
+  };
+
+  //! Process-wide settings, one per key.
+  /*!
+   *  Looking up a setting by SettingKey is lock-free once the setting
+   *  exists; creating it, and looking up by string, takes a lock. Settings
+   *  live until reset(), which must not run concurrently with lookups.
+   */
+  class SettingCache : public boost::noncopyable
+  {
   public:
+    template<typename T, typename S = T>
+    static workrave::config::Setting<T, S> &get(IConfigurator::Ptr config, const SettingKey &key, const S &def = S())
+    {
+      return get_slot<T, S>(config, key.slot(), def);
+    }
+
     template<typename T, typename S = T>
     static workrave::config::Setting<T, S> &get(IConfigurator::Ptr config, const char *key, const S &def = S())
     {
-      return workrave::config::SettingCache::get<T, S>(config, std::string{key}, def);
+      return get_slot<T, S>(config, intern(key), def);
     }
 
     template<typename T, typename S = T>
     static workrave::config::Setting<T, S> &get(IConfigurator::Ptr config, std::string_view key, const S &def = S())
     {
-      return workrave::config::SettingCache::get<T, S>(config, std::string{key}, def);
+      return get_slot<T, S>(config, intern(key), def);
     }
 
     template<typename T, typename S = T>
     static workrave::config::Setting<T, S> &get(IConfigurator::Ptr config, const std::string &key, const S &def = S())
     {
-      auto &cache = get_cache();
-      if (cache.find(key) == cache.end())
-        {
-          cache[key] = std::make_shared<workrave::config::Setting<T, S>>(config, key, def);
-        }
+      return get_slot<T, S>(config, intern(key), def);
+    }
+
+    static workrave::config::SettingGroup &group(IConfigurator::Ptr config, const SettingKey &key)
+    {
+      return group_slot(config, key.slot());
+    }
 
-      auto ret = std::dynamic_pointer_cast<workrave::config::Setting<T, S>>(cache[key]);
-      assert(ret.get() != nullptr);
-      return *ret;
+    static workrave::config::SettingGroup &group(IConfigurator::Ptr config, const char *key)
+    {
+      return group_slot(config, intern(key));
     }
 
     static workrave::config::SettingGroup &group(IConfigurator::Ptr config, const std::string &key)
     {
-      auto &cache = get_cache();
-      if (cache.find(key) == cache.end())
+      return group_slot(config, intern(key));
+    }
+
+    //! Destroys all settings. Interned keys keep their slots.
+    static void reset();
+
+  private:
+    friend class SettingKey;
+
+    using Factory = std::function<std::unique_ptr<SettingBase>(const std::string &key)>;
+
+    template<typename T, typename S>
+    static workrave::config::Setting<T, S> &get_slot(IConfigurator::Ptr config, std::size_t slot, const S &def)
+    {
+      using SettingType = workrave::config::Setting<T, S>;
+
+      SettingBase *setting = find(slot, type_tag<SettingType>());
+      if (setting == nullptr)
         {
-          cache[key] = std::make_shared<workrave::config::SettingGroup>(config, key);
+          setting = &create(slot, type_tag<SettingType>(), [&](const std::string &key) {
+            return std::make_unique<SettingType>(config, key, def);
+          });
         }
+      return static_cast<SettingType &>(*setting);
+    }
 
-      auto ret = std::dynamic_pointer_cast<workrave::config::SettingGroup>(cache[key]);
-      assert(ret.get() != nullptr);
-      return *ret;
+    static workrave::config::SettingGroup &group_slot(IConfigurator::Ptr config, std::size_t slot)
+    {
+      SettingBase *setting = find(slot, type_tag<SettingGroup>());
+      if (setting == nullptr)
+        {
+          setting = &create(slot, type_tag<SettingGroup>(), [&](const std::string &key) {
+            return std::make_unique<SettingGroup>(config, key);
+          });
+        }
+      return static_cast<SettingGroup &>(*setting);
     }
 
-    static void reset()
+    //! Identifies the type of setting in a slot, in place of a dynamic_cast.
+    template<typename SettingType>
+    static const void *type_tag()
     {
-      get_cache().clear();
+      static const char tag{};
+      return &tag;
     }
+
+    static std::size_t intern(std::string_view key);
+    //! The setting in slot, or nullptr if there is none yet. Lock-free.
+    static SettingBase *find(std::size_t slot, const void *type) noexcept;
+    static SettingBase &create(std::size_t slot, const void *type, const Factory &factory);
   };
 } // namespace workrave::config
 
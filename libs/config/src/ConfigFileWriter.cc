@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "ConfigFileWriter.hh"
+
+#include <filesystem>
+#include <system_error>
+
+#include "utils/AtomicFile.hh"
+
+using namespace workrave::utils;
+
+ConfigFileWriter::ConfigFileWriter(std::shared_ptr<spdlog::logger> logger)
+  : logger(std::move(logger))
+{
+}
+
+bool
+ConfigFileWriter::write(const std::string &filename, const std::string &contents)
+{
+  if (filename.empty())
+    {
+      // Nothing was loaded, so there is no file to save to.
+      return false;
+    }
+
+  std::error_code ec;
+
+  std::filesystem::path target = filename;
+  if (std::filesystem::is_symlink(target, ec))
+    {
+      target = std::filesystem::canonical(target, ec);
+      if (ec)
+        {
+          logger->error("failed to resolve {} ({})", filename, ec.message());
+          return false;
+        }
+    }
+
+  if (!AtomicFile::write(target, contents, ec))
+    {
+      logger->error("failed to write {} ({})", target.string(), ec.message());
+      return false;
+    }
+
+  stats.writes++;
+  stats.bytes += contents.size();
+  logger->info("saved {} ({} bytes; {} writes, {} bytes, {} unchanged saves skipped so far)",
+               target.string(),
+               contents.size(),
+               stats.writes,
+               stats.bytes,
+               stats.skipped);
+  return true;
+}
+
+void
+ConfigFileWriter::skip()
+{
+  stats.skipped++;
+}
+
+const ConfigFileWriter::Stats &
+ConfigFileWriter::get_stats() const
+{
+  return stats;
+}
@@ -0,0 +1,60 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef CONFIGFILEWRITER_HH
+#define CONFIGFILEWRITER_HH
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "utils/Logging.hh"
+
+//! Writes configuration files so that a crash never leaves a partial file.
+/*!
+ *  The file is replaced through AtomicFile. A symbolic link is followed, so
+ *  the file it points to is replaced instead of the link.
+ */
+class ConfigFileWriter
+{
+public:
+  struct Stats
+  {
+    //! Files written.
+    uint64_t writes{0};
+    //! Saves that had nothing to write.
+    uint64_t skipped{0};
+    //! Bytes written, over all writes.
+    uint64_t bytes{0};
+  };
+
+  explicit ConfigFileWriter(std::shared_ptr<spdlog::logger> logger);
+
+  //! Replaces filename by contents. On failure, filename is left as it was.
+  bool write(const std::string &filename, const std::string &contents);
+
+  //! Counts a save that had nothing to write.
+  void skip();
+
+  const Stats &get_stats() const;
+
+private:
+  Stats stats;
+  std::shared_ptr<spdlog::logger> logger;
+};
+
+#endif // CONFIGFILEWRITER_HH
@@ -25,6 +25,8 @@
 #  include "MacOSHelpers.hh"
 #endif
 
+#include <algorithm>
+
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
 
@@ -53,6 +55,7 @@ Configurator::~Configurator()
 bool
 Configurator::load(std::string filename)
 {
+  generation++;
   return backend->load(filename);
 }
 
@@ -78,6 +81,7 @@ Configurator::heartbeat()
         {
           std::optional<ConfigValue> old_value = backend->get_value(delayed.key, ConfigValueToType(delayed.value));
           backend->set_value(delayed.key, delayed.value);
+          generation++;
 
           if (dynamic_cast<IConfigBackendMonitoring *>(backend) == nullptr)
             {
@@ -104,6 +108,26 @@ Configurator::heartbeat()
     }
 }
 
+int64_t
+Configurator::get_next_heartbeat_time() const
+{
+  int64_t next = auto_save_time;
+  for (const auto &[key, delayed]: delayed_config)
+    {
+      if (next == 0 || delayed.until < next)
+        {
+          next = delayed.until;
+        }
+    }
+  return next;
+}
+
+uint64_t
+Configurator::get_generation() const
+{
+  return generation;
+}
+
 void
 Configurator::set_delay(const std::string &key, int delay)
 {
@@ -120,6 +144,7 @@ void
 Configurator::remove_key(const std::string &key) const
 {
   backend->remove_key(trim_key(key));
+  generation++;
 }
 
 void
@@ -162,6 +187,7 @@ Configurator::set_value(const std::string &key, ConfigValue &value, workrave::co
           d.key = ckey;
           d.value = value;
           d.until = TimeSource::get_monotonic_time_sec() + delays[ckey];
+          generation++;
 
           skip = true;
         }
@@ -172,6 +198,7 @@ Configurator::set_value(const std::string &key, ConfigValue &value, workrave::co
       auto current_value = get_value(ckey, ConfigValueToType(value));
       bool valid = current_value.has_value();
       backend->set_value(ckey, value);
+      generation++;
 
       if (dynamic_cast<IConfigBackendMonitoring *>(backend) == nullptr)
         {
@@ -354,6 +381,88 @@ Configurator::set_value(const std::string &key, double v, workrave::config::Conf
   set_value(key, value, flags);
 }
 
+//! Sets all values at once.
+/*!
+ *  Delays do not apply, and pending delayed values of the same keys are
+ *  dropped. The backend receives the values between delay_changes() and
+ *  apply_changes(), and a file backend is saved once. Listeners hear of the
+ *  changes only after all values are set, in one event that carries every
+ *  changed key. A backend that reports changes itself reports these too;
+ *  those echoes are dropped. If the backend throws, the values set so far
+ *  are restored.
+ */
+void
+Configurator::set_values(const std::vector<std::pair<std::string, ConfigValue>> &values)
+{
+  TRACE_ENTRY();
+
+  // The last value staged for a key wins.
+  std::map<std::string, const ConfigValue *> staged;
+  for (const auto &[key, value]: values)
+    {
+      staged[trim_key(key)] = &value;
+    }
+
+  std::vector<std::pair<std::string, std::optional<ConfigValue>>> previous;
+  std::vector<std::string> changed;
+  const bool monitoring = dynamic_cast<IConfigBackendMonitoring *>(backend) != nullptr;
+
+  backend->delay_changes();
+  try
+    {
+      for (const auto &[key, value]: staged)
+        {
+          delayed_config.erase(key);
+
+          std::optional<ConfigValue> current_value = backend->get_value(key, ConfigValueToType(*value));
+          backend->set_value(key, *value);
+          if (!current_value.has_value() || current_value != *value)
+            {
+              changed.push_back(key);
+              if (monitoring)
+                {
+                  // Recorded before apply_changes(), which may report the change right away.
+                  pending_echoes[key] = *value;
+                }
+            }
+          previous.emplace_back(key, std::move(current_value));
+        }
+      backend->apply_changes(true);
+    }
+  catch (...)
+    {
+      for (auto it = previous.rbegin(); it != previous.rend(); it++)
+        {
+          if (it->second.has_value())
+            {
+              backend->set_value(it->first, it->second.value());
+            }
+          else
+            {
+              backend->remove_key(it->first);
+            }
+        }
+      backend->apply_changes(false);
+      for (const std::string &key: changed)
+        {
+          pending_echoes.erase(key);
+        }
+      generation++;
+      throw;
+    }
+  generation++;
+
+  if (!changed.empty())
+    {
+      if (!monitoring)
+        {
+          save();
+          auto_save_time = 0;
+        }
+      fire_configurator_events(changed);
+    }
+}
+
 void
 Configurator::get_value_with_default(const std::string &key, int32_t &out, int32_t def) const
 {
@@ -404,6 +513,19 @@ Configurator::get_value_with_default(const std::string &key, double &out, double
     }
 }
 
+namespace
+{
+  //! Removes and returns the first segment of a '/' separated path.
+  std::string_view
+  pop_segment(std::string_view &path)
+  {
+    const auto pos = path.find('/');
+    const std::string_view segment = path.substr(0, pos);
+    path = pos == std::string_view::npos ? std::string_view{} : path.substr(pos + 1);
+    return segment;
+  }
+} // namespace
+
 bool
 Configurator::add_listener(const std::string &key_prefix, IConfiguratorListener *listener)
 {
@@ -417,23 +539,29 @@ Configurator::add_listener(const std::string &key_prefix, IConfiguratorListener
 
   if (ret)
     {
-      auto i = listeners.begin();
-      while (ret && i != listeners.end())
+      ListenerNode *node = &listeners;
+      std::string_view path = key;
+      while (!path.empty())
         {
-          if (key == i->first && listener == i->second)
+          const std::string_view segment = pop_segment(path);
+          auto it = node->children.find(segment);
+          if (it == node->children.end())
             {
-              // Already added. Skip
-              ret = false;
+              it = node->children.emplace(std::string{segment}, std::make_unique<ListenerNode>()).first;
             }
-
-          i++;
+          node = it->second.get();
         }
-    }
 
-  if (ret)
-    {
-      // not found -> add
-      listeners.emplace_back(key, listener);
+      auto same = [listener](const ListenerEntry &l) { return l.listener == listener; };
+      if (std::any_of(node->listeners.begin(), node->listeners.end(), same))
+        {
+          // Already added. Skip
+          ret = false;
+        }
+      else
+        {
+          node->listeners.push_back({listener, last_event});
+        }
     }
 
   return ret;
@@ -443,21 +571,11 @@ bool
 Configurator::remove_listener(IConfiguratorListener *listener)
 {
   TRACE_ENTRY();
-  bool ret = false;
-
-  auto i = listeners.begin();
-  while (i != listeners.end())
+  bool ret = remove_listener_from(listeners, listener);
+  if (ret)
     {
-      if (listener == i->second)
-        {
-          // Found. Remove
-          i = listeners.erase(i);
-          ret = true;
-        }
-      else
-        {
-          i++;
-        }
+      listeners_removed = true;
+      erase_removed_listeners();
     }
   return ret;
 }
@@ -466,31 +584,86 @@ bool
 Configurator::remove_listener(const std::string &key_prefix, IConfiguratorListener *listener)
 {
   TRACE_ENTRY();
-  bool ret = false;
 
   if (dynamic_cast<IConfigBackendMonitoring *>(backend) != nullptr)
     {
       dynamic_cast<IConfigBackendMonitoring *>(backend)->remove_listener(key_prefix);
     }
 
-  auto i = listeners.begin();
-  while (i != listeners.end())
+  ListenerNode *node = &listeners;
+  std::string key = trim_key(key_prefix);
+  std::string_view path = key;
+  while (node != nullptr && !path.empty())
     {
-      if (i->first == key_prefix && i->second == listener)
+      auto it = node->children.find(pop_segment(path));
+      node = it != node->children.end() ? it->second.get() : nullptr;
+    }
+
+  if (node == nullptr)
+    {
+      return false;
+    }
+
+  auto same = [listener](const ListenerEntry &l) { return l.listener == listener; };
+  auto i = std::find_if(node->listeners.begin(), node->listeners.end(), same);
+  if (i == node->listeners.end())
+    {
+      return false;
+    }
+
+  // Found. Remove
+  i->listener = nullptr;
+  listeners_removed = true;
+  erase_removed_listeners();
+  return true;
+}
+
+bool
+Configurator::remove_listener_from(ListenerNode &node, IConfiguratorListener *listener)
+{
+  bool ret = false;
+  for (auto &l: node.listeners)
+    {
+      if (l.listener == listener)
         {
-          // Found. Remove
-          i = listeners.erase(i);
+          l.listener = nullptr;
           ret = true;
         }
-      else
-        {
-          i++;
-        }
+    }
+  for (auto &[segment, child]: node.children)
+    {
+      ret = remove_listener_from(*child, listener) || ret;
     }
   return ret;
 }
 
+void
+Configurator::erase_removed_listeners()
+{
+  if (dispatch_depth == 0 && listeners_removed)
+    {
+      prune_listeners(listeners);
+      listeners_removed = false;
+    }
+}
+
+//! Erases removed listeners and nodes without listeners. Returns whether node is empty.
+bool
+Configurator::prune_listeners(ListenerNode &node)
+{
+  std::erase_if(node.listeners, [](const auto &l) { return l.listener == nullptr; });
+  std::erase_if(node.children, [](const auto &child) { return prune_listeners(*child.second); });
+  return node.listeners.empty() && node.children.empty();
+}
+
 //! Fire a configuration changed event.
+/*!
+ *  Walks the listener tree along the segments of the key, so the cost
+ *  depends on the depth of the key and the number of listeners notified,
+ *  not on the number of listeners registered. Listeners may be added or
+ *  removed from a callback: added ones are not notified of the current
+ *  event, removed ones no longer are.
+ */
 void
 Configurator::fire_configurator_event(const std::string &key)
 {
@@ -498,22 +671,99 @@ Configurator::fire_configurator_event(const std::string &key)
 
   std::string ckey = trim_key(key);
 
-  auto listeners_copy = listeners;
+  dispatch_depth++;
+  const uint64_t event = ++last_event;
 
-  auto i = listeners_copy.begin();
-  while (i != listeners_copy.end())
+  // Nodes are not erased while dispatching, so node stays valid across callbacks.
+  const ListenerNode *node = &listeners;
+  notify_listeners(*node, ckey, event);
+
+  std::string_view path = ckey;
+  while (!path.empty())
     {
-      std::string prefix = i->first;
+      auto it = node->children.find(pop_segment(path));
+      if (it == node->children.end())
+        {
+          break;
+        }
+      node = it->second.get();
+      notify_listeners(*node, ckey, event);
+    }
+
+  dispatch_depth--;
+  erase_removed_listeners();
+}
 
-      if (ckey.substr(0, prefix.length()) == prefix)
+//! Fire one event for several changed keys.
+/*!
+ *  Every listener whose prefix matches any of the keys is notified once per
+ *  prefix, with all of the keys under it.
+ */
+void
+Configurator::fire_configurator_events(const std::vector<std::string> &keys)
+{
+  TRACE_ENTRY();
+
+  std::vector<std::pair<const ListenerNode *, std::vector<std::string>>> matches;
+  std::map<const ListenerNode *, std::size_t> matched;
+
+  for (const std::string &key: keys)
+    {
+      const ListenerNode *node = &listeners;
+      std::string_view path = key;
+      while (node != nullptr)
         {
-          IConfiguratorListener *l = i->second;
-          if (l != nullptr)
+          auto [match, inserted] = matched.try_emplace(node, matches.size());
+          if (inserted)
+            {
+              matches.emplace_back(node, std::vector<std::string>{});
+            }
+          matches[match->second].second.push_back(key);
+
+          if (path.empty())
             {
-              l->config_changed_notify(ckey);
+              break;
             }
+          auto it = node->children.find(pop_segment(path));
+          node = it != node->children.end() ? it->second.get() : nullptr;
+        }
+    }
+
+  dispatch_depth++;
+  const uint64_t event = ++last_event;
+  for (const auto &[node, node_keys]: matches)
+    {
+      notify_listeners(*node, node_keys, event);
+    }
+  dispatch_depth--;
+  erase_removed_listeners();
+}
+
+void
+Configurator::notify_listeners(const ListenerNode &node, const std::string &key, uint64_t event)
+{
+  // By index: callbacks may append listeners and so reallocate.
+  for (std::size_t i = 0; i < node.listeners.size(); i++)
+    {
+      const ListenerEntry &entry = node.listeners[i];
+      if (entry.listener != nullptr && entry.added_after < event)
+        {
+          entry.listener->config_changed_notify(key);
+        }
+    }
+}
+
+void
+Configurator::notify_listeners(const ListenerNode &node, const std::vector<std::string> &keys, uint64_t event)
+{
+  // By index: callbacks may append listeners and so reallocate.
+  for (std::size_t i = 0; i < node.listeners.size(); i++)
+    {
+      const ListenerEntry &entry = node.listeners[i];
+      if (entry.listener != nullptr && entry.added_after < event)
+        {
+          entry.listener->config_changes_notify(keys);
         }
-      i++;
     }
 }
 
@@ -526,5 +776,19 @@ Configurator::trim_key(const std::string &key)
 void
 Configurator::config_changed_notify(const std::string &key)
 {
+  generation++;
+
+  // Listeners have already heard of the values set_values() wrote.
+  auto it = pending_echoes.find(trim_key(key));
+  if (it != pending_echoes.end())
+    {
+      const bool echo = backend->get_value(it->first, ConfigValueToType(it->second)) == it->second;
+      pending_echoes.erase(it);
+      if (echo)
+        {
+          return;
+        }
+    }
+
   fire_configurator_event(key);
 }
@@ -21,8 +21,10 @@
 #define CONFIGURATOR_HH
 
 #include <string>
-#include <list>
+#include <string_view>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "config/IConfigurator.hh"
 #include "config/IConfiguratorListener.hh"
@@ -39,6 +41,8 @@ public:
   ~Configurator() override;
 
   void heartbeat() override;
+  int64_t get_next_heartbeat_time() const override;
+  uint64_t get_generation() const override;
 
   void set_delay(const std::string &key, int delay) override;
 
@@ -82,6 +86,8 @@ public:
                  double v,
                  workrave::config::ConfigFlags flags = workrave::config::CONFIG_FLAG_NONE) override;
 
+  void set_values(const std::vector<std::pair<std::string, ConfigValue>> &values) override;
+
   bool add_listener(const std::string &key_prefix, workrave::config::IConfiguratorListener *listener) override;
   bool remove_listener(workrave::config::IConfiguratorListener *listener) override;
   bool remove_listener(const std::string &key_prefix, workrave::config::IConfiguratorListener *listener) override;
@@ -94,6 +100,21 @@ private:
     int64_t until;
   };
 
+  struct ListenerEntry
+  {
+    //! Nulled when removed while an event is dispatched, and erased afterwards.
+    workrave::config::IConfiguratorListener *listener;
+    //! The last event fired before the listener was added; it only hears of later ones.
+    uint64_t added_after;
+  };
+
+  //! Listeners of one key prefix, and the prefixes one path segment longer.
+  struct ListenerNode
+  {
+    std::map<std::string, std::unique_ptr<ListenerNode>, std::less<>> children;
+    std::vector<ListenerEntry> listeners;
+  };
+
 private:
   bool set_value(const std::string &key,
                  ConfigValue &value,
@@ -102,14 +123,28 @@ private:
   static std::string trim_key(const std::string &key);
 
   void fire_configurator_event(const std::string &key);
+  void fire_configurator_events(const std::vector<std::string> &keys);
+  static void notify_listeners(const ListenerNode &node, const std::string &key, uint64_t event);
+  static void notify_listeners(const ListenerNode &node, const std::vector<std::string> &keys, uint64_t event);
+  static bool remove_listener_from(ListenerNode &node, workrave::config::IConfiguratorListener *listener);
+  void erase_removed_listeners();
+  static bool prune_listeners(ListenerNode &node);
   void config_changed_notify(const std::string &key) override;
 
 private:
   std::map<std::string, int> delays;
   std::map<std::string, DelayedConfig> delayed_config;
-  std::list<std::pair<std::string, workrave::config::IConfiguratorListener *>> listeners;
+  //! Values written by set_values() that a monitoring backend has yet to report back.
+  std::map<std::string, ConfigValue> pending_echoes;
+  ListenerNode listeners;
+  //! Number of events being dispatched; listener nodes are only erased when none are.
+  int dispatch_depth{0};
+  uint64_t last_event{0};
+  bool listeners_removed{false};
   IConfigBackend *backend{nullptr};
   int64_t auto_save_time{0};
+  //! Bumped by every change, including delayed and removed values, which listeners do not hear about.
+  mutable uint64_t generation{0};
   std::string last_filename;
   std::shared_ptr<spdlog::logger> logger{workrave::utils::Logging::create("config")};
 };
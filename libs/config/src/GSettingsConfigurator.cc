@@ -61,7 +61,7 @@ void
 GSettingsConfigurator::remove_key(const std::string &key)
 {
   std::string subkey;
-  GSettings *child = get_settings(key, subkey);
+  GSettings *child = get_writable_settings(key, subkey);
   g_settings_reset(child, subkey.c_str());
 }
 
@@ -160,7 +160,7 @@ void
 GSettingsConfigurator::set_value(const std::string &key, const ConfigValue &value)
 {
   std::string subkey;
-  GSettings *child = get_settings(key, subkey);
+  GSettings *child = get_writable_settings(key, subkey);
 
   if (child == nullptr)
     {
@@ -202,6 +202,34 @@ GSettingsConfigurator::set_value(const std::string &key, const ConfigValue &valu
     value);
 }
 
+void
+GSettingsConfigurator::delay_changes()
+{
+  delaying = true;
+}
+
+void
+GSettingsConfigurator::apply_changes(bool apply)
+{
+  // The GSettings objects that are monitored see the applied keys change,
+  // and report them as usual. The Configurator recognises those reports as
+  // echoes of the changes it has already announced, and drops them.
+  for (const auto &[schema, setting]: delayed_settings)
+    {
+      if (apply)
+        {
+          g_settings_apply(setting);
+        }
+      else
+        {
+          g_settings_revert(setting);
+        }
+      g_object_unref(setting);
+    }
+  delayed_settings.clear();
+  delaying = false;
+}
+
 void
 GSettingsConfigurator::set_listener(workrave::config::IConfiguratorListener *listener)
 {
@@ -313,3 +341,27 @@ GSettingsConfigurator::get_settings(const std::string &key, std::string &subkey)
 
   return i->second;
 }
+
+GSettings *
+GSettingsConfigurator::get_writable_settings(const std::string &key, std::string &subkey)
+{
+  GSettings *child = get_settings(key, subkey);
+  if (child == nullptr || !delaying)
+    {
+      return child;
+    }
+
+  // g_settings_delay() cannot be undone, so changes are delayed in a copy.
+  gchar *schema = nullptr;
+  g_object_get(child, "schema-id", &schema, NULL);
+
+  auto [it, inserted] = delayed_settings.try_emplace(schema, nullptr);
+  if (inserted)
+    {
+      it->second = g_settings_new(schema);
+      g_settings_delay(it->second);
+    }
+
+  g_free(schema);
+  return it->second;
+}
@@ -43,6 +43,8 @@ public:
   bool has_user_value(const std::string &key) override;
   std::optional<ConfigValue> get_value(const std::string &key, ConfigType type) const override;
   void set_value(const std::string &key, const ConfigValue &value) override;
+  void delay_changes() override;
+  void apply_changes(bool apply) override;
 
   void set_listener(workrave::config::IConfiguratorListener *listener) override;
   bool add_listener(const std::string &key_prefix) override;
@@ -52,6 +54,7 @@ private:
   void add_children();
   static void key_split(const std::string &key, std::string &path, std::string &subkey);
   GSettings *get_settings(const std::string &key, std::string &subkey) const;
+  GSettings *get_writable_settings(const std::string &key, std::string &subkey);
 
   static void on_settings_changed(GSettings *settings, const gchar *key, void *user_data);
 
@@ -61,6 +64,9 @@ private:
 
   workrave::config::IConfiguratorListener *listener{nullptr};
   std::map<std::string, GSettings *> settings;
+  //! Delay-apply copies of the schemas written since delay_changes().
+  std::map<std::string, GSettings *> delayed_settings;
+  bool delaying{false};
   std::shared_ptr<spdlog::logger> logger{workrave::utils::Logging::create("config:gsettings")};
 };
 
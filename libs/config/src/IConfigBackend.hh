@@ -27,7 +27,7 @@ using ConfigValue = workrave::config::ConfigValue;
 using ConfigType = workrave::config::ConfigType;
 
 constexpr ConfigType
-ConfigValueToType(ConfigValue &value)
+ConfigValueToType(const ConfigValue &value)
 {
   return std::visit(
     [](auto &&arg) {
@@ -76,6 +76,17 @@ public:
   virtual bool has_user_value(const std::string &key) = 0;
   virtual std::optional<ConfigValue> get_value(const std::string &key, ConfigType type) const = 0;
   virtual void set_value(const std::string &key, const ConfigValue &value) = 0;
+
+  //! Holds back set_value and remove_key until apply_changes(), so that they reach storage together.
+  virtual void delay_changes()
+  {
+  }
+
+  //! Writes the changes held back since delay_changes(), or discards them if apply is false.
+  virtual void apply_changes(bool apply)
+  {
+    (void)apply;
+  }
 };
 
 class IConfigBackendMonitoring
@@ -25,7 +25,7 @@
 
 #include "IniConfigurator.hh"
 
-#include <fstream>
+#include <sstream>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/property_tree/ini_parser.hpp>
@@ -39,6 +39,7 @@ IniConfigurator::load(std::string filename)
     {
       last_filename = filename;
       boost::property_tree::ini_parser::read_ini(filename, pt);
+      dirty_keys.clear();
       ret = !pt.empty();
     }
   catch (boost::property_tree::ini_parser_error &e)
@@ -52,10 +53,21 @@ IniConfigurator::load(std::string filename)
 void
 IniConfigurator::save()
 {
+  if (dirty_keys.empty())
+    {
+      writer.skip();
+      return;
+    }
+
   try
     {
-      std::ofstream config_file(last_filename.c_str());
-      boost::property_tree::ini_parser::write_ini(config_file, pt);
+      logger->debug("save {} changed keys", dirty_keys.size());
+      std::ostringstream contents;
+      boost::property_tree::ini_parser::write_ini(contents, pt);
+      if (writer.write(last_filename, contents.str()))
+        {
+          dirty_keys.clear();
+        }
     }
   catch (boost::property_tree::ini_parser_error &e)
     {
@@ -95,7 +107,10 @@ IniConfigurator::remove_key(const std::string &key)
           std::string section = key.substr(0, pos);
           boost::replace_all(inikey, "/", ".");
 
-          pt.get_child(section).erase(inikey);
+          if (pt.get_child(section).erase(inikey) > 0)
+            {
+              dirty_keys.insert(key);
+            }
         }
     }
   catch (boost::property_tree::ptree_error &e)
@@ -154,7 +169,12 @@ IniConfigurator::set_value(const std::string &key, const ConfigValue &value)
           if constexpr (!std::is_same_v<std::monostate, T>)
             {
               logger->debug("write {} = {}", key, value);
+              auto old_value = pt.get_optional<std::string>(inikey);
               pt.put(inikey, value);
+              if (old_value != pt.get_optional<std::string>(inikey))
+                {
+                  dirty_keys.insert(key);
+                }
             }
         },
         value);
@@ -165,6 +185,12 @@ IniConfigurator::set_value(const std::string &key, const ConfigValue &value)
     }
 }
 
+const ConfigFileWriter::Stats &
+IniConfigurator::get_write_stats() const
+{
+  return writer.get_stats();
+}
+
 boost::property_tree::ptree::path_type
 IniConfigurator::path(const std::string &key)
 {
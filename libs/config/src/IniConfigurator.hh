@@ -18,9 +18,11 @@
 #ifndef INICONFIGURATOR_HH
 #define INICONFIGURATOR_HH
 
+#include <set>
 #include <string>
 #include <boost/property_tree/ptree.hpp>
 
+#include "ConfigFileWriter.hh"
 #include "IConfigBackend.hh"
 #include "utils/Logging.hh"
 
@@ -38,6 +40,8 @@ public:
   std::optional<ConfigValue> get_value(const std::string &key, ConfigType type) const override;
   void set_value(const std::string &key, const ConfigValue &value) override;
 
+  const ConfigFileWriter::Stats &get_write_stats() const;
+
 private:
   static boost::property_tree::ptree::path_type path(const std::string &key);
 
@@ -45,6 +49,9 @@ private:
   boost::property_tree::ptree pt;
   std::string last_filename;
   std::shared_ptr<spdlog::logger> logger{workrave::utils::Logging::create("config:ini")};
+  //! Keys changed since the file was last loaded or saved.
+  std::set<std::string> dirty_keys;
+  ConfigFileWriter writer{logger};
 };
 
 #endif // INICONFIGURATOR_HH
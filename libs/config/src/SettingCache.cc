@@ -0,0 +1,161 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "config/SettingCache.hh"
+
+#include <array>
+#include <cassert>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+using namespace workrave::config;
+
+namespace
+{
+  struct Slot
+  {
+    std::string key;
+    //! Published last, so that type and owner are visible to whoever sees it.
+    std::atomic<SettingBase *> setting{nullptr};
+    const void *type{nullptr};
+    std::unique_ptr<SettingBase> owner;
+  };
+
+  //! Slots are allocated in chunks that never move, so readers can index
+  //! them without a lock while new slots are added.
+  constexpr std::size_t chunk_bits = 6;
+  constexpr std::size_t chunk_size = std::size_t{1} << chunk_bits;
+  constexpr std::size_t max_chunks = 256;
+
+  struct Registry
+  {
+    std::mutex mutex;
+    std::map<std::string, std::size_t, std::less<>> slots;
+    std::array<std::atomic<Slot *>, max_chunks> chunks{};
+    std::size_t size{0};
+
+    ~Registry()
+    {
+      for (auto &chunk: chunks)
+        {
+          delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    Slot &at(std::size_t index)
+    {
+      return chunks[index >> chunk_bits].load(std::memory_order_acquire)[index & (chunk_size - 1)];
+    }
+  };
+
+  Registry &
+  registry()
+  {
+    static Registry instance;
+    return instance;
+  }
+} // namespace
+
+SettingKey::SettingKey(const std::string &name)
+  : slot_index(SettingCache::intern(name))
+{
+}
+
+std::size_t
+SettingKey::intern() const
+{
+  // Racing threads intern the same name and so store the same index.
+  const std::size_t index = SettingCache::intern(name);
+  slot_index.store(index, std::memory_order_release);
+  return index;
+}
+
+std::size_t
+SettingCache::intern(std::string_view key)
+{
+  auto &reg = registry();
+  std::scoped_lock lock(reg.mutex);
+
+  auto it = reg.slots.find(key);
+  if (it != reg.slots.end())
+    {
+      return it->second;
+    }
+
+  const std::size_t index = reg.size;
+  const std::size_t chunk = index >> chunk_bits;
+  if (chunk >= max_chunks)
+    {
+      throw std::length_error("too many settings");
+    }
+  if (reg.chunks[chunk].load(std::memory_order_relaxed) == nullptr)
+    {
+      reg.chunks[chunk].store(new Slot[chunk_size], std::memory_order_release);
+    }
+
+  reg.at(index).key = std::string{key};
+  reg.slots.emplace(std::string{key}, index);
+  reg.size++;
+  return index;
+}
+
+SettingBase *
+SettingCache::find(std::size_t slot, const void *type) noexcept
+{
+  Slot &s = registry().at(slot);
+  SettingBase *setting = s.setting.load(std::memory_order_acquire);
+  assert(setting == nullptr || s.type == type);
+  return setting;
+}
+
+SettingBase &
+SettingCache::create(std::size_t slot, const void *type, const Factory &factory)
+{
+  auto &reg = registry();
+  std::scoped_lock lock(reg.mutex);
+
+  // Another thread may have created it since find().
+  Slot &s = reg.at(slot);
+  if (s.owner == nullptr)
+    {
+      s.owner = factory(s.key);
+      s.type = type;
+      s.setting.store(s.owner.get(), std::memory_order_release);
+    }
+  assert(s.type == type);
+  return *s.owner;
+}
+
+void
+SettingCache::reset()
+{
+  auto &reg = registry();
+  std::scoped_lock lock(reg.mutex);
+
+  for (std::size_t index = 0; index < reg.size; index++)
+    {
+      Slot &s = reg.at(index);
+      s.setting.store(nullptr, std::memory_order_relaxed);
+      s.type = nullptr;
+      s.owner.reset();
+    }
+}
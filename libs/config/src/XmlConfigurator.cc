@@ -21,7 +21,7 @@
 
 #include "XmlConfigurator.hh"
 
-#include <fstream>
+#include <sstream>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/property_tree/xml_parser.hpp>
@@ -37,6 +37,7 @@ XmlConfigurator::load(std::string filename)
     {
       last_filename = filename;
       boost::property_tree::xml_parser::read_xml(filename, pt);
+      dirty_keys.clear();
       ret = !pt.empty();
     }
   catch (boost::property_tree::xml_parser_error &e)
@@ -49,10 +50,21 @@ XmlConfigurator::load(std::string filename)
 void
 XmlConfigurator::save()
 {
+  if (dirty_keys.empty())
+    {
+      writer.skip();
+      return;
+    }
+
   try
     {
-      std::ofstream config_file(last_filename.c_str());
-      boost::property_tree::xml_parser::write_xml(config_file, pt);
+      logger->debug("save {} changed keys", dirty_keys.size());
+      std::ostringstream contents;
+      boost::property_tree::xml_parser::write_xml(contents, pt);
+      if (writer.write(last_filename, contents.str()))
+        {
+          dirty_keys.clear();
+        }
     }
   catch (boost::property_tree::xml_parser_error &e)
     {
@@ -97,6 +109,7 @@ XmlConfigurator::remove_key(const std::string &key)
               if (&part == &parts.back())
                 {
                   node->erase(node->to_iterator(it));
+                  dirty_keys.insert(key);
                 }
               else
                 {
@@ -157,7 +170,13 @@ XmlConfigurator::set_value(const std::string &key, const ConfigValue &value)
           if constexpr (!std::is_same_v<std::monostate, T>)
             {
               logger->debug("write {} = {}", key, value);
-              pt.put(path(key), value);
+              const std::string xmlkey = path(key);
+              auto old_value = pt.get_optional<std::string>(xmlkey);
+              pt.put(xmlkey, value);
+              if (old_value != pt.get_optional<std::string>(xmlkey))
+                {
+                  dirty_keys.insert(key);
+                }
             }
         },
         value);
@@ -168,6 +187,12 @@ XmlConfigurator::set_value(const std::string &key, const ConfigValue &value)
     }
 }
 
+const ConfigFileWriter::Stats &
+XmlConfigurator::get_write_stats() const
+{
+  return writer.get_stats();
+}
+
 std::string
 XmlConfigurator::path(const std::string &key)
 {
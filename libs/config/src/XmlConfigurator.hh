@@ -18,9 +18,11 @@
 #ifndef XMLCONFIGURATOR_HH
 #define XMLCONFIGURATOR_HH
 
+#include <set>
 #include <string>
 #include <boost/property_tree/ptree.hpp>
 
+#include "ConfigFileWriter.hh"
 #include "IConfigBackend.hh"
 
 #include "utils/Logging.hh"
@@ -39,6 +41,8 @@ public:
   std::optional<ConfigValue> get_value(const std::string &key, ConfigType type) const override;
   void set_value(const std::string &key, const ConfigValue &value) override;
 
+  const ConfigFileWriter::Stats &get_write_stats() const;
+
 private:
   static std::string path(const std::string &key);
 
@@ -46,6 +50,9 @@ private:
   std::shared_ptr<spdlog::logger> logger{workrave::utils::Logging::create("config:xml")};
   boost::property_tree::ptree pt;
   std::string last_filename;
+  //! Keys changed since the file was last loaded or saved.
+  std::set<std::string> dirty_keys;
+  ConfigFileWriter writer{logger};
 };
 
 #endif // XMLCONFIGURATOR_HH
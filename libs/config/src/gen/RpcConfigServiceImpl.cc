@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcConfigServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,8 +15,9 @@ namespace workrave::config::rpc
 {
 
 
-ConfigService::ConfigService(workrave::config::IConfigurator &impl)
+ConfigService::ConfigService(workrave::config::IConfigurator &impl, ::rpc::Executor &executor)
   : impl_(impl)
+  , executor_(executor)
   , service_descriptor_anchor_(&::descriptor_table_RpcConfig_2eproto)
 {
 }
@@ -25,21 +28,28 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::RemoveKeyRequest *request,
                                                             ::workrave::config::RemoveKeyResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "RemoveKey");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.remove_key(request->key());
+      executor_.run([&] { impl_.remove_key(request->key()); });
 
 
-      ::rpc::intercept_request({"workrave.ConfigService", "RemoveKey", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "RemoveKey", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -47,21 +57,28 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::RenameKeyRequest *request,
                                                             ::workrave::config::RenameKeyResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "RenameKey");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.rename_key(request->key(), request->new_key());
+      executor_.run([&] { impl_.rename_key(request->key(), request->new_key()); });
 
 
-      ::rpc::intercept_request({"workrave.ConfigService", "RenameKey", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "RenameKey", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -69,24 +86,31 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::HasUserValueRequest *request,
                                                             ::workrave::config::HasUserValueResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "HasUserValue");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.has_user_value(request->key());
+      auto rpc_result = executor_.run([&] { return impl_.has_user_value(request->key()); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.ConfigService", "HasUserValue", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "HasUserValue", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -94,6 +118,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetStringRequest *request,
                                                             ::workrave::config::GetStringResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetString");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -101,7 +128,7 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       std::string local_out{};
 
 
-      auto rpc_result = impl_.get_value(request->key(), local_out);
+      auto rpc_result = executor_.run([&] { return impl_.get_value(request->key(), local_out); });
 
       response->set_result(rpc_result);
 
@@ -109,13 +136,17 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetString", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetString", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -123,6 +154,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetBoolRequest *request,
                                                             ::workrave::config::GetBoolResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetBool");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -130,7 +164,7 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       bool local_out{};
 
 
-      auto rpc_result = impl_.get_value(request->key(), local_out);
+      auto rpc_result = executor_.run([&] { return impl_.get_value(request->key(), local_out); });
 
       response->set_result(rpc_result);
 
@@ -138,13 +172,17 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetBool", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetBool", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -152,6 +190,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetIntRequest *request,
                                                             ::workrave::config::GetIntResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetInt");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -159,7 +200,7 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       int32_t local_out{};
 
 
-      auto rpc_result = impl_.get_value(request->key(), local_out);
+      auto rpc_result = executor_.run([&] { return impl_.get_value(request->key(), local_out); });
 
       response->set_result(rpc_result);
 
@@ -167,13 +208,17 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetInt", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetInt", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -181,6 +226,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetInt64Request *request,
                                                             ::workrave::config::GetInt64Response *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetInt64");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -188,7 +236,7 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       int64_t local_out{};
 
 
-      auto rpc_result = impl_.get_value(request->key(), local_out);
+      auto rpc_result = executor_.run([&] { return impl_.get_value(request->key(), local_out); });
 
       response->set_result(rpc_result);
 
@@ -196,13 +244,17 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetInt64", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetInt64", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -210,6 +262,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetDoubleRequest *request,
                                                             ::workrave::config::GetDoubleResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetDouble");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -217,7 +272,7 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       double local_out{};
 
 
-      auto rpc_result = impl_.get_value(request->key(), local_out);
+      auto rpc_result = executor_.run([&] { return impl_.get_value(request->key(), local_out); });
 
       response->set_result(rpc_result);
 
@@ -225,13 +280,17 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetDouble", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetDouble", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -239,6 +298,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetStringWithDefaultRequest *request,
                                                             ::workrave::config::GetStringWithDefaultResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetStringWithDefault");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -246,18 +308,22 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       std::string local_out{};
 
 
-      impl_.get_value_with_default(request->key(), local_out, request->s());
+      executor_.run([&] { impl_.get_value_with_default(request->key(), local_out, request->s()); });
 
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetStringWithDefault", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetStringWithDefault", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -265,6 +331,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetBoolWithDefaultRequest *request,
                                                             ::workrave::config::GetBoolWithDefaultResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetBoolWithDefault");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -272,18 +341,22 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       bool local_out{};
 
 
-      impl_.get_value_with_default(request->key(), local_out, request->def());
+      executor_.run([&] { impl_.get_value_with_default(request->key(), local_out, request->def()); });
 
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetBoolWithDefault", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetBoolWithDefault", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -291,6 +364,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetIntWithDefaultRequest *request,
                                                             ::workrave::config::GetIntWithDefaultResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetIntWithDefault");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -298,18 +374,22 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       int32_t local_out{};
 
 
-      impl_.get_value_with_default(request->key(), local_out, request->def());
+      executor_.run([&] { impl_.get_value_with_default(request->key(), local_out, request->def()); });
 
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetIntWithDefault", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetIntWithDefault", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -317,6 +397,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetInt64WithDefaultRequest *request,
                                                             ::workrave::config::GetInt64WithDefaultResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetInt64WithDefault");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -324,18 +407,22 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       int64_t local_out{};
 
 
-      impl_.get_value_with_default(request->key(), local_out, request->def());
+      executor_.run([&] { impl_.get_value_with_default(request->key(), local_out, request->def()); });
 
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetInt64WithDefault", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetInt64WithDefault", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -343,6 +430,9 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::GetDoubleWithDefaultRequest *request,
                                                             ::workrave::config::GetDoubleWithDefaultResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "GetDoubleWithDefault");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -350,18 +440,22 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
       double local_out{};
 
 
-      impl_.get_value_with_default(request->key(), local_out, request->def());
+      executor_.run([&] { impl_.get_value_with_default(request->key(), local_out, request->def()); });
 
 
       response->set_out(local_out);
 
-      ::rpc::intercept_request({"workrave.ConfigService", "GetDoubleWithDefault", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "GetDoubleWithDefault", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -369,21 +463,28 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::SetStringRequest *request,
                                                             ::workrave::config::SetStringResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "SetString");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags()));
+      executor_.run([&] { impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags())); });
 
 
-      ::rpc::intercept_request({"workrave.ConfigService", "SetString", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "SetString", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -391,21 +492,28 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::SetIntRequest *request,
                                                             ::workrave::config::SetIntResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "SetInt");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags()));
+      executor_.run([&] { impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags())); });
 
 
-      ::rpc::intercept_request({"workrave.ConfigService", "SetInt", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "SetInt", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -413,21 +521,28 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::SetInt64Request *request,
                                                             ::workrave::config::SetInt64Response *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "SetInt64");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags()));
+      executor_.run([&] { impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags())); });
 
 
-      ::rpc::intercept_request({"workrave.ConfigService", "SetInt64", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "SetInt64", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -435,21 +550,28 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::SetBoolRequest *request,
                                                             ::workrave::config::SetBoolResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "SetBool");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags()));
+      executor_.run([&] { impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags())); });
 
 
-      ::rpc::intercept_request({"workrave.ConfigService", "SetBool", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "SetBool", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -457,21 +579,28 @@ ConfigService::ConfigService(workrave::config::IConfigurator &impl)
                                                             const ::workrave::config::SetDoubleRequest *request,
                                                             ::workrave::config::SetDoubleResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.ConfigService", "SetDouble");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags()));
+      executor_.run([&] { impl_.set_value(request->key(), request->v(), static_cast<workrave::config::ConfigFlags>(request->flags())); });
 
 
-      ::rpc::intercept_request({"workrave.ConfigService", "SetDouble", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.ConfigService", "SetDouble", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
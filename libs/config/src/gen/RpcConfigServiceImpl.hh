@@ -7,6 +7,7 @@
 #include "config/IConfigurator.hh"
 
 
+#include "rpc/Executor.hh"
 
 
 namespace workrave::config::rpc
@@ -15,7 +16,8 @@ class ConfigService final : public ::workrave::rpc::ConfigService::Service
 {
 public:
 
-  explicit ConfigService(workrave::config::IConfigurator &impl);
+  explicit ConfigService(workrave::config::IConfigurator &impl,
+                         ::rpc::Executor &executor = ::rpc::Executor::inline_executor());
 
 
 
@@ -97,6 +99,7 @@ public:
 private:
 
   workrave::config::IConfigurator &impl_;
+  ::rpc::Executor &executor_;
 
 
   [[maybe_unused]] const void *const service_descriptor_anchor_;
@@ -19,6 +19,12 @@
 #  include "config.h"
 #endif
 
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <spdlog/spdlog.h>
@@ -28,6 +34,7 @@
 #include "SimulatedTime.hh"
 
 #include "Configurator.hh"
+#include "config/ConfigTransaction.hh"
 #include "config/SettingCache.hh"
 #include "utils/Logging.hh"
 #include "utils/Enum.hh"
@@ -936,6 +943,89 @@ TYPED_TEST(ConfigTest, test_configurator_listener_add_remove)
   EXPECT_EQ(ok, false);
 }
 
+TYPED_TEST(ConfigTest, test_configurator_listener_path_segments)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  bool ok{false};
+
+  ok = this->configurator->add_listener("test/other/int", this);
+  EXPECT_EQ(ok, true);
+
+  this->configurator->set_value("test/other/int32", 1007);
+  EXPECT_EQ(this->config_changed_count, 0);
+
+  ok = this->configurator->add_listener("", this);
+  EXPECT_EQ(ok, true);
+  ok = this->configurator->add_listener("test", this);
+  EXPECT_EQ(ok, true);
+
+  this->expected_key = "test/other/int32";
+  this->configurator->set_value("test/other/int32", 1008);
+  EXPECT_EQ(this->config_changed_count, 2);
+
+  ok = this->configurator->remove_listener(this);
+  EXPECT_EQ(ok, true);
+
+  this->configurator->set_value("test/other/int32", 1009);
+  EXPECT_EQ(this->config_changed_count, 2);
+}
+
+TYPED_TEST(ConfigTest, test_configurator_listener_changes_during_callback)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  class Listener : public IConfiguratorListener
+  {
+  public:
+    void config_changed_notify(const std::string & /*key*/) override
+    {
+      count++;
+      if (on_change)
+        {
+          on_change();
+        }
+    }
+
+    int count{0};
+    std::function<void()> on_change;
+  };
+
+  Listener first;
+  Listener second;
+  Listener added;
+
+  // The first listener removes the second one, which must not be notified
+  // any more, and adds another one, which only hears of later changes.
+  first.on_change = [&]() {
+    this->configurator->remove_listener("test/other", &second);
+    this->configurator->add_listener("test/other/int32", &added);
+  };
+
+  this->configurator->add_listener("test/other", &first);
+  this->configurator->add_listener("test/other", &second);
+
+  this->configurator->set_value("test/other/int32", 1010);
+  EXPECT_EQ(first.count, 1);
+  EXPECT_EQ(second.count, 0);
+  EXPECT_EQ(added.count, 0);
+
+  first.on_change = [&]() { this->configurator->remove_listener(&first); };
+
+  this->configurator->set_value("test/other/int32", 1011);
+  EXPECT_EQ(first.count, 2);
+  EXPECT_EQ(second.count, 0);
+  EXPECT_EQ(added.count, 1);
+
+  this->configurator->set_value("test/other/int32", 1012);
+  EXPECT_EQ(first.count, 2);
+  EXPECT_EQ(added.count, 2);
+
+  this->configurator->remove_listener(&added);
+}
+
 TYPED_TEST(ConfigTest, test_configurator_leading_slash)
 {
   using T = TypeParam;
@@ -1070,6 +1160,26 @@ TYPED_TEST(ConfigTest, test_configurator_delay_repeat)
   EXPECT_EQ(ok, true);
 }
 
+TYPED_TEST(ConfigTest, test_configurator_next_heartbeat_time)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  EXPECT_EQ(this->configurator->get_next_heartbeat_time(), 0);
+
+  this->configurator->set_delay("test/other/int32", 5);
+  this->configurator->set_value("test/other/int32", 1018);
+
+  const int64_t now = TimeSource::get_monotonic_time_sec();
+  EXPECT_EQ(this->configurator->get_next_heartbeat_time(), now + 5);
+
+  this->tick(6, [](int32_t c) {});
+
+  // The delayed change is done; at most the auto-save is still to come.
+  const int64_t next = this->configurator->get_next_heartbeat_time();
+  EXPECT_TRUE(next == 0 || next > TimeSource::get_monotonic_time_sec());
+}
+
 TYPED_TEST(ConfigFileTest, test_configurator_delay_save_load)
 {
   using T = TypeParam;
@@ -1506,6 +1616,273 @@ TYPED_TEST(ConfigFileTest, test_configurator_save_load)
   EXPECT_EQ(bvalue, false);
 }
 
+//! Records the notifications it receives, single keys and batches apart.
+class TransactionListener : public IConfiguratorListener
+{
+public:
+  void config_changed_notify(const std::string &key) override
+  {
+    keys.push_back(key);
+  }
+
+  void config_changes_notify(const std::vector<std::string> &changed) override
+  {
+    batches.push_back(changed);
+  }
+
+  std::vector<std::string> keys;
+  std::vector<std::vector<std::string>> batches;
+};
+
+//! A backend that reports every change it stores, as GSettings does.
+class EchoingConfigurator
+  : public IniConfigurator
+  , public IConfigBackendMonitoring
+{
+public:
+  void set_value(const std::string &key, const ConfigValue &value) override
+  {
+    IniConfigurator::set_value(key, value);
+    if (delaying)
+      {
+        held_back.push_back(key);
+      }
+    else
+      {
+        echo(key);
+      }
+  }
+
+  void delay_changes() override
+  {
+    delaying = true;
+  }
+
+  void apply_changes(bool apply) override
+  {
+    delaying = false;
+    if (apply)
+      {
+        for (const std::string &key: held_back)
+          {
+            echo(key);
+          }
+      }
+    held_back.clear();
+  }
+
+  void set_listener(IConfiguratorListener *listener) override
+  {
+    this->listener = listener;
+  }
+
+  bool add_listener(const std::string & /*key_prefix*/) override
+  {
+    return true;
+  }
+
+  bool remove_listener(const std::string & /*key_prefix*/) override
+  {
+    return true;
+  }
+
+private:
+  void echo(const std::string &key)
+  {
+    if (listener != nullptr)
+      {
+        listener->config_changed_notify(key);
+      }
+  }
+
+  IConfiguratorListener *listener{nullptr};
+  std::vector<std::string> held_back;
+  bool delaying{false};
+};
+
+class ConfigMonitoringTest
+  : public Fixture
+  , public ::testing::Test
+{
+};
+
+TYPED_TEST(ConfigFileTest, test_configurator_transaction)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  this->configurator->load("temp-transaction");
+  this->configurator->set_value("test/transaction/int32", 1040);
+  this->configurator->set_value("test/transaction/string", "1040");
+
+  TransactionListener section;
+  TransactionListener string;
+  this->configurator->add_listener("test/transaction", &section);
+  this->configurator->add_listener("test/transaction/string", &string);
+
+  ConfigTransaction transaction(this->configurator);
+  transaction.set_value("test/transaction/int32", 1041);
+  transaction.set_value("/test/transaction/int32", 1042);
+  transaction.set_value("test/transaction/string", "1040");
+  transaction.set_value("test/transaction/bool", true);
+
+  int32_t ivalue{0};
+  this->configurator->get_value("test/transaction/int32", ivalue);
+  EXPECT_EQ(ivalue, 1040);
+  EXPECT_TRUE(section.batches.empty());
+
+  transaction.commit();
+  EXPECT_TRUE(transaction.empty());
+
+  this->configurator->get_value("test/transaction/int32", ivalue);
+  EXPECT_EQ(ivalue, 1042);
+
+  // One notification with both changed keys in the section, none for the unchanged string.
+  const std::vector<std::vector<std::string>> batches{{"test/transaction/bool", "test/transaction/int32"}};
+  EXPECT_EQ(section.batches, batches);
+  EXPECT_TRUE(section.keys.empty());
+  EXPECT_TRUE(string.batches.empty());
+
+  // The commit saved the values.
+  this->configurator->set_value("test/transaction/int32", 1043);
+  this->configurator->load("temp-transaction");
+  this->configurator->get_value("test/transaction/int32", ivalue);
+  EXPECT_EQ(ivalue, 1042);
+
+  this->configurator->remove_listener(&section);
+  this->configurator->remove_listener(&string);
+}
+
+//! Without an override, each key of a transaction reaches config_changed_notify().
+TYPED_TEST(ConfigFileTest, test_configurator_transaction_default_notify)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  class Listener : public IConfiguratorListener
+  {
+  public:
+    void config_changed_notify(const std::string &key) override
+    {
+      keys.push_back(key);
+    }
+
+    std::vector<std::string> keys;
+  };
+
+  Listener listener;
+  this->configurator->add_listener("test/transaction", &listener);
+
+  ConfigTransaction transaction(this->configurator);
+  transaction.set_value("test/transaction/string", "1047");
+  transaction.set_value("test/transaction/int32", 1047);
+  transaction.commit();
+
+  const std::vector<std::string> keys{"test/transaction/int32", "test/transaction/string"};
+  EXPECT_EQ(listener.keys, keys);
+
+  this->configurator->remove_listener(&listener);
+}
+
+//! A backend that reports changes itself reports a transaction too, which must not be announced twice.
+TEST_F(ConfigMonitoringTest, test_configurator_transaction_echoes)
+{
+  auto *backend = new EchoingConfigurator();
+  configurator = std::make_shared<Configurator>(backend);
+
+  TransactionListener listener;
+  configurator->add_listener("test/echo", &listener);
+
+  configurator->set_value("test/echo/int32", 1050);
+  EXPECT_EQ(listener.keys, std::vector<std::string>{"test/echo/int32"});
+
+  ConfigTransaction transaction(configurator);
+  transaction.set_value("test/echo/int32", 1051);
+  transaction.set_value("test/echo/string", "1051");
+  transaction.commit();
+
+  const std::vector<std::vector<std::string>> batches{{"test/echo/int32", "test/echo/string"}};
+  EXPECT_EQ(listener.batches, batches);
+  EXPECT_EQ(listener.keys.size(), 1U);
+
+  // Changes made elsewhere afterwards are reported as usual.
+  backend->set_value("test/echo/int32", 1052);
+  const std::vector<std::string> keys{"test/echo/int32", "test/echo/int32"};
+  EXPECT_EQ(listener.keys, keys);
+
+  configurator->remove_listener(&listener);
+}
+
+TYPED_TEST(ConfigFileTest, test_configurator_transaction_delay)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  this->configurator->set_value("test/transaction/int32", 1044);
+  this->configurator->set_delay("test/transaction/int32", 5);
+  this->configurator->set_value("test/transaction/int32", 1045);
+
+  // The transaction is not delayed, and replaces the pending value.
+  ConfigTransaction transaction(this->configurator);
+  transaction.set_value("test/transaction/int32", 1046);
+  transaction.commit();
+
+  int32_t value{0};
+  this->configurator->get_value("test/transaction/int32", value);
+  EXPECT_EQ(value, 1046);
+  EXPECT_EQ(this->configurator->get_next_heartbeat_time(), 0);
+
+  this->tick(6, [&](int) {
+    this->configurator->get_value("test/transaction/int32", value);
+    EXPECT_EQ(value, 1046);
+  });
+}
+
+TYPED_TEST(ConfigFileTest, test_configurator_save_writes_changes_only)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  auto *backend = new T();
+  this->configurator = std::make_shared<Configurator>(backend);
+
+  std::filesystem::remove("temp-writer");
+  this->configurator->load("temp-writer");
+  this->configurator->set_value("test/writer/int32", 1050);
+  this->configurator->set_value("test/writer/string", "1050");
+  this->configurator->save();
+  EXPECT_EQ(backend->get_write_stats().writes, 1);
+  EXPECT_EQ(backend->get_write_stats().bytes, std::filesystem::file_size("temp-writer"));
+  EXPECT_FALSE(std::filesystem::exists("temp-writer.tmp"));
+
+  // Nothing changed, or only to the same value.
+  this->configurator->save();
+  this->configurator->set_value("test/writer/int32", 1050);
+  this->configurator->save();
+  EXPECT_EQ(backend->get_write_stats().writes, 1);
+  EXPECT_EQ(backend->get_write_stats().skipped, 2);
+
+  this->configurator->remove_key("test/writer/string");
+  this->configurator->save();
+  EXPECT_EQ(backend->get_write_stats().writes, 2);
+
+  this->configurator->set_value("test/writer/int32", 1051);
+  this->configurator->save();
+  EXPECT_EQ(backend->get_write_stats().writes, 3);
+
+  // Loading discards the changes since the last save, and leaves nothing to save.
+  this->configurator->set_value("test/writer/int32", 1052);
+  this->configurator->load("temp-writer");
+  this->configurator->save();
+  EXPECT_EQ(backend->get_write_stats().writes, 3);
+
+  int32_t value{0};
+  EXPECT_TRUE(this->configurator->get_value("test/writer/int32", value));
+  EXPECT_EQ(value, 1051);
+  std::string svalue;
+  EXPECT_FALSE(this->configurator->get_value("test/writer/string", svalue));
+}
+
 #if defined(HAVE_GSETTINGS)
 TYPED_TEST(ConfigNonFileTest, test_configurator_dummy_save_load)
 {
@@ -1929,6 +2306,110 @@ TYPED_TEST(ConfigTest, test_settings_string_default)
   EXPECT_EQ(this->setting_string_default().get(), "1037");
 };
 
+TYPED_TEST(ConfigTest, test_settings_cached)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  auto &setting = this->setting_int32_default();
+  setting.set_cached(true);
+
+  setting.set(1055);
+  EXPECT_EQ(setting(), 1055);
+
+  this->configurator->set_value("test/settings/default/int32", 1056);
+  EXPECT_EQ(setting(), 1056);
+
+  // A delayed value is visible at once, although listeners only hear of it later.
+  this->configurator->set_delay("test/settings/default/int32", 5);
+  this->configurator->set_value("test/settings/default/int32", 1057);
+  EXPECT_EQ(setting(), 1057);
+  this->tick(6, [](int) {});
+  EXPECT_EQ(setting(), 1057);
+
+  if (this->can_remove)
+    {
+      int32_t value{0};
+      this->configurator->remove_key("test/settings/default/int32");
+      this->configurator->get_value_with_default("test/settings/default/int32", value, 8888);
+      EXPECT_EQ(setting(), value);
+    }
+};
+
+TYPED_TEST(ConfigTest, test_settings_cached_connect)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  auto &setting = this->setting_int32();
+  setting.set_cached(true);
+  setting.set(1058);
+  EXPECT_EQ(setting(), 1058);
+
+  int fired = 0;
+  auto connection = setting.connect(this, [&](int32_t value) {
+    EXPECT_EQ(value, 1059);
+    EXPECT_EQ(setting(), 1059);
+    fired++;
+  });
+
+  setting.set(1059);
+  EXPECT_EQ(fired, 1);
+  connection.disconnect();
+};
+
+TYPED_TEST(ConfigTest, test_settings_key)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  static constinit SettingKey key{"test/settings/int32"};
+  static const SettingKey runtime_key{std::string("test/settings/") + "int32"};
+
+  auto &setting = SettingCache::get<int32_t>(this->configurator, key);
+  EXPECT_EQ(&setting, &this->setting_int32());
+  EXPECT_EQ(&setting, &SettingCache::get<int32_t>(this->configurator, runtime_key));
+  EXPECT_EQ(key.slot(), runtime_key.slot());
+
+  setting.set(1060);
+  EXPECT_EQ(SettingCache::get<int32_t>(this->configurator, key)(), 1060);
+
+  static constinit SettingKey group_key{"test/settings"};
+  EXPECT_EQ(&SettingCache::group(this->configurator, group_key), &this->group());
+};
+
+TYPED_TEST(ConfigTest, test_settings_key_threads)
+{
+  using T = TypeParam;
+  this->template init<T>();
+
+  // A key per thread, so that each one interns the name for itself.
+  constexpr int thread_count = 8;
+  std::vector<std::unique_ptr<SettingKey>> keys;
+  for (int i = 0; i < thread_count; i++)
+    {
+      keys.push_back(std::make_unique<SettingKey>(std::string("test/settings/threads/") + std::to_string(i % 2)));
+    }
+
+  std::array<Setting<int32_t> *, thread_count> settings{};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < thread_count; i++)
+    {
+      threads.emplace_back([&, i] { settings[i] = &SettingCache::get<int32_t>(this->configurator, *keys[i], 1061); });
+    }
+  for (auto &thread: threads)
+    {
+      thread.join();
+    }
+
+  for (int i = 0; i < thread_count; i++)
+    {
+      EXPECT_EQ(settings[i], settings[i % 2]);
+      EXPECT_EQ(settings[i]->key(), "test/settings/threads/" + std::to_string(i % 2));
+    }
+  EXPECT_NE(settings[0], settings[1]);
+};
+
 TYPED_TEST(ConfigTest, test_settings_connect)
 {
   using T = TypeParam;
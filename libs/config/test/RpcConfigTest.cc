@@ -51,14 +51,11 @@ namespace
       : configurator(new IniConfigurator())
       , impl(configurator)
     {
-      rpc::ServerConfig config;
-      config.listen_address = "127.0.0.1:0";
-      rpc_server = std::make_unique<rpc::RpcServer>(config);
+      rpc_server = std::make_unique<rpc::RpcServer>(rpc::ServerConfig{});
       rpc_server->register_service(impl);
       rpc_server->start();
 
-      auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(rpc_server->bound_port()),
-                                         grpc::InsecureChannelCredentials());
+      auto channel = rpc_server->in_process_channel();
       stub = workrave::rpc::ConfigService::NewStub(channel);
     }
 
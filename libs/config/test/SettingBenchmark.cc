@@ -0,0 +1,122 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Reads the same settings over and over, as the core and the GUI do on
+// every heartbeat, with and without Setting's value cache, and looks them
+// up in the SettingCache by name and by SettingKey. Not part of the test
+// suite; run by hand:
+//
+//   workrave-config-setting-benchmark [reads]
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "Configurator.hh"
+#include "IniConfigurator.hh"
+#include "config/SettingCache.hh"
+
+using namespace workrave::config;
+
+namespace
+{
+  template<typename Setting>
+  void
+  measure(const std::string &name, Setting &setting, int reads)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < reads; i++)
+      {
+        // get_generation() and the backend are behind virtual calls, so
+        // neither variant can be optimized away.
+        (void)setting();
+      }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "  " << name << ": " << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / reads
+              << " ns/read" << std::endl;
+  }
+
+  template<typename Lookup>
+  void
+  measure_lookup(const std::string &name, Lookup lookup, int reads)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < reads; i++)
+      {
+        // Both lookups end in the cache's translation unit and cannot be
+        // optimized away.
+        (void)lookup();
+      }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "  " << name << ": " << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / reads
+              << " ns/lookup" << std::endl;
+  }
+
+  template<typename Backend>
+  void
+  run(const std::string &backend_name, int reads)
+  {
+    std::cout << backend_name << std::endl;
+
+    for (bool cached: {false, true})
+      {
+        SettingCache::reset();
+        auto configurator = std::make_shared<Configurator>(new Backend());
+        configurator->set_value("timers/micro_pause/limit", 180);
+        configurator->set_value("timers/rest_break/reset_pred", std::string("day/4:00"));
+
+        auto &limit = SettingCache::get<int>(configurator, "timers/micro_pause/limit");
+        auto &reset_pred = SettingCache::get<std::string>(configurator, "timers/rest_break/reset_pred");
+        limit.set_cached(cached);
+        reset_pred.set_cached(cached);
+
+        const std::string mode = cached ? "cached" : "uncached";
+        measure("Setting<int> " + mode, limit, reads);
+        measure("Setting<std::string> " + mode, reset_pred, reads);
+      }
+
+    auto configurator = std::make_shared<Configurator>(new Backend());
+    static constinit SettingKey key{"timers/micro_pause/limit"};
+    const std::string name = "timers/micro_pause/limit";
+    measure_lookup("SettingCache::get by name", [&]() -> auto & { return SettingCache::get<int>(configurator, name); }, reads);
+    measure_lookup("SettingCache::get by key", [&]() -> auto & { return SettingCache::get<int>(configurator, key); }, reads);
+    SettingCache::reset();
+  }
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  const int reads = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+  if (reads <= 0)
+    {
+      std::cerr << "usage: " << argv[0] << " [reads]" << std::endl;
+      return 1;
+    }
+
+  run<IniConfigurator>("ini", reads);
+  return 0;
+}
@@ -0,0 +1,82 @@
+/* Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Layout of the timer status segment: a small file under $XDG_RUNTIME_DIR
+ * that the core maps read-write and rewrites on every heartbeat, and that
+ * applets and other local readers map read-only. While no timer is running,
+ * heartbeats can be minutes apart; `updated` tells how old the data is.
+ *
+ * The writer increments `sequence` before and after each update, so it is odd
+ * while an update is in progress. A reader copies `data` and accepts the copy
+ * only if `sequence` was even and unchanged around it.
+ *
+ * Plain C so that the applets can include it; all fields have fixed widths and
+ * natural alignment. Any change to the layout must bump the version.
+ */
+
+#ifndef WORKRAVE_CORE_TIMERSTATUS_H
+#define WORKRAVE_CORE_TIMERSTATUS_H
+
+#include <stdint.h>
+
+#define WORKRAVE_TIMER_STATUS_MAGIC 0x53545257u /* "WRTS" */
+#define WORKRAVE_TIMER_STATUS_VERSION 1u
+#define WORKRAVE_TIMER_STATUS_FILENAME "workrave-timers"
+
+/* Indexed by BreakId: micro break, rest break, daily limit. */
+#define WORKRAVE_TIMER_STATUS_BREAKS 3
+
+/* Matches BreakStage in the core. */
+typedef enum WorkraveTimerStatusState
+{
+  WORKRAVE_TIMER_STATUS_STATE_NONE = 0,
+  WORKRAVE_TIMER_STATUS_STATE_SNOOZED,
+  WORKRAVE_TIMER_STATUS_STATE_PRELUDE,
+  WORKRAVE_TIMER_STATUS_STATE_TAKING,
+  WORKRAVE_TIMER_STATUS_STATE_DELAYED,
+} WorkraveTimerStatusState;
+
+#define WORKRAVE_TIMER_STATUS_FLAG_ENABLED 0x1u
+#define WORKRAVE_TIMER_STATUS_FLAG_RUNNING 0x2u
+
+typedef struct WorkraveTimerStatusBreak
+{
+  int64_t elapsed; /* active time in seconds */
+  int64_t limit;   /* seconds; -1 if the break has no limit */
+  int64_t idle;    /* idle time in seconds */
+  int32_t state;   /* WorkraveTimerStatusState */
+  uint32_t flags;  /* WORKRAVE_TIMER_STATUS_FLAG_* */
+} WorkraveTimerStatusBreak;
+
+typedef struct WorkraveTimerStatusData
+{
+  int64_t updated;        /* wall-clock time of the heartbeat, in seconds; 0 once the core has exited */
+  int32_t operation_mode; /* OperationMode: normal, suspended, quiet */
+  uint32_t reserved;
+  WorkraveTimerStatusBreak breaks[WORKRAVE_TIMER_STATUS_BREAKS];
+} WorkraveTimerStatusData;
+
+typedef struct WorkraveTimerStatusSegment
+{
+  uint32_t magic;    /* written last when the segment is created */
+  uint32_t version;  /* WORKRAVE_TIMER_STATUS_VERSION */
+  uint32_t size;     /* sizeof(WorkraveTimerStatusSegment) */
+  uint32_t sequence; /* odd while the writer updates data */
+  WorkraveTimerStatusData data;
+} WorkraveTimerStatusSegment;
+
+#endif /* WORKRAVE_CORE_TIMERSTATUS_H */
@@ -754,6 +754,29 @@ namespace workrave::core_shadow
       }
   }
 
+  std::chrono::milliseconds CoreShadowProxy::get_next_heartbeat_delay()
+  {
+    const std::chrono::milliseconds delay = live_core->get_next_heartbeat_delay();
+
+    // The classic core in the helper needs a heartbeat every second, or it sees a time warp.
+    return shadow_available ? std::min(delay, std::chrono::milliseconds{1000}) : delay;
+  }
+
+  boost::signals2::signal<void()> &CoreShadowProxy::signal_heartbeat_needed()
+  {
+    return live_core->signal_heartbeat_needed();
+  }
+
+  void CoreShadowProxy::dispatch_rpc_calls()
+  {
+    live_core->dispatch_rpc_calls();
+  }
+
+  boost::signals2::signal<void()> &CoreShadowProxy::signal_rpc_calls_pending()
+  {
+    return live_core->signal_rpc_calls_pending();
+  }
+
   void CoreShadowProxy::force_break(BreakId id, workrave::utils::Flags<BreakHint> break_hint)
   {
     live_core->force_break(id, break_hint);
@@ -773,6 +796,10 @@ namespace workrave::core_shadow
   {
     return live_core->is_user_active();
   }
+  ICore::InputStatistics CoreShadowProxy::get_input_statistics() const
+  {
+    return live_core->get_input_statistics();
+  }
   bool CoreShadowProxy::is_taking() const
   {
     return live_core->is_taking();
@@ -933,6 +960,11 @@ namespace workrave::core_shadow
 #if defined(HAVE_GRPC)
   void CoreShadowProxy::intercept_rpc_request(const rpc::RequestInfo &request)
   {
+    if (!request.status.ok())
+      {
+        return;
+      }
+
     try
       {
         if (auto command = rpc_shadow_command(request))
@@ -131,10 +131,15 @@ namespace workrave::core_shadow
 
     void init(workrave::IApp *app, const char *display) override;
     void heartbeat() override;
+    [[nodiscard]] std::chrono::milliseconds get_next_heartbeat_delay() override;
+    boost::signals2::signal<void()> &signal_heartbeat_needed() override;
+    void dispatch_rpc_calls() override;
+    boost::signals2::signal<void()> &signal_rpc_calls_pending() override;
     void force_break(BreakId id, workrave::utils::Flags<BreakHint> break_hint) override;
     [[nodiscard]] IBreak::Ptr get_break(BreakId id) const override;
     [[nodiscard]] workrave::stats::IStatistics::Ptr get_statistics() const override;
     [[nodiscard]] bool is_user_active() const override;
+    [[nodiscard]] InputStatistics get_input_statistics() const override;
     [[nodiscard]] bool is_taking() const override;
     [[nodiscard]] OperationMode get_active_operation_mode() override;
     [[nodiscard]] OperationMode get_regular_operation_mode() override;
@@ -47,9 +47,21 @@ namespace workrave
     //! Initialize the Core. Must be called first.
     virtual void init(int argc, char **argv, IApp *app, const char *display) = 0;
 
-    //! Periodic heartbeat. The GUI *MUST* call this method every second.
+    //! Periodic heartbeat. The GUI *MUST* call this method again within get_next_heartbeat_delay().
     virtual void heartbeat() = 0;
 
+    //! Returns how long the GUI may wait before the next heartbeat.
+    [[nodiscard]] virtual std::chrono::milliseconds get_next_heartbeat_delay() = 0;
+
+    //! Emitted, possibly from another thread, when a heartbeat is needed before that delay has passed.
+    virtual boost::signals2::signal<void()> &signal_heartbeat_needed() = 0;
+
+    //! Runs the RPC calls waiting for the main loop. Main thread only.
+    virtual void dispatch_rpc_calls() = 0;
+
+    //! Emitted, possibly from another thread, when RPC calls are waiting for dispatch_rpc_calls().
+    virtual boost::signals2::signal<void()> &signal_rpc_calls_pending() = 0;
+
     //! Force a break of the specified type.
     virtual void force_break(BreakId id, workrave::utils::Flags<BreakHint> break_hint) = 0;
 
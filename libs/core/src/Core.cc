@@ -32,6 +32,9 @@
 #include <sstream>
 #include <filesystem>
 #include <chrono>
+#include <optional>
+#include <vector>
+#include <system_error>
 
 #include <spdlog/spdlog.h>
 
@@ -54,6 +57,7 @@
 #include "input-monitor/InputMonitorFactory.hh"
 #include "utils/AssetPath.hh"
 #include "utils/Paths.hh"
+#include "utils/SnapshotFile.hh"
 
 #if defined(HAVE_TESTS)
 #  include "Test.hh"
@@ -69,6 +73,7 @@ Core *Core::instance = nullptr;
 workrave::config::IConfigurator::Ptr Core::configurator = nullptr;
 
 const char *WORKRAVESTATE = "WorkRaveState";
+const char *STATE_SNAPSHOT = "state.bin";
 const int SAVESTATETIME = 60;
 
 #define DBUS_PATH_WORKRAVE "/org/workrave/Workrave/Core"
@@ -79,6 +84,56 @@ using namespace workrave::config;
 using namespace workrave::stats;
 using namespace std;
 
+//! The snapshot record that holds the state of the timer named id.
+static SnapshotFile::Record
+to_snapshot_record(const std::string &id, const Timer::SavedState &state)
+{
+  return SnapshotFile::Record{id,
+                              {state.save_time,
+                               state.elapsed,
+                               state.last_reset,
+                               state.overdue,
+                               state.snooze_inhibited ? 1 : 0,
+                               state.last_limit_time,
+                               state.last_limit_elapsed,
+                               state.timezone}};
+}
+
+//! The timer state held by a snapshot record, or nullopt if the record is too short.
+static std::optional<Timer::SavedState>
+to_saved_state(const SnapshotFile::Record &record)
+{
+  if (record.values.size() < 8)
+    {
+      return std::nullopt;
+    }
+
+  Timer::SavedState state;
+  state.save_time = record.values[0];
+  state.elapsed = record.values[1];
+  state.last_reset = record.values[2];
+  state.overdue = record.values[3];
+  state.snooze_inhibited = record.values[4] != 0;
+  state.last_limit_time = record.values[5];
+  state.last_limit_elapsed = record.values[6];
+  state.timezone = record.values[7];
+  return state;
+}
+
+//! Whether the text state file was written after the snapshot, by an older Workrave.
+static bool
+is_text_state_newer(const std::filesystem::path &text_path, const std::filesystem::path &snapshot_path)
+{
+  std::error_code ec;
+  const auto text_time = std::filesystem::last_write_time(text_path, ec);
+  if (ec)
+    {
+      return false;
+    }
+  const auto snapshot_time = std::filesystem::last_write_time(snapshot_path, ec);
+  return ec || text_time > snapshot_time;
+}
+
 ICore::Ptr
 CoreFactory::create(workrave::config::IConfigurator::Ptr configurator)
 {
@@ -988,6 +1043,39 @@ Core::process_distribution()
   master_node = true;
 }
 
+//! Returns how long the GUI may wait before the next heartbeat.
+/*!
+ *  Always a second: the time warp detection in process_timewarp() relies on
+ *  seeing every second.
+ */
+std::chrono::milliseconds
+Core::get_next_heartbeat_delay()
+{
+  return std::chrono::milliseconds{1000};
+}
+
+boost::signals2::signal<void()> &
+Core::signal_heartbeat_needed()
+{
+  return heartbeat_needed_signal;
+}
+
+//! Runs the RPC calls waiting for the main loop.
+/*!
+ *  Nothing to do: the gRPC services of this core run their calls directly
+ *  on the gRPC threads.
+ */
+void
+Core::dispatch_rpc_calls()
+{
+}
+
+boost::signals2::signal<void()> &
+Core::signal_rpc_calls_pending()
+{
+  return rpc_calls_pending_signal;
+}
+
 //! Computes the current state.
 void
 Core::process_state()
@@ -1447,22 +1535,14 @@ Core::daily_reset()
 void
 Core::save_state() const
 {
-  std::filesystem::path path = Paths::get_state_directory() / "state";
-  std::filesystem::path tmp_path = std::filesystem::path(path) += ".tmp";
-  ofstream stateFile(tmp_path.string());
-
-  int64_t current_time = TimeSource::get_real_time_sec();
-  stateFile << "WorkRaveState 3" << endl << current_time << endl;
-
+  std::vector<SnapshotFile::Record> records;
+  records.reserve(BREAK_ID_SIZEOF);
   for (int i = 0; i < BREAK_ID_SIZEOF; i++)
     {
-      string stateStr = breaks[i].get_timer()->serialize_state();
-
-      stateFile << stateStr << endl;
+      records.push_back(to_snapshot_record(breaks[i].get_timer()->get_id(), breaks[i].get_timer()->get_saved_state()));
     }
 
-  stateFile.close();
-  std::filesystem::rename(tmp_path, path);
+  SnapshotFile::write(Paths::get_state_directory() / STATE_SNAPSHOT, records);
 }
 
 //! Loads miscellaneous
@@ -1491,8 +1571,6 @@ Core::load_misc()
 void
 Core::load_state()
 {
-  std::filesystem::path path = Paths::get_state_directory() / "state";
-
 #if defined(HAVE_TESTS)
   if (hooks->hook_load_timer_state())
     {
@@ -1508,6 +1586,48 @@ Core::load_state()
     }
 #endif
 
+  if (!load_snapshot_state())
+    {
+      load_text_state();
+    }
+}
+
+//! Loads the binary state snapshot. Returns false if there is none to use.
+bool
+Core::load_snapshot_state()
+{
+  const std::filesystem::path path = Paths::get_state_directory() / STATE_SNAPSHOT;
+  if (is_text_state_newer(Paths::get_state_directory() / "state", path))
+    {
+      return false;
+    }
+
+  const std::optional<std::vector<SnapshotFile::Record>> records = SnapshotFile::read(path);
+  if (!records.has_value())
+    {
+      return false;
+    }
+
+  for (const SnapshotFile::Record &record: records.value())
+    {
+      const std::optional<Timer::SavedState> state = to_saved_state(record);
+      for (int i = 0; state.has_value() && i < BREAK_ID_SIZEOF; i++)
+        {
+          if (breaks[i].get_timer()->get_id() == record.id)
+            {
+              breaks[i].get_timer()->restore_saved_state(state.value());
+              break;
+            }
+        }
+    }
+  return true;
+}
+
+//! Loads the text state file of older versions of Workrave.
+void
+Core::load_text_state()
+{
+  std::filesystem::path path = Paths::get_state_directory() / "state";
   ifstream stateFile(path.string());
 
   int version = 0;
@@ -170,6 +170,10 @@ private:
   void load_monitor_config();
   void config_changed_notify(const std::string &key) override;
   void heartbeat() override;
+  std::chrono::milliseconds get_next_heartbeat_delay() override;
+  boost::signals2::signal<void()> &signal_heartbeat_needed() override;
+  void dispatch_rpc_calls() override;
+  boost::signals2::signal<void()> &signal_rpc_calls_pending() override;
   void timer_action(BreakId id, TimerInfo info);
   void process_distribution();
   void process_state();
@@ -180,6 +184,8 @@ private:
   void daily_reset();
   void save_state() const;
   void load_state();
+  bool load_snapshot_state();
+  void load_text_state();
   void load_misc();
   void do_postpone_break(BreakId break_id);
   void do_skip_break(BreakId break_id);
@@ -275,6 +281,12 @@ private:
   //! Usage mode changed notification.
   boost::signals2::signal<void(workrave::UsageMode)> usage_mode_changed_signal;
 
+  //! Heartbeat needed notification; never fired, see get_next_heartbeat_delay().
+  boost::signals2::signal<void()> heartbeat_needed_signal;
+
+  //! RPC calls pending notification; never fired, see dispatch_rpc_calls().
+  boost::signals2::signal<void()> rpc_calls_pending_signal;
+
 #if defined(HAVE_TESTS)
   friend class Test;
 #endif
@@ -279,6 +279,13 @@ LocalActivityMonitor::keyboard_notify(bool repeat)
   lock.unlock();
 }
 
+//! This monitor never enables coalescing.
+bool
+LocalActivityMonitor::is_motion_coalescable()
+{
+  return false;
+}
+
 //! Calls the callback listener.
 void
 LocalActivityMonitor::call_listener()
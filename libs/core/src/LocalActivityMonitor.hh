@@ -57,6 +57,7 @@ public:
   void mouse_notify(int x, int y, int wheel = 0) override;
   void button_notify(bool is_press) override;
   void keyboard_notify(bool repeat) override;
+  bool is_motion_coalescable() override;
 
 private:
   void call_listener();
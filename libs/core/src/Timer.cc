@@ -797,19 +797,31 @@ Timer::process(ActivityState new_activity_state, TimerInfo &info)
     }
 }
 
+Timer::SavedState
+Timer::get_saved_state() const
+{
+  SavedState state;
+  state.save_time = TimeSource::get_real_time_sec_sync();
+  state.elapsed = get_elapsed_time();
+  state.last_reset = last_pred_reset_time;
+  state.overdue = total_overdue_time;
+  state.snooze_inhibited = snooze_inhibited;
+  state.last_limit_time = last_limit_time;
+  state.last_limit_elapsed = last_limit_elapsed;
+#if !defined(PLATFORM_OS_WINDOWS_NATIVE) // FIXME:
+  state.timezone = timezone;
+#endif
+  return state;
+}
+
 std::string
 Timer::serialize_state() const
 {
-  stringstream ss;
-
-  ss << timer_id << " " << TimeSource::get_real_time_sec_sync() << " " << get_elapsed_time() << " " << last_pred_reset_time << " "
-     << total_overdue_time << " " << snooze_inhibited << " " << last_limit_time << " " << last_limit_elapsed << " "
+  const SavedState state = get_saved_state();
 
-#if defined(PLATFORM_OS_WINDOWS_NATIVE) // FIXME:
-     << 0;
-#else
-     << timezone;
-#endif
+  stringstream ss;
+  ss << timer_id << " " << state.save_time << " " << state.elapsed << " " << state.last_reset << " " << state.overdue << " "
+     << state.snooze_inhibited << " " << state.last_limit_time << " " << state.last_limit_elapsed << " " << state.timezone;
 
   return ss.str();
 }
@@ -817,47 +829,45 @@ Timer::serialize_state() const
 bool
 Timer::deserialize_state(const std::string &state, int version)
 {
-  TRACE_ENTRY();
   istringstream ss(state);
 
-  int64_t saveTime = 0;
-  int64_t elapsed = 0;
-  int64_t lastReset = 0;
-  int64_t overdue = 0;
-  int64_t now = TimeSource::get_real_time_sec_sync();
-  int64_t llt = 0;
-  int64_t lle = 0;
-  int64_t tz = 0;
-  bool si = false;
-
-  ss >> saveTime >> elapsed >> lastReset >> overdue >> si >> llt >> lle;
+  SavedState saved;
+  ss >> saved.save_time >> saved.elapsed >> saved.last_reset >> saved.overdue >> saved.snooze_inhibited >> saved.last_limit_time
+    >> saved.last_limit_elapsed;
 
   if (version == 3)
     {
-      ss >> tz;
-#if !defined(PLATFORM_OS_WINDOWS_NATIVE) // FIXME:
-      tz -= timezone;
-#endif
+      ss >> saved.timezone;
     }
 
+  restore_saved_state(saved);
+  return true;
+}
+
+void
+Timer::restore_saved_state(const SavedState &state)
+{
+  TRACE_ENTRY();
+
+  int64_t now = TimeSource::get_real_time_sec_sync();
+  int64_t lastReset = state.last_reset;
+
   // Sanity check...
-  if (lastReset > saveTime)
+  if (lastReset > state.save_time)
     {
-      lastReset = saveTime;
+      lastReset = state.save_time;
     }
 
-  // lastReset -= tz;
-
-  TRACE_VAR(si, llt, lle);
+  TRACE_VAR(state.snooze_inhibited, state.last_limit_time, state.last_limit_elapsed);
   TRACE_VAR(snooze_inhibited);
 
   last_pred_reset_time = lastReset;
-  total_overdue_time = overdue;
+  total_overdue_time = state.overdue;
   elapsed_time = 0;
   last_start_time = 0;
   last_stop_time = 0;
 
-  bool tooOld = ((autoreset_enabled && autoreset_interval != 0) && (now - saveTime > autoreset_interval));
+  bool tooOld = ((autoreset_enabled && autoreset_interval != 0) && (now - state.save_time > autoreset_interval));
 
   if (!tooOld)
     {
@@ -865,15 +875,15 @@ Timer::deserialize_state(const std::string &state, int version)
         {
           next_reset_time = now + autoreset_interval;
         }
-      elapsed_time = elapsed;
-      snooze_inhibited = si;
+      elapsed_time = state.elapsed;
+      snooze_inhibited = state.snooze_inhibited;
     }
 
   // overdue, so snooze
   if (limit_enabled && get_elapsed_time() >= limit_interval)
     {
-      last_limit_time = llt;
-      last_limit_elapsed = lle;
+      last_limit_time = state.last_limit_time;
+      last_limit_elapsed = state.last_limit_elapsed;
 
       compute_next_limit_time();
     }
@@ -881,7 +891,6 @@ Timer::deserialize_state(const std::string &state, int version)
   compute_next_predicate_reset_time();
 
   TRACE_MSG("elapsed = {}", elapsed_time);
-  return true;
 }
 
 void
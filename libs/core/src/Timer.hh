@@ -18,6 +18,7 @@
 #ifndef TIMER_HH
 #define TIMER_HH
 
+#include <cstdint>
 #include <ctime>
 #include <string>
 #include <list>
@@ -164,7 +165,22 @@ public:
   // Timer ID
   std::string get_id() const;
 
+  //! What a timer keeps across restarts.
+  struct SavedState
+  {
+    int64_t save_time{0};
+    int64_t elapsed{0};
+    int64_t last_reset{0};
+    int64_t overdue{0};
+    bool snooze_inhibited{false};
+    int64_t last_limit_time{0};
+    int64_t last_limit_elapsed{0};
+    int64_t timezone{0};
+  };
+
   // State serialization.
+  SavedState get_saved_state() const;
+  void restore_saved_state(const SavedState &state);
   std::string serialize_state() const;
   bool deserialize_state(const std::string &state, int version);
   void set_state(int elapsed, int idle, int overdue = -1);
@@ -9,13 +9,14 @@
 #include "rpc/InstanceRegistry.hh"
 
 
-#include "rpc/EventQueue.hh"
+#include "rpc/EventBroadcaster.hh"
 
+#include "rpc/Executor.hh"
 
 
 namespace workrave::core::rpc
 {
-class BreakService final : public ::workrave::rpc::BreakService::Service
+class BreakService final : public ::workrave::rpc::BreakService::WithCallbackMethod_BreakEvent<::workrave::rpc::BreakService::WithCallbackMethod_BreakStateChanged<::workrave::rpc::BreakService::Service>>
 {
 public:
 
@@ -23,7 +24,8 @@ public:
   // registry that instances register themselves into (see rpc::InstanceRegistry),
   // and each RPC resolves its target from the request's `id` field — the gRPC
   // analog of DBus's per-object-path routing.
-  explicit BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &registry);
+  explicit BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &registry,
+                        ::rpc::Executor &executor = ::rpc::Executor::inline_executor());
 
 
 
@@ -97,18 +99,22 @@ public:
 
 
 
-  ::grpc::Status BreakEvent(::grpc::ServerContext *context,
-                                 const ::workrave::breaks::BreakEventRequest *request,
-                                 ::grpc::ServerWriter<::workrave::breaks::BreakEventEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::breaks::BreakEventEvent> *BreakEvent(::grpc::CallbackServerContext *context,
+                                 const ::workrave::breaks::BreakEventRequest *request) override;
 
-  ::grpc::Status BreakStateChanged(::grpc::ServerContext *context,
-                                 const ::workrave::breaks::BreakStateChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::breaks::BreakStateChangedEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::breaks::BreakStateChangedEvent> *BreakStateChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::breaks::BreakStateChangedRequest *request) override;
 
 
 private:
 
   ::rpc::InstanceRegistry<workrave::BreakId, Break> &registry_;
+  ::rpc::Executor &executor_;
+
+
+  ::rpc::KeyedEventBroadcaster<workrave::BreakId, ::workrave::breaks::BreakEventEvent> signal_break_event_broadcaster_;
+
+  ::rpc::KeyedEventBroadcaster<workrave::BreakId, ::workrave::breaks::BreakStateChangedEvent> signal_break_stage_changed_broadcaster_;
 
 
   [[maybe_unused]] const void *const service_descriptor_anchor_;
@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcCoreServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 #include "rpc/Duration.hh"
@@ -15,8 +17,9 @@ namespace workrave::core::rpc
 {
 
 
-CoreService::CoreService(Core &impl)
+CoreService::CoreService(Core &impl, ::rpc::Executor &executor)
   : impl_(impl)
+  , executor_(executor)
   , service_descriptor_anchor_(&::descriptor_table_RpcCore_2eproto)
 {
 }
@@ -27,24 +30,31 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::IsActiveRequest *request,
                                                             ::workrave::core::IsActiveResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "IsActive");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.is_user_active();
+      auto rpc_result = executor_.run([&] { return impl_.is_user_active(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "IsActive", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "IsActive", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -52,24 +62,31 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::IsTakingRequest *request,
                                                             ::workrave::core::IsTakingResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "IsTaking");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.is_taking();
+      auto rpc_result = executor_.run([&] { return impl_.is_taking(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "IsTaking", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "IsTaking", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -77,6 +94,9 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::ForceBreakRequest *request,
                                                             ::workrave::core::ForceBreakResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "ForceBreak");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -86,16 +106,20 @@ CoreService::CoreService(Core &impl)
       for (int i = 0; i < request->break_hint_size(); ++i) { local_break_hint |= static_cast<workrave::BreakHint>(request->break_hint(i)); }
 
 
-      impl_.force_break(static_cast<workrave::BreakId>(request->id()), local_break_hint);
+      executor_.run([&] { impl_.force_break(static_cast<workrave::BreakId>(request->id()), local_break_hint); });
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "ForceBreak", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "ForceBreak", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -103,24 +127,31 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::GetActiveOperationModeRequest *request,
                                                             ::workrave::core::GetActiveOperationModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "GetActiveOperationMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.get_active_operation_mode();
+      auto rpc_result = executor_.run([&] { return impl_.get_active_operation_mode(); });
 
       response->set_result(static_cast<::workrave::core::OperationMode>(rpc_result));
 
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "GetActiveOperationMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "GetActiveOperationMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -128,24 +159,31 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::GetOperationModeRequest *request,
                                                             ::workrave::core::GetOperationModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "GetOperationMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.get_regular_operation_mode();
+      auto rpc_result = executor_.run([&] { return impl_.get_regular_operation_mode(); });
 
       response->set_result(static_cast<::workrave::core::OperationMode>(rpc_result));
 
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "GetOperationMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "GetOperationMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -153,24 +191,31 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::IsOperationModeAnOverrideRequest *request,
                                                             ::workrave::core::IsOperationModeAnOverrideResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "IsOperationModeAnOverride");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.is_operation_mode_an_override();
+      auto rpc_result = executor_.run([&] { return impl_.is_operation_mode_an_override(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "IsOperationModeAnOverride", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "IsOperationModeAnOverride", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -178,21 +223,28 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::SetOperationModeRequest *request,
                                                             ::workrave::core::SetOperationModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "SetOperationMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_operation_mode(static_cast<workrave::OperationMode>(request->mode()));
+      executor_.run([&] { impl_.set_operation_mode(static_cast<workrave::OperationMode>(request->mode())); });
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "SetOperationMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "SetOperationMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -200,21 +252,28 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::SetOperationModeForRequest *request,
                                                             ::workrave::core::SetOperationModeForResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "SetOperationModeFor");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_operation_mode_for(static_cast<workrave::OperationMode>(request->mode()), std::chrono::duration_cast<std::chrono::minutes>(::rpc::parse_duration(request->duration())));
+      executor_.run([&] { impl_.set_operation_mode_for(static_cast<workrave::OperationMode>(request->mode()), std::chrono::duration_cast<std::chrono::minutes>(::rpc::parse_duration(request->duration()))); });
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "SetOperationModeFor", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "SetOperationModeFor", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -222,24 +281,31 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::GetUsageModeRequest *request,
                                                             ::workrave::core::GetUsageModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "GetUsageMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.get_usage_mode();
+      auto rpc_result = executor_.run([&] { return impl_.get_usage_mode(); });
 
       response->set_result(static_cast<::workrave::core::UsageMode>(rpc_result));
 
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "GetUsageMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "GetUsageMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -247,21 +313,28 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::SetUsageModeRequest *request,
                                                             ::workrave::core::SetUsageModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "SetUsageMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_usage_mode(static_cast<workrave::UsageMode>(request->mode()));
+      executor_.run([&] { impl_.set_usage_mode(static_cast<workrave::UsageMode>(request->mode())); });
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "SetUsageMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "SetUsageMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -269,82 +342,91 @@ CoreService::CoreService(Core &impl)
                                                             const ::workrave::core::ReportActivityRequest *request,
                                                             ::workrave::core::ReportActivityResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.CoreService", "ReportActivity");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.report_external_activity(request->who(), request->act());
+      executor_.run([&] { impl_.report_external_activity(request->who(), request->act()); });
 
 
-      ::rpc::intercept_request({"workrave.CoreService", "ReportActivity", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.CoreService", "ReportActivity", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
 
-::grpc::Status CoreService::OperationModeChanged(::grpc::ServerContext *context,
-                                                            const ::workrave::core::OperationModeChangedRequest */*request*/,
-                                                            ::grpc::ServerWriter<::workrave::core::OperationModeChangedEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::core::OperationModeChangedEvent> *CoreService::OperationModeChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::core::OperationModeChangedRequest */*request*/)
 {
-
-  ::rpc::EventQueue<::workrave::core::OperationModeChangedEvent> queue;
-  auto connection = impl_.signal_operation_mode_changed().connect(
-    [&queue](workrave::OperationMode value)
+  try
     {
-      ::workrave::core::OperationModeChangedEvent event;
 
-      event.set_value(static_cast<::workrave::core::OperationMode>(value));
+      return signal_operation_mode_changed_broadcaster_.subscribe(
+        [this](auto &events)
+        {
+          return impl_.signal_operation_mode_changed().connect(
+            [&events](workrave::OperationMode value)
+            {
+              ::workrave::core::OperationModeChangedEvent event;
 
-      queue.push(event);
-    });
+              event.set_value(static_cast<::workrave::core::OperationMode>(value));
 
-  ::workrave::core::OperationModeChangedEvent event;
-  while (queue.wait_and_pop(event, context))
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
     {
-      if (!writer->Write(event))
-        {
-          break;
-        }
+      return ::rpc::reject_stream<::workrave::core::OperationModeChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::core::OperationModeChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
-
-  connection.disconnect();
-  return ::grpc::Status::OK;
 }
 
 
-::grpc::Status CoreService::UsageModeChanged(::grpc::ServerContext *context,
-                                                            const ::workrave::core::UsageModeChangedRequest */*request*/,
-                                                            ::grpc::ServerWriter<::workrave::core::UsageModeChangedEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::core::UsageModeChangedEvent> *CoreService::UsageModeChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::core::UsageModeChangedRequest */*request*/)
 {
-
-  ::rpc::EventQueue<::workrave::core::UsageModeChangedEvent> queue;
-  auto connection = impl_.signal_usage_mode_changed().connect(
-    [&queue](workrave::UsageMode value)
+  try
     {
-      ::workrave::core::UsageModeChangedEvent event;
 
-      event.set_value(static_cast<::workrave::core::UsageMode>(value));
+      return signal_usage_mode_changed_broadcaster_.subscribe(
+        [this](auto &events)
+        {
+          return impl_.signal_usage_mode_changed().connect(
+            [&events](workrave::UsageMode value)
+            {
+              ::workrave::core::UsageModeChangedEvent event;
 
-      queue.push(event);
-    });
+              event.set_value(static_cast<::workrave::core::UsageMode>(value));
 
-  ::workrave::core::UsageModeChangedEvent event;
-  while (queue.wait_and_pop(event, context))
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
     {
-      if (!writer->Write(event))
-        {
-          break;
-        }
+      return ::rpc::reject_stream<::workrave::core::UsageModeChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::core::UsageModeChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
-
-  connection.disconnect();
-  return ::grpc::Status::OK;
 }
 
 
@@ -7,17 +7,19 @@
 #include "Core.hh"
 
 
-#include "rpc/EventQueue.hh"
+#include "rpc/EventBroadcaster.hh"
 
+#include "rpc/Executor.hh"
 
 
 namespace workrave::core::rpc
 {
-class CoreService final : public ::workrave::rpc::CoreService::Service
+class CoreService final : public ::workrave::rpc::CoreService::WithCallbackMethod_OperationModeChanged<::workrave::rpc::CoreService::WithCallbackMethod_UsageModeChanged<::workrave::rpc::CoreService::Service>>
 {
 public:
 
-  explicit CoreService(Core &impl);
+  explicit CoreService(Core &impl,
+                       ::rpc::Executor &executor = ::rpc::Executor::inline_executor());
 
 
 
@@ -67,18 +69,22 @@ public:
 
 
 
-  ::grpc::Status OperationModeChanged(::grpc::ServerContext *context,
-                                 const ::workrave::core::OperationModeChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::core::OperationModeChangedEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::core::OperationModeChangedEvent> *OperationModeChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::core::OperationModeChangedRequest *request) override;
 
-  ::grpc::Status UsageModeChanged(::grpc::ServerContext *context,
-                                 const ::workrave::core::UsageModeChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::core::UsageModeChangedEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::core::UsageModeChangedEvent> *UsageModeChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::core::UsageModeChangedRequest *request) override;
 
 
 private:
 
   Core &impl_;
+  ::rpc::Executor &executor_;
+
+
+  ::rpc::EventBroadcaster<::workrave::core::OperationModeChangedEvent> signal_operation_mode_changed_broadcaster_;
+
+  ::rpc::EventBroadcaster<::workrave::core::UsageModeChangedEvent> signal_usage_mode_changed_broadcaster_;
 
 
   [[maybe_unused]] const void *const service_descriptor_anchor_;
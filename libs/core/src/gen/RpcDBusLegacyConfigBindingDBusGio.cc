@@ -10,6 +10,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -60,6 +61,29 @@ struct GioCodec<workrave::config::ConfigFlags>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::config::ConfigFlags>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::config::ConfigFlags &value)
+  {
+    switch (value)
+      {
+
+      case workrave::config::ConfigFlags::CONFIG_FLAG_NONE: writer.write_string("none"); return;
+
+      case workrave::config::ConfigFlags::CONFIG_FLAG_INITIAL: writer.write_string("initial"); return;
+
+      case workrave::config::ConfigFlags::CONFIG_FLAG_IMMEDIATE: writer.write_string("immediate"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 
@@ -10,6 +10,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -66,6 +67,31 @@ struct GioCodec<workrave::BreakId>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::BreakId>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::BreakId &value)
+  {
+    switch (value)
+      {
+
+      case workrave::BreakId::BREAK_ID_NONE: writer.write_string("none"); return;
+
+      case workrave::BreakId::BREAK_ID_MICRO_BREAK: writer.write_string("microbreak"); return;
+
+      case workrave::BreakId::BREAK_ID_REST_BREAK: writer.write_string("restbreak"); return;
+
+      case workrave::BreakId::BREAK_ID_DAILY_LIMIT: writer.write_string("dailylimit"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 namespace workrave::rpc::dbus
@@ -108,6 +134,29 @@ struct GioCodec<workrave::BreakHint>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::BreakHint>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::BreakHint &value)
+  {
+    switch (value)
+      {
+
+      case workrave::BreakHint::Normal: writer.write_string("normal"); return;
+
+      case workrave::BreakHint::UserInitiated: writer.write_string("userinitiated"); return;
+
+      case workrave::BreakHint::NaturalBreak: writer.write_string("naturalbreak"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 namespace workrave::rpc::dbus
@@ -182,6 +231,29 @@ struct GioCodec<workrave::OperationMode>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::OperationMode>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::OperationMode &value)
+  {
+    switch (value)
+      {
+
+      case workrave::OperationMode::Normal: writer.write_string("normal"); return;
+
+      case workrave::OperationMode::Suspended: writer.write_string("suspended"); return;
+
+      case workrave::OperationMode::Quiet: writer.write_string("quiet"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 namespace workrave::rpc::dbus
@@ -245,6 +317,27 @@ struct GioCodec<workrave::UsageMode>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::UsageMode>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::UsageMode &value)
+  {
+    switch (value)
+      {
+
+      case workrave::UsageMode::Normal: writer.write_string("normal"); return;
+
+      case workrave::UsageMode::Reading: writer.write_string("reading"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 
@@ -770,25 +863,15 @@ org_workrave_CoreInterface::dispatch_ReportActivity(GVariant *parameters, GDBusM
 void
 org_workrave_CoreInterface::emit_OperationModeChanged(workrave::OperationMode value)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
-
-  values.push_back(::workrave::rpc::dbus::GioCodec<workrave::OperationMode>::encode(value));
-
   server_.emit_signal(path_, "org.workrave.CoreInterface", "OperationModeChanged",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+                      ::workrave::rpc::dbus::gio_encode_tuple(value),
+                      nullptr);
 }
 void
 org_workrave_CoreInterface::emit_UsageModeChanged(workrave::UsageMode value)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
-
-  values.push_back(::workrave::rpc::dbus::GioCodec<workrave::UsageMode>::encode(value));
-
   server_.emit_signal(path_, "org.workrave.CoreInterface", "UsageModeChanged",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+                      ::workrave::rpc::dbus::gio_encode_tuple(value),
+                      nullptr);
 }
 } // namespace workrave::core::legacy_rpc
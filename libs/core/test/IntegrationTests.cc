@@ -50,6 +50,7 @@ using namespace std::chrono_literals;
 #include "config/SettingCache.hh"
 
 #include "utils/Paths.hh"
+#include "utils/SnapshotFile.hh"
 #include "utils/TimeSource.hh"
 #include "debug.hh"
 
@@ -1660,9 +1661,10 @@ TEST_F(IntegrationTest, test_statistics_counters_and_delete_history)
     0);
 }
 
-//! Break counters other than TOTAL_OVERDUE are written straight to the store, so they
-//! must be durable even without a save_day()/update() in between.
-TEST_F(IntegrationTest, test_statistics_break_counter_is_durable_immediately)
+//! Break counters other than TOTAL_OVERDUE are written straight to the store, which
+//! group-commits them, so they must be durable after a flush even without a
+//! save_day()/update() in between.
+TEST_F(IntegrationTest, test_statistics_break_counter_is_durable_after_flush)
 {
   init();
 
@@ -1670,9 +1672,10 @@ TEST_F(IntegrationTest, test_statistics_break_counter_is_durable_immediately)
   ASSERT_TRUE(statistics != nullptr);
 
   statistics->get_current_day()->break_stats[workrave::BREAK_ID_MICRO_BREAK][workrave::stats::BreakStatValue::Prompted].add(1);
+  statistics->flush();
 
   // Read the store directly, bypassing Statistics's own in-memory current_day, to
-  // prove the increment reached the store immediately.
+  // prove the increment reached the store.
   auto store = workrave::stats::StatisticsStoreFactory::create(workrave::utils::Paths::get_state_directory());
   auto today = store->load_today();
   ASSERT_TRUE(today.has_value());
@@ -1874,6 +1877,97 @@ TEST_F(IntegrationTest, test_load_missing_timer_state)
   EXPECT_EQ(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_elapsed_time(), 0);
 }
 
+namespace
+{
+  std::vector<workrave::utils::SnapshotFile::Record> make_timer_snapshot(int64_t now)
+  {
+    return {{"micro_pause", {now, 15, 0, 0, 0, 0, 0, 0}},
+            {"rest_break", {now, 25, 0, 0, 0, 0, 0, 0}},
+            {"daily_limit", {now, 35, 0, 0, 0, 0, 0, 0}}};
+  }
+
+  std::string make_text_timer_state(int64_t now)
+  {
+    std::ostringstream state;
+    state << "WorkRaveState 3\n"
+          << now << "\n"
+          << "micro_pause " << now << " 10 0 0 0 0 0 0\n"
+          << "rest_break " << now << " 20 0 0 0 0 0 0\n"
+          << "daily_limit " << now << " 30 0 0 0 0 0 0\n";
+    return state.str();
+  }
+
+  int64_t simulated_now()
+  {
+    auto simulated_time = SimulatedTime::create();
+    simulated_time->reset();
+    return simulated_time->get_real_time_usec() / 1000000;
+  }
+} // namespace
+
+TEST_F(IntegrationTest, test_load_timer_snapshot)
+{
+  const auto state_directory = workrave::utils::Paths::get_state_directory();
+  std::filesystem::create_directories(state_directory);
+  ASSERT_TRUE(workrave::utils::SnapshotFile::write(state_directory / "state.bin", make_timer_snapshot(simulated_now())));
+
+  init_without_timer_state();
+
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_elapsed_time(), 15);
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_REST_BREAK)->get_elapsed_time(), 25);
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_DAILY_LIMIT)->get_elapsed_time(), 35);
+}
+
+TEST_F(IntegrationTest, test_load_newer_text_timer_state_over_snapshot)
+{
+  const auto state_directory = workrave::utils::Paths::get_state_directory();
+  const auto snapshot_path = state_directory / "state.bin";
+  std::filesystem::create_directories(state_directory);
+  ASSERT_TRUE(workrave::utils::SnapshotFile::write(snapshot_path, make_timer_snapshot(simulated_now())));
+  std::filesystem::last_write_time(snapshot_path, std::filesystem::last_write_time(snapshot_path) - 1h);
+
+  // As written by an older Workrave after this one last ran.
+  init_with_timer_state(make_text_timer_state(simulated_now()), true);
+
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_elapsed_time(), 10);
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_REST_BREAK)->get_elapsed_time(), 20);
+}
+
+TEST_F(IntegrationTest, test_load_damaged_timer_snapshot_falls_back_to_text)
+{
+  const auto state_directory = workrave::utils::Paths::get_state_directory();
+  const auto text_path = state_directory / "state";
+  std::filesystem::create_directories(state_directory);
+  {
+    std::ofstream text_file(text_path);
+    text_file << make_text_timer_state(simulated_now());
+  }
+  std::filesystem::last_write_time(text_path, std::filesystem::last_write_time(text_path) - 1h);
+  {
+    std::ofstream snapshot_file(state_directory / "state.bin", std::ios::binary);
+    snapshot_file << "WRSN";
+  }
+
+  install_load_timer_state_hook = false;
+  init();
+
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_elapsed_time(), 10);
+}
+
+TEST_F(IntegrationTest, test_save_writes_timer_snapshot)
+{
+  init();
+  // The state is saved once a minute, so this is sure to save it at least once after the start.
+  tick(true, 90);
+
+  const auto records = workrave::utils::SnapshotFile::read(workrave::utils::Paths::get_state_directory() / "state.bin");
+  ASSERT_TRUE(records.has_value());
+  ASSERT_EQ(records->size(), static_cast<size_t>(workrave::BREAK_ID_SIZEOF));
+  EXPECT_EQ(records->at(workrave::BREAK_ID_MICRO_BREAK).id, "micro_pause");
+  ASSERT_GE(records->at(workrave::BREAK_ID_MICRO_BREAK).values.size(), 8U);
+  EXPECT_GT(records->at(workrave::BREAK_ID_MICRO_BREAK).values[1], 0);
+}
+
 TEST_F(IntegrationTest, test_user_ignores_first_prelude)
 {
   init();
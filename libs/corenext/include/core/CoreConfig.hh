@@ -18,12 +18,19 @@
 #ifndef WORKRAVE_BACKEND_CORECONFIG_HH
 #define WORKRAVE_BACKEND_CORECONFIG_HH
 
+#include <array>
 #include <chrono>
+#include <string_view>
 
 #include "config/IConfigurator.hh"
 #include "config/Setting.hh"
 #include "core/ICore.hh"
 
+namespace workrave::config
+{
+  class SettingKey;
+}
+
 class CoreConfig
 {
 public:
@@ -47,6 +54,7 @@ public:
   static workrave::config::Setting<int> &monitor_activity();
   static workrave::config::Setting<int> &monitor_idle();
   static workrave::config::Setting<int> &monitor_sensitivity();
+  static workrave::config::Setting<int> &monitor_motion_quantum();
   static workrave::config::Setting<std::string> &general_datadir();
   static workrave::config::Setting<bool> &grpc_enabled();
   static workrave::config::Setting<std::string> &grpc_transport();
@@ -65,34 +73,36 @@ private:
   static const std::string CFG_KEY_REST_BREAK;
   static const std::string CFG_KEY_DAILY_LIMIT;
 
-  static const std::string CFG_KEY_TIMERS;
+  static constexpr std::string_view CFG_KEY_TIMERS = "timers";
   static const std::string CFG_KEY_TIMER;
 
   static const std::string CFG_KEY_TIMER_LIMIT;
   static const std::string CFG_KEY_TIMER_AUTO_RESET;
   static const std::string CFG_KEY_TIMER_RESET_PRED;
   static const std::string CFG_KEY_TIMER_SNOOZE;
-  static const std::string CFG_KEY_TIMER_DAILY_LIMIT_USE_MICRO_BREAK_ACTIVITY;
+  static constexpr std::string_view CFG_KEY_TIMER_DAILY_LIMIT_USE_MICRO_BREAK_ACTIVITY =
+    "timers/daily_limit/use_microbreak_activity";
 
-  static const std::string CFG_KEY_BREAKS;
+  static constexpr std::string_view CFG_KEY_BREAKS = "breaks";
   static const std::string CFG_KEY_BREAK;
   static const std::string CFG_KEY_BREAK_MAX_PRELUDES;
   static const std::string CFG_KEY_BREAK_ENABLED;
 
-  static const std::string CFG_KEY_MONITOR;
-  static const std::string CFG_KEY_MONITOR_NOISE;
-  static const std::string CFG_KEY_MONITOR_ACTIVITY;
-  static const std::string CFG_KEY_MONITOR_IDLE;
-  static const std::string CFG_KEY_MONITOR_SENSITIVITY;
-  static const std::string CFG_KEY_GENERAL_DATADIR;
-  static const std::string CFG_KEY_GRPC_ENABLED;
-  static const std::string CFG_KEY_GRPC_TRANSPORT;
-  static const std::string CFG_KEY_GRPC_PORT;
-  static const std::string CFG_KEY_OPERATION_MODE;
-  static const std::string CFG_KEY_OPERATION_MODE_RESET_DURATION;
-  static const std::string CFG_KEY_OPERATION_MODE_RESET_OPTIONS;
-  static const std::string CFG_KEY_OPERATION_MODE_RESET_TIME;
-  static const std::string CFG_KEY_USAGE_MODE;
+  static constexpr std::string_view CFG_KEY_MONITOR = "monitor";
+  static constexpr std::string_view CFG_KEY_MONITOR_NOISE = "monitor/noise";
+  static constexpr std::string_view CFG_KEY_MONITOR_ACTIVITY = "monitor/activity";
+  static constexpr std::string_view CFG_KEY_MONITOR_IDLE = "monitor/idle";
+  static constexpr std::string_view CFG_KEY_MONITOR_SENSITIVITY = "monitor/sensitivity";
+  static constexpr std::string_view CFG_KEY_MONITOR_MOTION_QUANTUM = "monitor/motion_quantum";
+  static constexpr std::string_view CFG_KEY_GENERAL_DATADIR = "general/datadir";
+  static constexpr std::string_view CFG_KEY_GRPC_ENABLED = "general/grpc/enabled";
+  static constexpr std::string_view CFG_KEY_GRPC_TRANSPORT = "general/grpc/transport";
+  static constexpr std::string_view CFG_KEY_GRPC_PORT = "general/grpc/port";
+  static constexpr std::string_view CFG_KEY_OPERATION_MODE = "general/operation-mode";
+  static constexpr std::string_view CFG_KEY_OPERATION_MODE_RESET_DURATION = "general/operation_mode_auto_reset_duration";
+  static constexpr std::string_view CFG_KEY_OPERATION_MODE_RESET_OPTIONS = "general/operation_mode_auto_reset_options";
+  static constexpr std::string_view CFG_KEY_OPERATION_MODE_RESET_TIME = "general/operation_mode_auto_reset_time";
+  static constexpr std::string_view CFG_KEY_USAGE_MODE = "general/usage-mode";
 
   // FIXME: remove from interface
   struct Defaults
@@ -114,6 +124,9 @@ private:
 
   static std::string expand(const std::string &key, workrave::BreakId id);
 
+  using BreakKeys = std::array<workrave::config::SettingKey, workrave::BREAK_ID_SIZEOF>;
+  static BreakKeys break_keys(const std::string &key);
+
 public:
   static void init(workrave::config::IConfigurator::Ptr config);
   static std::string get_break_name(workrave::BreakId id);
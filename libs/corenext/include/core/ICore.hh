@@ -19,6 +19,7 @@
 #define WORKRAVE_BACKEND_ICORE_HH
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <boost/signals2.hpp>
@@ -40,15 +41,37 @@ namespace workrave
     using Ptr = std::shared_ptr<ICore>;
     virtual ~ICore() = default;
 
+    //! Input event counters, for diagnostics.
+    struct InputStatistics
+    {
+      //! Events reported by the input monitor.
+      uint64_t events_received{0};
+
+      //! Events left after mouse motion coalescing.
+      uint64_t events_forwarded{0};
+    };
+
     virtual boost::signals2::signal<void(workrave::OperationMode)> &signal_operation_mode_changed() = 0;
     virtual boost::signals2::signal<void(workrave::UsageMode)> &signal_usage_mode_changed() = 0;
 
     //! Initialize the Core. Must be called first.
     virtual void init(IApp *app, const char *display) = 0;
 
-    //! Periodic heartbeat. The GUI *MUST* call this method every second.
+    //! Periodic heartbeat. The GUI *MUST* call this method again within get_next_heartbeat_delay().
     virtual void heartbeat() = 0;
 
+    //! Returns how long the GUI may wait before the next heartbeat.
+    [[nodiscard]] virtual std::chrono::milliseconds get_next_heartbeat_delay() = 0;
+
+    //! Emitted, possibly from another thread, when a heartbeat is needed before that delay has passed.
+    virtual boost::signals2::signal<void()> &signal_heartbeat_needed() = 0;
+
+    //! Runs the RPC calls waiting for the main loop. Main thread only.
+    virtual void dispatch_rpc_calls() = 0;
+
+    //! Emitted, possibly from another thread, when RPC calls are waiting for dispatch_rpc_calls().
+    virtual boost::signals2::signal<void()> &signal_rpc_calls_pending() = 0;
+
     //! Force a break of the specified type.
     virtual void force_break(BreakId id, workrave::utils::Flags<BreakHint> break_hint) = 0;
 
@@ -61,6 +84,9 @@ namespace workrave
     //! Is the user currently active?
     [[nodiscard]] virtual bool is_user_active() const = 0;
 
+    //! Returns the input event counters.
+    [[nodiscard]] virtual InputStatistics get_input_statistics() const = 0;
+
     //! Is the user taking a break?
     [[nodiscard]] virtual bool is_taking() const = 0;
 
@@ -231,3 +231,9 @@ Break::get_break_stage() const
 {
   return get_stage_text(break_state_model->get_break_stage());
 }
+
+BreakStage
+Break::get_stage() const
+{
+  return break_state_model->get_break_stage();
+}
@@ -100,6 +100,8 @@ public:
   // @rpc(name="GetBreakState")
   [[nodiscard]] virtual std::string get_break_stage() const;
 
+  [[nodiscard]] BreakStage get_stage() const;
+
   static std::string get_stage_text(BreakStage stage);
 
 private:
@@ -0,0 +1,46 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef BREAKSNAPSHOT_HH
+#define BREAKSNAPSHOT_HH
+
+#include <cstdint>
+#include <string>
+
+#include "core/CoreTypes.hh"
+
+namespace workrave
+{
+  //! The timer and state of one break, as of the last heartbeat.
+  struct BreakSnapshot
+  {
+    BreakId id{BREAK_ID_NONE};
+    bool enabled{false};
+    bool running{false};
+    //! See Break::get_break_stage().
+    std::string stage;
+    int64_t elapsed{0};
+    int64_t idle{0};
+    //! -1 if the break has no limit.
+    int64_t remaining{-1};
+    int64_t overdue{0};
+
+    bool operator==(const BreakSnapshot &other) const = default;
+  };
+} // namespace workrave
+
+#endif // BREAKSNAPSHOT_HH
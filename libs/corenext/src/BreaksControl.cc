@@ -21,11 +21,16 @@
 
 #include "debug.hh"
 
+#include <filesystem>
 #include <iostream>
 #include <fstream>
+#include <optional>
 #include <sstream>
+#include <vector>
+#include <system_error>
 
 #include "utils/Paths.hh"
+#include "utils/SnapshotFile.hh"
 #include "utils/TimeSource.hh"
 
 #include "BreaksControl.hh"
@@ -33,12 +38,63 @@
 #include "TimerActivityMonitor.hh"
 
 static const char *WORKRAVESTATE = "WorkRaveState";
+static const char *STATE_SNAPSHOT = "state.bin";
 static const int SAVESTATETIME = 60;
 
 using namespace std;
 using namespace workrave;
 using namespace workrave::utils;
 
+//! The snapshot record that holds the state of the timer named id.
+static SnapshotFile::Record
+to_snapshot_record(const std::string &id, const Timer::SavedState &state)
+{
+  return SnapshotFile::Record{id,
+                              {state.save_time,
+                               state.elapsed,
+                               state.last_reset,
+                               state.overdue,
+                               state.snooze_inhibited ? 1 : 0,
+                               state.last_limit_time,
+                               state.last_limit_elapsed,
+                               state.timezone}};
+}
+
+//! The timer state held by a snapshot record, or nullopt if the record is too short.
+static std::optional<Timer::SavedState>
+to_saved_state(const SnapshotFile::Record &record)
+{
+  if (record.values.size() < 8)
+    {
+      return std::nullopt;
+    }
+
+  Timer::SavedState state;
+  state.save_time = record.values[0];
+  state.elapsed = record.values[1];
+  state.last_reset = record.values[2];
+  state.overdue = record.values[3];
+  state.snooze_inhibited = record.values[4] != 0;
+  state.last_limit_time = record.values[5];
+  state.last_limit_elapsed = record.values[6];
+  state.timezone = record.values[7];
+  return state;
+}
+
+//! Whether the text state file was written after the snapshot, by an older Workrave.
+static bool
+is_text_state_newer(const std::filesystem::path &text_path, const std::filesystem::path &snapshot_path)
+{
+  std::error_code ec;
+  const auto text_time = std::filesystem::last_write_time(text_path, ec);
+  if (ec)
+    {
+      return false;
+    }
+  const auto snapshot_time = std::filesystem::last_write_time(snapshot_path, ec);
+  return ec || text_time > snapshot_time;
+}
+
 BreaksControl::BreaksControl(IApp *app,
                              IActivityMonitor::Ptr activity_monitor,
                              CoreModes::Ptr modes,
@@ -100,6 +156,7 @@ BreaksControl::init()
   microbreak_activity_monitor = std::make_shared<TimerActivityMonitor>(activity_monitor, timers[BREAK_ID_MICRO_BREAK]);
 
   load_state();
+  last_save_period = TimeSource::get_monotonic_time_sec() / SAVESTATETIME;
 }
 
 IBreak::Ptr
@@ -108,6 +165,50 @@ BreaksControl::get_break(BreakId break_id)
   return breaks[break_id];
 }
 
+std::vector<BreakSnapshot>
+BreaksControl::get_timer_snapshot() const
+{
+  std::vector<BreakSnapshot> snapshot;
+  snapshot.reserve(BREAK_ID_SIZEOF);
+  for (BreakId break_id = BREAK_ID_MICRO_BREAK; break_id < BREAK_ID_SIZEOF; break_id++)
+    {
+      const Break::Ptr &b = breaks[break_id];
+      BreakSnapshot s;
+      s.id = break_id;
+      s.enabled = b->is_enabled();
+      s.running = b->is_running();
+      s.stage = b->get_break_stage();
+      s.elapsed = b->get_elapsed_time();
+      s.idle = b->get_elapsed_idle_time();
+      s.remaining = b->get_timer_remaining();
+      s.overdue = b->get_total_overdue_time();
+      snapshot.push_back(std::move(s));
+    }
+  return snapshot;
+}
+
+void
+BreaksControl::get_timer_status(WorkraveTimerStatusData &data) const
+{
+  static_assert(BREAK_ID_SIZEOF == WORKRAVE_TIMER_STATUS_BREAKS);
+  static_assert(static_cast<int>(BreakStage::Delayed) == WORKRAVE_TIMER_STATUS_STATE_DELAYED);
+
+  for (BreakId break_id = BREAK_ID_MICRO_BREAK; break_id < BREAK_ID_SIZEOF; break_id++)
+    {
+      const Break::Ptr &b = breaks[break_id];
+      WorkraveTimerStatusBreak &status = data.breaks[break_id];
+      status.elapsed = b->get_elapsed_time();
+      status.limit = b->is_limit_enabled() ? b->get_limit() : -1;
+      status.idle = b->get_elapsed_idle_time();
+      status.state = static_cast<int32_t>(b->get_stage());
+      status.flags = b->is_enabled() ? WORKRAVE_TIMER_STATUS_FLAG_ENABLED : 0;
+      if (b->is_running())
+        {
+          status.flags |= WORKRAVE_TIMER_STATUS_FLAG_RUNNING;
+        }
+    }
+}
+
 void
 BreaksControl::force_idle()
 {
@@ -175,14 +276,49 @@ BreaksControl::heartbeat()
   // Cheap, in-memory only: safe to do every heartbeat.
   statistics->update();
 
-  // Make state persistent.
-  if (TimeSource::get_monotonic_time_sec() % SAVESTATETIME == 0)
+  // Make state persistent, once per period, also if heartbeats skipped its first second.
+  const int64_t save_period = TimeSource::get_monotonic_time_sec() / SAVESTATETIME;
+  if (save_period != last_save_period)
     {
+      last_save_period = save_period;
       statistics->save();
       save_state();
     }
 }
 
+//! Returns the monotonic time, in seconds, at which the next heartbeat is needed, or 0 if none is.
+/*!
+ *  While the user is active, a timer runs or a break is in progress, that is
+ *  the next second. Otherwise nothing changes until a timer reaches its limit
+ *  or resets, or until the user becomes active again.
+ */
+int64_t
+BreaksControl::get_next_heartbeat_time()
+{
+  const int64_t next_second = TimeSource::get_monotonic_time_sec_sync() + 1;
+
+  if (modes->get_usage_mode() == UsageMode::Reading || activity_monitor->is_active())
+    {
+      return next_second;
+    }
+
+  int64_t next = 0;
+  for (BreakId break_id = BREAK_ID_MICRO_BREAK; break_id < BREAK_ID_SIZEOF; break_id++)
+    {
+      if (breaks[break_id]->is_active() || timers[break_id]->is_running())
+        {
+          return next_second;
+        }
+
+      int64_t time = timers[break_id]->get_next_event_time();
+      if (time != 0 && (next == 0 || time < next))
+        {
+          next = time;
+        }
+    }
+  return next;
+}
+
 //! Processes all timers.
 void
 BreaksControl::process_timers(bool user_is_active)
@@ -456,27 +592,20 @@ BreaksControl::on_break_event(BreakId break_id, BreakEvent event)
 void
 BreaksControl::save_state() const
 {
-  std::filesystem::path path = Paths::get_state_directory() / "state";
-  ofstream stateFile(path.string());
-
-  stateFile << "WorkRaveState 3" << endl << TimeSource::get_real_time_sec() << endl;
-
+  std::vector<SnapshotFile::Record> records;
+  records.reserve(BREAK_ID_SIZEOF);
   for (BreakId break_id = BREAK_ID_MICRO_BREAK; break_id < BREAK_ID_SIZEOF; break_id++)
     {
-      const string stateStr = timers[break_id]->serialize_state();
-
-      stateFile << stateStr << endl;
+      records.push_back(to_snapshot_record(timers[break_id]->get_id(), timers[break_id]->get_saved_state()));
     }
 
-  stateFile.close();
+  SnapshotFile::write(Paths::get_state_directory() / STATE_SNAPSHOT, records);
 }
 
 //! Loads the current state.
 void
 BreaksControl::load_state()
 {
-  std::filesystem::path path = Paths::get_state_directory() / "state";
-
 #if defined(HAVE_TESTS)
   if (hooks->hook_load_timer_state())
     {
@@ -486,6 +615,49 @@ BreaksControl::load_state()
         }
     }
 #endif
+
+  if (!load_snapshot_state())
+    {
+      load_text_state();
+    }
+}
+
+//! Loads the binary state snapshot. Returns false if there is none to use.
+bool
+BreaksControl::load_snapshot_state()
+{
+  const std::filesystem::path path = Paths::get_state_directory() / STATE_SNAPSHOT;
+  if (is_text_state_newer(Paths::get_state_directory() / "state", path))
+    {
+      return false;
+    }
+
+  const std::optional<std::vector<SnapshotFile::Record>> records = SnapshotFile::read(path);
+  if (!records.has_value())
+    {
+      return false;
+    }
+
+  for (const SnapshotFile::Record &record: records.value())
+    {
+      const std::optional<Timer::SavedState> state = to_saved_state(record);
+      for (BreakId break_id = BREAK_ID_MICRO_BREAK; state.has_value() && break_id < BREAK_ID_SIZEOF; break_id++)
+        {
+          if (timers[break_id]->get_id() == record.id)
+            {
+              timers[break_id]->restore_saved_state(state.value());
+              break;
+            }
+        }
+    }
+  return true;
+}
+
+//! Loads the text state file of older versions of Workrave.
+void
+BreaksControl::load_text_state()
+{
+  std::filesystem::path path = Paths::get_state_directory() / "state";
   ifstream state_file(path.string());
 
   int version = 0;
@@ -18,12 +18,16 @@
 #ifndef BREAKSCONTROL_HH
 #define BREAKSCONTROL_HH
 
+#include <vector>
+
 #include "config/Config.hh"
 
 #include "Break.hh"
+#include "BreakSnapshot.hh"
 #include "Timer.hh"
 
 #include "core/ICore.hh"
+#include "core/TimerStatus.h"
 #include "CoreModes.hh"
 #include "CoreHooks.hh"
 #include "stats/IStatistics.hh"
@@ -50,12 +54,19 @@ public:
 
   void init();
   void heartbeat();
+  int64_t get_next_heartbeat_time();
   void save_state() const;
 
   void force_break(workrave::BreakId id, workrave::utils::Flags<workrave::BreakHint> break_hint);
 
   workrave::IBreak::Ptr get_break(workrave::BreakId id);
 
+  //! Returns the timer and state of every break, all read in one go.
+  std::vector<workrave::BreakSnapshot> get_timer_snapshot() const;
+
+  //! Fills the per-break part of the shared timer status segment.
+  void get_timer_status(WorkraveTimerStatusData &data) const;
+
   void set_insist_policy(workrave::InsistPolicy p);
 
 #if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
@@ -74,6 +85,8 @@ private:
   void process_timers(bool user_is_active);
   void start_break(workrave::BreakId break_id, workrave::BreakId resume_this_break = workrave::BREAK_ID_NONE);
   void load_state();
+  bool load_snapshot_state();
+  void load_text_state();
   void defrost();
   void freeze();
   void force_idle();
@@ -102,6 +115,9 @@ private:
 
   workrave::InsistPolicy insist_policy;
   workrave::InsistPolicy active_insist_policy;
+
+  //! The SAVESTATETIME period in which the state was last saved.
+  int64_t last_save_period{0};
 };
 
 #endif // BREAKSCONTROL_HH
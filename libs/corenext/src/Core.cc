@@ -25,6 +25,7 @@
 
 #include "debug.hh"
 
+#include <algorithm>
 #include <cstdlib>
 #include <filesystem>
 
@@ -43,9 +44,15 @@
 #include "Break.hh"
 #include "core/CoreConfig.hh"
 #include "stats/IStatistics.hh"
+#if defined(PLATFORM_OS_UNIX)
+#  include "TimerStatusSegment.hh"
+#endif
 
 #if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
 #  include "RpcCoreServer.hh"
+#  include "rpc/EventQueue.hh"
+#  include "rpc/LatencyHistogram.hh"
+#  include "utils/Diagnostics.hh"
 #endif
 #if defined(HAVE_CORE_NEXT_DBUS)
 #  include "RpcDBusServer.hh"
@@ -73,6 +80,11 @@ Core::Core(workrave::config::IConfigurator::Ptr configurator)
 Core::~Core()
 {
   TRACE_ENTRY();
+  configurator->remove_listener(this);
+#if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
+  Diagnostics::instance().unregister_topic("rpc.latency");
+  Diagnostics::instance().unregister_topic("rpc.queues");
+#endif
   if (monitor)
     {
       monitor->terminate();
@@ -110,10 +122,20 @@ Core::init(IApp *app, const char *display_name)
 
   statistics = workrave::stats::create([m = monitor]() { return m->is_active(); });
 
-  core_modes = std::make_shared<CoreModes>(monitor);
+  core_modes = std::make_shared<CoreModes>(monitor, configurator);
   breaks_control = std::make_shared<BreaksControl>(application, monitor, core_modes, statistics, hooks);
   breaks_control->init();
 
+  // Anything that can end a quiet period outside heartbeat().
+  connect(monitor->signal_activity_started(), this, [this]() { request_heartbeat(); });
+  connect(core_modes->signal_operation_mode_changed(), this, [this](auto) { request_heartbeat(); });
+  connect(core_modes->signal_usage_mode_changed(), this, [this](auto) { request_heartbeat(); });
+  for (BreakId break_id = BREAK_ID_MICRO_BREAK; break_id < BREAK_ID_SIZEOF; break_id++)
+    {
+      connect(breaks_control->get_break(break_id)->signal_break_event(), this, [this](auto) { request_heartbeat(); });
+    }
+  configurator->add_listener("", this);
+
 #if defined(HAVE_TESTS)
   // Tests install hook_create_monitor() (see above) and construct a fresh
   // Core per test case — starting a real gRPC server bound to a fixed port
@@ -129,9 +151,55 @@ Core::init(IApp *app, const char *display_name)
 #if defined(HAVE_CORE_NEXT_DBUS)
       init_rpc_dbus();
 #endif
+      init_timer_status();
     }
 }
 
+//! Publishes the timers in a shared memory segment for local readers.
+/*!
+ *  Applets and other local agents can then poll the timers at any rate
+ *  without an RPC round trip; see core/TimerStatus.h for the layout.
+ */
+void
+Core::init_timer_status()
+{
+#if defined(PLATFORM_OS_UNIX)
+  const std::filesystem::path path = TimerStatusSegment::get_default_path();
+  if (path.empty())
+    {
+      spdlog::info("No XDG_RUNTIME_DIR; not publishing timer status");
+      return;
+    }
+
+  try
+    {
+      timer_status = std::make_shared<TimerStatusSegment>(path);
+      update_timer_status();
+    }
+  catch (const std::exception &e)
+    {
+      spdlog::warn("Timer status segment unavailable: {}", e.what());
+    }
+#endif
+}
+
+void
+Core::update_timer_status()
+{
+#if defined(PLATFORM_OS_UNIX)
+  if (!timer_status)
+    {
+      return;
+    }
+
+  WorkraveTimerStatusData data{};
+  data.updated = TimeSource::get_real_time_sec();
+  data.operation_mode = static_cast<int32_t>(core_modes->get_active_operation_mode());
+  breaks_control->get_timer_status(data);
+  timer_status->publish(data);
+#endif
+}
+
 #if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
 //! Starts the gRPC server exposing CoreService/BreakService/ConfigService.
 void
@@ -140,10 +208,46 @@ Core::init_rpc()
   CoreConfig::grpc_enabled().connect(rpc_settings_tracker, [this](bool) { update_rpc(); });
   CoreConfig::grpc_transport().connect(rpc_settings_tracker, [this](const std::string &) { update_rpc(); });
   CoreConfig::grpc_port().connect(rpc_settings_tracker, [this](int) { update_rpc(); });
+  Diagnostics::instance().register_topic("rpc.latency", &Core::report_rpc_latencies);
+  Diagnostics::instance().register_topic("rpc.queues", &Core::report_rpc_queues);
 
   update_rpc();
 }
 
+//! Writes the latency summary of every gRPC method called so far to the diagnostics log.
+void
+Core::report_rpc_latencies()
+{
+  for (const auto &[service, method, summary]: rpc::method_latencies())
+    {
+      Diagnostics::instance().log(fmt::format("rpc.latency {}/{} -> calls={} failed={} mean={}us p50={}us p90={}us p99={}us max={}us",
+                                              service,
+                                              method,
+                                              summary.calls,
+                                              summary.failed,
+                                              summary.mean.count(),
+                                              summary.p50.count(),
+                                              summary.p90.count(),
+                                              summary.p99.count(),
+                                              summary.max.count()));
+    }
+}
+
+//! Writes how full the event queues of every gRPC stream got, and what they lost, to the diagnostics log.
+void
+Core::report_rpc_queues()
+{
+  for (const auto &[stream, stats]: rpc::event_queue_stats())
+    {
+      Diagnostics::instance().log(fmt::format("rpc.queues {} -> high_water={} dropped={} coalesced={} rejected={}",
+                                              stream,
+                                              stats.high_water,
+                                              stats.dropped,
+                                              stats.coalesced,
+                                              stats.rejected));
+    }
+}
+
 void
 Core::update_rpc()
 {
@@ -196,7 +300,11 @@ Core::update_rpc()
           rpc_listen_address.clear();
         }
 
-      rpc_server = std::make_unique<RpcCoreServer>(*this, get_break_registry(), *configurator, listen_address);
+      rpc_server = std::make_unique<RpcCoreServer>(*this,
+                                                   get_break_registry(),
+                                                   *configurator,
+                                                   listen_address,
+                                                   [this] { rpc_calls_pending_signal(); });
       rpc_listen_address = std::move(listen_address);
     }
   catch (std::exception &e)
@@ -238,10 +346,95 @@ Core::heartbeat()
 {
   TRACE_ENTRY();
   TimeSource::sync();
+  heartbeat_deferred = false;
 
   configurator->heartbeat();
   breaks_control->heartbeat();
   core_modes->heartbeat();
+
+  update_timer_snapshot();
+  update_timer_status();
+}
+
+//! Returns how long the GUI may wait before the next heartbeat.
+/*!
+ *  One second while anything is counting. While the user is idle, the time
+ *  until the nearest timer limit or reset, operation mode reset or delayed
+ *  configuration change; signal_heartbeat_needed() ends the wait early when
+ *  the user becomes active again.
+ */
+std::chrono::milliseconds
+Core::get_next_heartbeat_delay()
+{
+  if (!breaks_control)
+    {
+      return HEARTBEAT_INTERVAL;
+    }
+
+  int64_t next = 0;
+  for (int64_t time:
+       {breaks_control->get_next_heartbeat_time(), core_modes->get_next_heartbeat_time(), configurator->get_next_heartbeat_time()})
+    {
+      if (time != 0 && (next == 0 || time < next))
+        {
+          next = time;
+        }
+    }
+
+  std::chrono::milliseconds delay = MAX_HEARTBEAT_DELAY;
+  if (next != 0)
+    {
+      const std::chrono::microseconds until{next * TimeSource::TIME_USEC_PER_SEC - TimeSource::get_monotonic_time_usec()};
+      delay = std::clamp(std::chrono::ceil<std::chrono::milliseconds>(until), HEARTBEAT_INTERVAL, MAX_HEARTBEAT_DELAY);
+    }
+
+  heartbeat_deferred = delay > HEARTBEAT_INTERVAL;
+  return delay;
+}
+
+boost::signals2::signal<void()> &
+Core::signal_heartbeat_needed()
+{
+  return heartbeat_needed_signal;
+}
+
+//! Asks the GUI for a heartbeat now if it was told it could wait.
+void
+Core::request_heartbeat()
+{
+  if (heartbeat_deferred.exchange(false))
+    {
+      heartbeat_needed_signal();
+    }
+}
+
+//! Runs the RPC calls waiting for the main loop.
+/*!
+ *  The gRPC services hand every call to the main loop (see RpcCoreServer);
+ *  signal_rpc_calls_pending() asks for this once per batch of calls.
+ */
+void
+Core::dispatch_rpc_calls()
+{
+#if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
+  if (rpc_server != nullptr)
+    {
+      rpc_server->dispatch_pending_calls();
+    }
+#endif
+}
+
+boost::signals2::signal<void()> &
+Core::signal_rpc_calls_pending()
+{
+  return rpc_calls_pending_signal;
+}
+
+void
+Core::config_changed_notify(const std::string &key)
+{
+  (void)key;
+  request_heartbeat();
 }
 
 /********************************************************************************/
@@ -265,6 +458,7 @@ void
 Core::force_break(BreakId id, workrave::utils::Flags<BreakHint> break_hint)
 {
   breaks_control->force_break(id, break_hint);
+  request_heartbeat();
 }
 
 //!
@@ -311,6 +505,14 @@ Core::is_user_active() const
   return monitor->is_active();
 }
 
+//! Returns the input event counters.
+ICore::InputStatistics
+Core::get_input_statistics() const
+{
+  const auto statistics = monitor->get_input_statistics();
+  return {statistics.events_received, statistics.events_forwarded};
+}
+
 //! Retrieves the operation mode.
 OperationMode
 Core::get_active_operation_mode()
@@ -389,6 +591,7 @@ void
 Core::force_idle()
 {
   monitor->force_idle();
+  request_heartbeat();
 }
 
 //! Announces a powersave state.
@@ -427,6 +630,66 @@ Core::report_external_activity(std::string who, bool act)
   // monitor->report_external_activity(who, act);
 }
 
+//! Returns the timers and state of all breaks.
+/*!
+ *  RPC calls run on the main loop between heartbeats (see
+ *  dispatch_rpc_calls()), so all values are from the same tick.
+ */
+std::vector<BreakSnapshot>
+Core::get_timer_snapshot() const
+{
+  return breaks_control->get_timer_snapshot();
+}
+
+boost::signals2::signal<void(std::vector<BreakSnapshot>)> &
+Core::signal_timer_snapshot_changed()
+{
+  return timer_snapshot_changed_signal;
+}
+
+//! Returns the call count and latency of every gRPC method called so far.
+/*!
+ *  Empty without gRPC support. Calls over D-Bus are not measured, but may
+ *  query the gRPC figures.
+ */
+std::vector<RpcLatency>
+Core::get_rpc_latencies() const
+{
+  std::vector<RpcLatency> latencies;
+#if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
+  for (auto &[service, method, summary]: rpc::method_latencies())
+    {
+      latencies.push_back({std::move(service),
+                           std::move(method),
+                           static_cast<int64_t>(summary.calls),
+                           static_cast<int64_t>(summary.failed),
+                           summary.mean.count(),
+                           summary.p50.count(),
+                           summary.p90.count(),
+                           summary.p99.count(),
+                           summary.max.count()});
+    }
+#endif
+  return latencies;
+}
+
+//! Notifies listeners if any timer or break state changed since the previous heartbeat.
+/*!
+ *  The snapshot is kept up to date even without listeners, so that a new
+ *  listener, which starts from get_timer_snapshot(), is never compared
+ *  against an older state than the one it was given.
+ */
+void
+Core::update_timer_snapshot()
+{
+  auto snapshot = breaks_control->get_timer_snapshot();
+  if (snapshot != last_timer_snapshot)
+    {
+      last_timer_snapshot = std::move(snapshot);
+      timer_snapshot_changed_signal(last_timer_snapshot);
+    }
+}
+
 // TODO: remove
 namespace workrave
 {
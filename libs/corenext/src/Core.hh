@@ -18,14 +18,21 @@
 #ifndef CORE_HH
 #define CORE_HH
 
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "config/IConfigurator.hh"
+#include "config/IConfiguratorListener.hh"
 #include "utils/Signals.hh"
 
 #include "core/ICore.hh"
 #include "LocalActivityMonitor.hh"
 #include "BreaksControl.hh"
+#include "BreakSnapshot.hh"
+#include "RpcLatency.hh"
 #include "stats/IStatistics.hh"
 #include "CoreHooks.hh"
 #include "CoreModes.hh"
@@ -36,6 +43,8 @@ namespace workrave
   class IApp;
 }
 
+class TimerStatusSegment;
+
 #if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
 class RpcCoreServer;
 #endif
@@ -45,7 +54,10 @@ class RpcDBusServer;
 
 // @rpc(service="workrave.CoreService")
 // @rpc.dbus(interface="org.workrave.CoreInterface")
-class Core : public workrave::ICore
+class Core
+  : public workrave::ICore
+  , public workrave::config::IConfiguratorListener
+  , public workrave::utils::Trackable
 {
 public:
   explicit Core(workrave::config::IConfigurator::Ptr configurator);
@@ -53,11 +65,17 @@ public:
 
   // ICore
   // @rpc.signal(name="OperationModeChanged")
+  // @rpc.queue(policy="drop_oldest", capacity=1)
   boost::signals2::signal<void(workrave::OperationMode)> &signal_operation_mode_changed() override;
   // @rpc.signal(name="UsageModeChanged")
+  // @rpc.queue(policy="drop_oldest", capacity=1)
   boost::signals2::signal<void(workrave::UsageMode)> &signal_usage_mode_changed() override;
   void init(workrave::IApp *application, const char *display_name) override;
   void heartbeat() override;
+  std::chrono::milliseconds get_next_heartbeat_delay() override;
+  boost::signals2::signal<void()> &signal_heartbeat_needed() override;
+  void dispatch_rpc_calls() override;
+  boost::signals2::signal<void()> &signal_rpc_calls_pending() override;
   // @rpc(name="ForceBreak")
   void force_break(workrave::BreakId id, workrave::utils::Flags<workrave::BreakHint> break_hint) override;
   workrave::IBreak::Ptr get_break(workrave::BreakId id) const override;
@@ -65,6 +83,7 @@ public:
   ICoreHooks::Ptr get_hooks() const override;
   // @rpc(name="IsActive")
   bool is_user_active() const override;
+  InputStatistics get_input_statistics() const override;
   // @rpc(name="IsTaking")
   bool is_taking() const override;
   // @rpc(name="GetActiveOperationMode")
@@ -90,6 +109,12 @@ public:
   // DBus/RPC functions.
   // @rpc(name="ReportActivity")
   void report_external_activity(std::string who, bool act) override;
+  // @rpc(name="GetTimerSnapshot")
+  std::vector<workrave::BreakSnapshot> get_timer_snapshot() const;
+  // @rpc.signal(name="TimerSnapshotChanged", latest="get_timer_snapshot")
+  boost::signals2::signal<void(std::vector<workrave::BreakSnapshot>)> &signal_timer_snapshot_changed();
+  // @rpc(name="GetRpcLatencies")
+  std::vector<workrave::RpcLatency> get_rpc_latencies() const;
 
 #if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
   // The per-object Break service registry; forwards to BreaksControl so
@@ -100,9 +125,17 @@ public:
 #endif
 
 private:
+  void request_heartbeat();
+  void update_timer_snapshot();
+  void init_timer_status();
+  void update_timer_status();
+  void config_changed_notify(const std::string &key) override;
+
 #if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
   void init_rpc();
   void update_rpc();
+  static void report_rpc_latencies();
+  static void report_rpc_queues();
 #endif
 #if defined(HAVE_CORE_NEXT_DBUS)
   void init_rpc_dbus();
@@ -133,6 +166,30 @@ private:
   //! Did the OS announce a powersave?
   bool powersave{false};
 
+  //! The heartbeat interval while anything is counting.
+  static constexpr std::chrono::milliseconds HEARTBEAT_INTERVAL{1000};
+
+  //! The longest the GUI may go without a heartbeat, in case a wakeup is missed.
+  static constexpr std::chrono::milliseconds MAX_HEARTBEAT_DELAY{std::chrono::minutes{5}};
+
+  //! Was the GUI told it may wait longer than HEARTBEAT_INTERVAL?
+  std::atomic<bool> heartbeat_deferred{false};
+
+  //! Heartbeat needed notification.
+  boost::signals2::signal<void()> heartbeat_needed_signal;
+
+  //! RPC calls pending notification.
+  boost::signals2::signal<void()> rpc_calls_pending_signal;
+
+  //! Timer snapshot changed notification.
+  boost::signals2::signal<void(std::vector<workrave::BreakSnapshot>)> timer_snapshot_changed_signal;
+
+  //! The timer snapshot as of the previous heartbeat.
+  std::vector<workrave::BreakSnapshot> last_timer_snapshot;
+
+  //! Timer status shared with local readers, rewritten on every heartbeat.
+  std::shared_ptr<TimerStatusSegment> timer_status;
+
 #if defined(HAVE_GRPC) && defined(HAVE_CORE_NEXT)
   std::string rpc_listen_address;
 
@@ -36,32 +36,15 @@ IConfigurator::Ptr CoreConfig::config;
 const string CoreConfig::CFG_KEY_MICRO_BREAK = "micro_pause";
 const string CoreConfig::CFG_KEY_REST_BREAK = "rest_break";
 const string CoreConfig::CFG_KEY_DAILY_LIMIT = "daily_limit";
-const string CoreConfig::CFG_KEY_TIMERS = "timers";
 const string CoreConfig::CFG_KEY_TIMER = "timers/%b";
 const string CoreConfig::CFG_KEY_TIMER_LIMIT = "timers/%b/limit";
 const string CoreConfig::CFG_KEY_TIMER_AUTO_RESET = "timers/%b/auto_reset";
 const string CoreConfig::CFG_KEY_TIMER_RESET_PRED = "timers/%b/reset_pred";
 const string CoreConfig::CFG_KEY_TIMER_SNOOZE = "timers/%b/snooze";
 const string CoreConfig::CFG_KEY_TIMER_MONITOR = "timers/%b/monitor";
-const string CoreConfig::CFG_KEY_TIMER_DAILY_LIMIT_USE_MICRO_BREAK_ACTIVITY = "timers/daily_limit/use_microbreak_activity";
-const string CoreConfig::CFG_KEY_BREAKS = "breaks";
 const string CoreConfig::CFG_KEY_BREAK = "breaks/%b";
 const string CoreConfig::CFG_KEY_BREAK_MAX_PRELUDES = "breaks/%b/max_preludes";
 const string CoreConfig::CFG_KEY_BREAK_ENABLED = "breaks/%b/enabled";
-const string CoreConfig::CFG_KEY_MONITOR = "monitor";
-const string CoreConfig::CFG_KEY_MONITOR_NOISE = "monitor/noise";
-const string CoreConfig::CFG_KEY_MONITOR_ACTIVITY = "monitor/activity";
-const string CoreConfig::CFG_KEY_MONITOR_IDLE = "monitor/idle";
-const string CoreConfig::CFG_KEY_MONITOR_SENSITIVITY = "monitor/sensitivity";
-const string CoreConfig::CFG_KEY_GENERAL_DATADIR = "general/datadir";
-const string CoreConfig::CFG_KEY_GRPC_ENABLED = "general/grpc/enabled";
-const string CoreConfig::CFG_KEY_GRPC_TRANSPORT = "general/grpc/transport";
-const string CoreConfig::CFG_KEY_GRPC_PORT = "general/grpc/port";
-const string CoreConfig::CFG_KEY_OPERATION_MODE = "general/operation-mode";
-const string CoreConfig::CFG_KEY_OPERATION_MODE_RESET_DURATION = "general/operation_mode_auto_reset_duration";
-const string CoreConfig::CFG_KEY_OPERATION_MODE_RESET_OPTIONS = "general/operation_mode_auto_reset_options";
-const string CoreConfig::CFG_KEY_OPERATION_MODE_RESET_TIME = "general/operation_mode_auto_reset_time";
-const string CoreConfig::CFG_KEY_USAGE_MODE = "general/usage-mode";
 
 CoreConfig::Defaults CoreConfig::default_config[] = {{
                                                        CoreConfig::CFG_KEY_MICRO_BREAK,
@@ -130,8 +113,20 @@ CoreConfig::init(IConfigurator::Ptr config)
       config->set_value(CoreConfig::break_max_preludes(break_id).key(), def.max_preludes, CONFIG_FLAG_INITIAL);
 
       config->set_value(CoreConfig::break_enabled(break_id).key(), true, CONFIG_FLAG_INITIAL);
+
+      // Read by the breaks and the GUI on every heartbeat.
+      timer_limit(break_id).set_cached(true);
+      timer_auto_reset(break_id).set_cached(true);
+      timer_snooze(break_id).set_cached(true);
+      break_max_preludes(break_id).set_cached(true);
+      break_enabled(break_id).set_cached(true);
     }
 
+  operation_mode().set_cached(true);
+  usage_mode().set_cached(true);
+  operation_mode_auto_reset_duration().set_cached(true);
+  operation_mode_auto_reset_time().set_cached(true);
+
   config->set_value(CoreConfig::timer_daily_limit_use_micro_break_activity().key(), false, CONFIG_FLAG_INITIAL);
   config->set_value(CoreConfig::operation_mode_auto_reset_duration().key(), 0, CONFIG_FLAG_INITIAL);
   config->set_value(CoreConfig::operation_mode_auto_reset_options().key(), "30;60;120;240", CONFIG_FLAG_INITIAL);
@@ -143,7 +138,7 @@ CoreConfig::init(IConfigurator::Ptr config)
     {
       config->set_value(expand(CoreConfig::CFG_KEY_TIMER_MONITOR, BREAK_ID_DAILY_LIMIT),
                         "deprecated. replaced by use_microbreak_activity");
-      config->set_value(CoreConfig::CFG_KEY_TIMER_DAILY_LIMIT_USE_MICRO_BREAK_ACTIVITY, true);
+      config->set_value(CoreConfig::timer_daily_limit_use_micro_break_activity().key(), true);
     }
 }
 
@@ -163,124 +158,159 @@ CoreConfig::expand(const string &key, workrave::BreakId id)
   return str;
 }
 
+CoreConfig::BreakKeys
+CoreConfig::break_keys(const std::string &key)
+{
+  return {SettingKey{expand(key, BREAK_ID_MICRO_BREAK)},
+          SettingKey{expand(key, BREAK_ID_REST_BREAK)},
+          SettingKey{expand(key, BREAK_ID_DAILY_LIMIT)}};
+}
+
 SettingGroup &
 CoreConfig::key_timer(workrave::BreakId break_id)
 {
-  return SettingCache::group(config, expand(CFG_KEY_TIMER, break_id));
+  static const BreakKeys keys = break_keys(CFG_KEY_TIMER);
+  return SettingCache::group(config, keys[break_id]);
 }
 
 SettingGroup &
 CoreConfig::key_break(workrave::BreakId break_id)
 {
-  return SettingCache::group(config, expand(CFG_KEY_BREAK, break_id));
+  static const BreakKeys keys = break_keys(CFG_KEY_BREAK);
+  return SettingCache::group(config, keys[break_id]);
 }
 
 SettingGroup &
 CoreConfig::key_timers()
 {
-  return SettingCache::group(config, CFG_KEY_TIMERS);
+  static constinit SettingKey key{CFG_KEY_TIMERS};
+  return SettingCache::group(config, key);
 }
 
 SettingGroup &
 CoreConfig::key_breaks()
 {
-  return SettingCache::group(config, CFG_KEY_BREAKS);
+  static constinit SettingKey key{CFG_KEY_BREAKS};
+  return SettingCache::group(config, key);
 }
 
 SettingGroup &
 CoreConfig::key_monitor()
 {
-  return SettingCache::group(config, CFG_KEY_MONITOR);
+  static constinit SettingKey key{CFG_KEY_MONITOR};
+  return SettingCache::group(config, key);
 }
 
 Setting<int> &
 CoreConfig::timer_limit(workrave::BreakId break_id)
 {
-  return SettingCache::get<int>(config, expand(CFG_KEY_TIMER_LIMIT, break_id));
+  static const BreakKeys keys = break_keys(CFG_KEY_TIMER_LIMIT);
+  return SettingCache::get<int>(config, keys[break_id]);
 }
 
 Setting<int> &
 CoreConfig::timer_auto_reset(workrave::BreakId break_id)
 {
-  return SettingCache::get<int>(config, expand(CFG_KEY_TIMER_AUTO_RESET, break_id));
+  static const BreakKeys keys = break_keys(CFG_KEY_TIMER_AUTO_RESET);
+  return SettingCache::get<int>(config, keys[break_id]);
 }
 
 Setting<std::string> &
 CoreConfig::timer_reset_pred(workrave::BreakId break_id)
 {
-  return SettingCache::get<std::string>(config, expand(CFG_KEY_TIMER_RESET_PRED, break_id));
+  static const BreakKeys keys = break_keys(CFG_KEY_TIMER_RESET_PRED);
+  return SettingCache::get<std::string>(config, keys[break_id]);
 }
 
 Setting<int> &
 CoreConfig::timer_snooze(workrave::BreakId break_id)
 {
-  return SettingCache::get<int>(config, expand(CFG_KEY_TIMER_SNOOZE, break_id));
+  static const BreakKeys keys = break_keys(CFG_KEY_TIMER_SNOOZE);
+  return SettingCache::get<int>(config, keys[break_id]);
 }
 
 Setting<bool> &
 CoreConfig::timer_daily_limit_use_micro_break_activity()
 {
-  return SettingCache::get<bool>(config, CFG_KEY_TIMER_DAILY_LIMIT_USE_MICRO_BREAK_ACTIVITY);
+  static constinit SettingKey key{CFG_KEY_TIMER_DAILY_LIMIT_USE_MICRO_BREAK_ACTIVITY};
+  return SettingCache::get<bool>(config, key);
 }
 
 Setting<int> &
 CoreConfig::break_max_preludes(workrave::BreakId break_id)
 {
-  return SettingCache::get<int>(config, expand(CFG_KEY_BREAK_MAX_PRELUDES, break_id));
+  static const BreakKeys keys = break_keys(CFG_KEY_BREAK_MAX_PRELUDES);
+  return SettingCache::get<int>(config, keys[break_id]);
 }
 
 Setting<bool> &
 CoreConfig::break_enabled(workrave::BreakId break_id)
 {
-  return SettingCache::get<bool>(config, expand(CFG_KEY_BREAK_ENABLED, break_id));
+  static const BreakKeys keys = break_keys(CFG_KEY_BREAK_ENABLED);
+  return SettingCache::get<bool>(config, keys[break_id]);
 }
 
 Setting<int> &
 CoreConfig::monitor_noise()
 {
-  return SettingCache::get<int>(config, CFG_KEY_MONITOR_NOISE, 9000);
+  static constinit SettingKey key{CFG_KEY_MONITOR_NOISE};
+  return SettingCache::get<int>(config, key, 9000);
 }
 
 Setting<int> &
 CoreConfig::monitor_activity()
 {
-  return SettingCache::get<int>(config, CFG_KEY_MONITOR_ACTIVITY, 1000);
+  static constinit SettingKey key{CFG_KEY_MONITOR_ACTIVITY};
+  return SettingCache::get<int>(config, key, 1000);
 }
 
 Setting<int> &
 CoreConfig::monitor_idle()
 {
-  return SettingCache::get<int>(config, CFG_KEY_MONITOR_IDLE, 5000);
+  static constinit SettingKey key{CFG_KEY_MONITOR_IDLE};
+  return SettingCache::get<int>(config, key, 5000);
 }
 
 Setting<int> &
 CoreConfig::monitor_sensitivity()
 {
-  return SettingCache::get<int>(config, CFG_KEY_MONITOR_SENSITIVITY, 3);
+  static constinit SettingKey key{CFG_KEY_MONITOR_SENSITIVITY};
+  return SettingCache::get<int>(config, key, 3);
+}
+
+Setting<int> &
+CoreConfig::monitor_motion_quantum()
+{
+  static constinit SettingKey key{CFG_KEY_MONITOR_MOTION_QUANTUM};
+  return SettingCache::get<int>(config, key, 0);
 }
 
 Setting<std::string> &
 CoreConfig::general_datadir()
 {
-  return SettingCache::get<std::string>(config, CFG_KEY_GENERAL_DATADIR);
+  static constinit SettingKey key{CFG_KEY_GENERAL_DATADIR};
+  return SettingCache::get<std::string>(config, key);
 }
 
 Setting<bool> &
 CoreConfig::grpc_enabled()
 {
-  return SettingCache::get<bool>(config, CFG_KEY_GRPC_ENABLED, true);
+  static constinit SettingKey key{CFG_KEY_GRPC_ENABLED};
+  return SettingCache::get<bool>(config, key, true);
 }
 
 Setting<std::string> &
 CoreConfig::grpc_transport()
 {
-  return SettingCache::get<std::string>(config, CFG_KEY_GRPC_TRANSPORT, std::string{"unix"});
+  static constinit SettingKey key{CFG_KEY_GRPC_TRANSPORT};
+  return SettingCache::get<std::string>(config, key, std::string{"unix"});
 }
 
 Setting<int> &
 CoreConfig::grpc_port()
 {
-  return SettingCache::get<int>(config, CFG_KEY_GRPC_PORT, 50051);
+  static constinit SettingKey key{CFG_KEY_GRPC_PORT};
+  return SettingCache::get<int>(config, key, 50051);
 }
 
 bool
@@ -298,29 +328,34 @@ CoreConfig::disable_grpc_if_unix_sockets_unsupported(bool unix_sockets_supported
 Setting<int, workrave::OperationMode> &
 CoreConfig::operation_mode()
 {
-  return SettingCache::get<int, workrave::OperationMode>(config, CFG_KEY_OPERATION_MODE);
+  static constinit SettingKey key{CFG_KEY_OPERATION_MODE};
+  return SettingCache::get<int, workrave::OperationMode>(config, key);
 }
 
 Setting<int, workrave::UsageMode> &
 CoreConfig::usage_mode()
 {
-  return SettingCache::get<int, workrave::UsageMode>(config, CFG_KEY_USAGE_MODE);
+  static constinit SettingKey key{CFG_KEY_USAGE_MODE};
+  return SettingCache::get<int, workrave::UsageMode>(config, key);
 }
 
 Setting<int, std::chrono::minutes> &
 CoreConfig::operation_mode_auto_reset_duration()
 {
-  return SettingCache::get<int, std::chrono::minutes>(config, CFG_KEY_OPERATION_MODE_RESET_DURATION);
+  static constinit SettingKey key{CFG_KEY_OPERATION_MODE_RESET_DURATION};
+  return SettingCache::get<int, std::chrono::minutes>(config, key);
 }
 
 Setting<int64_t, std::chrono::system_clock::time_point> &
 CoreConfig::operation_mode_auto_reset_time()
 {
-  return SettingCache::get<int64_t, std::chrono::system_clock::time_point>(config, CFG_KEY_OPERATION_MODE_RESET_TIME);
+  static constinit SettingKey key{CFG_KEY_OPERATION_MODE_RESET_TIME};
+  return SettingCache::get<int64_t, std::chrono::system_clock::time_point>(config, key);
 }
 
 Setting<std::vector<int>, std::vector<std::chrono::minutes>> &
 CoreConfig::operation_mode_auto_reset_options()
 {
-  return SettingCache::get<std::vector<int>, std::vector<std::chrono::minutes>>(config, CFG_KEY_OPERATION_MODE_RESET_OPTIONS);
+  static constinit SettingKey key{CFG_KEY_OPERATION_MODE_RESET_OPTIONS};
+  return SettingCache::get<std::vector<int>, std::vector<std::chrono::minutes>>(config, key);
 }
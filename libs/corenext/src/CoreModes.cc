@@ -19,7 +19,9 @@
 #  include "config.h"
 #endif
 
+#include <algorithm>
 #include <chrono>
+#include <utility>
 
 #include <spdlog/spdlog.h>
 #include <spdlog/fmt/ostr.h>
@@ -29,16 +31,18 @@
 #include "CoreModes.hh"
 #include "core/CoreTypes.hh"
 #include "core/CoreConfig.hh"
+#include "config/ConfigTransaction.hh"
 #include "utils/TimeSource.hh"
 
 using namespace std;
 using namespace workrave;
 
-CoreModes::CoreModes(IActivityMonitor::Ptr monitor)
+CoreModes::CoreModes(IActivityMonitor::Ptr monitor, workrave::config::IConfigurator::Ptr config)
   : operation_mode_active(OperationMode::Normal)
   , operation_mode_regular(OperationMode::Normal)
   , usage_mode(UsageMode::Normal)
   , monitor(monitor)
+  , config(std::move(config))
 {
   TRACE_ENTRY();
   load_config();
@@ -93,8 +97,7 @@ CoreModes::set_operation_mode(OperationMode mode)
   using namespace std::chrono_literals;
 
   set_operation_mode_internal(mode);
-  CoreConfig::operation_mode_auto_reset_duration().set(0min);
-  CoreConfig::operation_mode_auto_reset_time().set(std::chrono::system_clock::time_point{});
+  set_operation_mode_auto_reset(0min);
 }
 
 void
@@ -103,15 +106,29 @@ CoreModes::set_operation_mode_for(OperationMode mode, std::chrono::minutes durat
   using namespace std::chrono_literals;
 
   set_operation_mode_internal(mode);
-  CoreConfig::operation_mode_auto_reset_duration().set(duration);
+  set_operation_mode_auto_reset(duration);
+}
+
+//! Stores when the operation mode goes back to normal.
+/*!
+ *  The duration and the time it runs out are written together, so that
+ *  nobody reading the configuration ever sees one without the other.
+ */
+void
+CoreModes::set_operation_mode_auto_reset(std::chrono::minutes duration)
+{
+  using namespace std::chrono_literals;
+
+  std::chrono::system_clock::time_point reset_time{};
   if (duration > 0min)
     {
-      CoreConfig::operation_mode_auto_reset_time().set(workrave::utils::TimeSource::get_real_time() + duration);
-    }
-  else
-    {
-      CoreConfig::operation_mode_auto_reset_time().set(std::chrono::system_clock::time_point{});
+      reset_time = workrave::utils::TimeSource::get_real_time() + duration;
     }
+
+  workrave::config::ConfigTransaction transaction(config);
+  CoreConfig::operation_mode_auto_reset_duration().set(transaction, duration);
+  CoreConfig::operation_mode_auto_reset_time().set(transaction, reset_time);
+  transaction.commit();
 }
 
 //! Temporarily overrides the operation mode.
@@ -259,6 +276,21 @@ CoreModes::heartbeat()
   check_auto_reset();
 }
 
+//! Returns the monotonic time, in seconds, of the pending operation mode reset, or 0 if there is none.
+int64_t
+CoreModes::get_next_heartbeat_time() const
+{
+  auto next_reset_time = CoreConfig::operation_mode_auto_reset_time()();
+
+  if ((next_reset_time.time_since_epoch().count() <= 0) || (CoreConfig::operation_mode()() == OperationMode::Normal))
+    {
+      return 0;
+    }
+
+  auto remaining = std::chrono::ceil<std::chrono::seconds>(next_reset_time - workrave::utils::TimeSource::get_real_time());
+  return workrave::utils::TimeSource::get_monotonic_time_sec_sync() + std::max(remaining.count(), int64_t{0});
+}
+
 //! Performs a reset when the daily limit is reached.
 void
 CoreModes::daily_reset()
@@ -27,6 +27,8 @@
 
 #include "IActivityMonitor.hh"
 
+#include "config/IConfigurator.hh"
+
 #include "core/CoreTypes.hh"
 #include "utils/Signals.hh"
 
@@ -35,7 +37,7 @@ class CoreModes : public workrave::utils::Trackable
 public:
   using Ptr = std::shared_ptr<CoreModes>;
 
-  explicit CoreModes(IActivityMonitor::Ptr monitor);
+  CoreModes(IActivityMonitor::Ptr monitor, workrave::config::IConfigurator::Ptr config);
   virtual ~CoreModes();
 
   boost::signals2::signal<void(workrave::OperationMode)> &signal_operation_mode_changed();
@@ -51,10 +53,12 @@ public:
   workrave::UsageMode get_usage_mode();
   void set_usage_mode(workrave::UsageMode mode);
   void heartbeat();
+  int64_t get_next_heartbeat_time() const;
   void daily_reset();
 
 private:
   void set_operation_mode_internal(workrave::OperationMode mode);
+  void set_operation_mode_auto_reset(std::chrono::minutes duration);
   void update_active_operation_mode();
   void set_usage_mode_internal(workrave::UsageMode mode, bool persistent);
   void load_config();
@@ -76,6 +80,9 @@ private:
   //!
   IActivityMonitor::Ptr monitor;
 
+  //! The configuration, for writing several settings at once.
+  workrave::config::IConfigurator::Ptr config;
+
   //! Operation mode changed notification.
   boost::signals2::signal<void(workrave::OperationMode)> operation_mode_changed_signal;
 
@@ -18,7 +18,10 @@
 #ifndef IACTIVITYMONITOR_HH
 #define IACTIVITYMONITOR_HH
 
+#include <boost/signals2.hpp>
+
 #include "config/Config.hh"
+#include "input-monitor/IInputMonitor.hh"
 
 class IActivityMonitorListener
 {
@@ -46,6 +49,12 @@ public:
   virtual void force_idle() = 0;
   virtual bool is_active() = 0;
   virtual void set_listener(IActivityMonitorListener::Ptr l) = 0;
+
+  //! Emitted, possibly from the thread that reported the input, when the user becomes active.
+  virtual boost::signals2::signal<void()> &signal_activity_started() = 0;
+
+  //! Returns the event counters of the underlying input monitor.
+  [[nodiscard]] virtual workrave::input_monitor::IInputMonitor::Statistics get_input_statistics() const = 0;
 };
 
 #endif // IACTIVITYMONITOR_HH
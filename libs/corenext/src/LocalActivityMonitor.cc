@@ -22,7 +22,9 @@
 
 #include "LocalActivityMonitor.hh"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <utility>
@@ -58,6 +60,7 @@ LocalActivityMonitor::init()
   input_monitor = InputMonitorFactory::create_monitor();
   if (input_monitor != nullptr)
     {
+      input_monitor->set_motion_coalescing(std::chrono::milliseconds(motion_quantum), sensitivity.load());
       input_monitor->subscribe(this);
     }
 }
@@ -77,187 +80,235 @@ LocalActivityMonitor::terminate()
 void
 LocalActivityMonitor::suspend()
 {
-  TRACE_ENTRY_PAR(state);
-  lock.lock();
-  state = ACTIVITY_MONITOR_SUSPENDED;
-  lock.unlock();
-  TRACE_VAR(state);
+  TRACE_ENTRY_PAR(state.load());
+  state.store(ACTIVITY_MONITOR_SUSPENDED);
+  TRACE_VAR(state.load());
 }
 
 //! Resumes the activity monitoring.
 void
 LocalActivityMonitor::resume()
 {
-  TRACE_ENTRY_PAR(state);
-  lock.lock();
-  state = ACTIVITY_MONITOR_IDLE;
-  lock.unlock();
-  TRACE_VAR(state);
+  TRACE_ENTRY_PAR(state.load());
+  state.store(ACTIVITY_MONITOR_IDLE);
+  TRACE_VAR(state.load());
 }
 
 //! Forces state te be idle.
 void
 LocalActivityMonitor::force_idle()
 {
-  TRACE_ENTRY_PAR(state);
-  lock.lock();
-  if (state != ACTIVITY_MONITOR_SUSPENDED)
+  TRACE_ENTRY_PAR(state.load());
+  LocalActivityMonitorState current = state.load();
+  while (current != ACTIVITY_MONITOR_SUSPENDED)
     {
-      state = ACTIVITY_MONITOR_FORCED_IDLE;
-      last_action_time = 0;
+      if (state.compare_exchange_weak(current, ACTIVITY_MONITOR_FORCED_IDLE))
+        {
+          last_action_time.store(0, std::memory_order_relaxed);
+          break;
+        }
     }
-  lock.unlock();
-  TRACE_VAR(state);
+  TRACE_VAR(state.load());
 }
 
 bool
 LocalActivityMonitor::is_active()
 {
   process_state();
-  return state == ACTIVITY_MONITOR_ACTIVE;
+  return state.load() == ACTIVITY_MONITOR_ACTIVE;
 }
 
 void
 LocalActivityMonitor::process_state()
 {
-  TRACE_ENTRY_PAR(state);
-  lock.lock();
-
   // First update the state...
-  if (state == ACTIVITY_MONITOR_ACTIVE)
+  LocalActivityMonitorState current = ACTIVITY_MONITOR_ACTIVE;
+  if (state.load() == current)
     {
-      int64_t tv = TimeSource::get_monotonic_time_usec() - last_action_time;
-
-      TRACE_MSG("Active: {} {}", tv, idle_threshold);
-      if (tv > idle_threshold)
+      if (!is_recently_active())
         {
-          // No longer active.
-          state = ACTIVITY_MONITOR_IDLE;
+          // No longer active. Fails harmlessly if the input thread got there first.
+          if (state.compare_exchange_strong(current, ACTIVITY_MONITOR_IDLE) && is_recently_active())
+            {
+              // Input arrived after the check above, but saw ACTIVE and so left
+              // the state alone. Undo, unless the state has moved on again.
+              current = ACTIVITY_MONITOR_IDLE;
+              state.compare_exchange_strong(current, ACTIVITY_MONITOR_ACTIVE);
+            }
         }
     }
 
-  lock.unlock();
-  TRACE_VAR(state);
+  publish_statistics();
+}
+
+//! Returns whether there was input within the idle threshold.
+bool
+LocalActivityMonitor::is_recently_active() const
+{
+  // Sequentially consistent, like the store in action_notify(): input that
+  // read ACTIVE before process_state() replaced it is seen here afterwards.
+  int64_t last = last_action_time.load();
+  if (input_monitor != nullptr)
+    {
+      // Include motion that was coalesced while active.
+      last = std::max(last, input_monitor->get_last_motion_time());
+    }
+
+  return TimeSource::get_monotonic_time_usec() - last <= idle_threshold.load(std::memory_order_relaxed);
+}
+
+//! Returns the input monitor event counters.
+IInputMonitor::Statistics
+LocalActivityMonitor::get_input_statistics() const
+{
+  if (input_monitor == nullptr)
+    {
+      return {};
+    }
+  return input_monitor->get_statistics();
+}
+
+//! Publishes the input monitor event counters to the debug dialog.
+void
+LocalActivityMonitor::publish_statistics()
+{
+  const auto statistics = get_input_statistics();
+  events_received = statistics.events_received;
+  events_forwarded = statistics.events_forwarded;
+  events_received.publish();
+  events_forwarded.publish();
 }
 
 //! Sets the operation parameters.
 void
 LocalActivityMonitor::set_parameters(int noise, int activity, int idle, int sensitivity)
 {
-  noise_threshold = static_cast<int64_t>(noise) * 1000;
-  activity_threshold = static_cast<int64_t>(activity) * 1000;
-  idle_threshold = static_cast<int64_t>(idle) * 1000;
+  std::scoped_lock guard(config_lock);
+  noise_threshold.store(static_cast<int64_t>(noise) * 1000);
+  activity_threshold.store(static_cast<int64_t>(activity) * 1000);
+  idle_threshold.store(static_cast<int64_t>(idle) * 1000);
 
-  this->sensitivity = sensitivity;
+  this->sensitivity.store(sensitivity);
 
   // The easy way out.
-  state = ACTIVITY_MONITOR_IDLE;
+  state.store(ACTIVITY_MONITOR_IDLE);
 }
 
 //! Sets the operation parameters.
 void
 LocalActivityMonitor::get_parameters(int &noise, int &activity, int &idle, int &sensitivity) const
 {
-  noise = static_cast<int>(noise_threshold / 1000);
-  activity = static_cast<int>(activity_threshold / 1000);
-  idle = static_cast<int>(idle_threshold / 1000);
-  sensitivity = this->sensitivity;
+  noise = static_cast<int>(noise_threshold.load() / 1000);
+  activity = static_cast<int>(activity_threshold.load() / 1000);
+  idle = static_cast<int>(idle_threshold.load() / 1000);
+  sensitivity = this->sensitivity.load();
 }
 
 //! Sets the callback listener.
 void
 LocalActivityMonitor::set_listener(IActivityMonitorListener::Ptr l)
 {
-  lock.lock();
+  std::scoped_lock guard(config_lock);
   listener = l;
-  lock.unlock();
+  has_listener.store(listener != nullptr);
+}
+
+//! Returns the signal fired when the user becomes active.
+boost::signals2::signal<void()> &
+LocalActivityMonitor::signal_activity_started()
+{
+  return activity_started_signal;
 }
 
 //! Activity is reported by the input monitor.
+//
+// Only the input monitor thread calls this, so first_action_time needs no
+// synchronization. last_action_time is stored before the state is read, and
+// process_state() reads it again after moving ACTIVE to IDLE, so input that
+// finds the state still ACTIVE is never lost. The main thread may move the
+// state to IDLE, FORCED_IDLE or SUSPENDED meanwhile; a failed
+// compare-and-swap re-evaluates the transition against the state that won.
 void
 LocalActivityMonitor::action_notify()
 {
-  lock.lock();
-  int64_t now = TimeSource::get_monotonic_time_usec();
+  const int64_t now = TimeSource::get_monotonic_time_usec();
+  const int64_t previous_action_time = last_action_time.exchange(now);
 
-  switch (state)
+  LocalActivityMonitorState current = state.load();
+  LocalActivityMonitorState next = current;
+  do
     {
-    case ACTIVITY_MONITOR_IDLE:
-    case ACTIVITY_MONITOR_FORCED_IDLE:
-      {
-        first_action_time = now;
-        last_action_time = now;
-
-        if (activity_threshold == 0)
-          {
-            state = ACTIVITY_MONITOR_ACTIVE;
-          }
-        else
-          {
-            state = ACTIVITY_MONITOR_NOISE;
-          }
-      }
-      break;
-
-    case ACTIVITY_MONITOR_NOISE:
-      {
-        int64_t tv = now - last_action_time;
-
-        if (tv > noise_threshold)
+      next = current;
+      switch (current)
+        {
+        case ACTIVITY_MONITOR_IDLE:
+        case ACTIVITY_MONITOR_FORCED_IDLE:
           {
             first_action_time = now;
+            const bool immediate = activity_threshold.load(std::memory_order_relaxed) == 0;
+            next = immediate ? ACTIVITY_MONITOR_ACTIVE : ACTIVITY_MONITOR_NOISE;
           }
-        else
+          break;
+
+        case ACTIVITY_MONITOR_NOISE:
           {
-            tv = now - first_action_time;
-            if (tv >= activity_threshold)
+            if (now - previous_action_time > noise_threshold.load(std::memory_order_relaxed))
               {
-                state = ACTIVITY_MONITOR_ACTIVE;
+                first_action_time = now;
+              }
+            else if (now - first_action_time >= activity_threshold.load(std::memory_order_relaxed))
+              {
+                next = ACTIVITY_MONITOR_ACTIVE;
               }
           }
-      }
-      break;
+          break;
 
-    default:
-      break;
+        default:
+          break;
+        }
     }
+  while (next != current && !state.compare_exchange_weak(current, next));
 
-  last_action_time = now;
-  lock.unlock();
+  if (next == ACTIVITY_MONITOR_ACTIVE && current != ACTIVITY_MONITOR_ACTIVE)
+    {
+      activity_started_signal();
+    }
   call_listener();
 }
 
+//! Returns whether a mouse event is more than jitter, and records the position.
+bool
+LocalActivityMonitor::is_significant_motion(int x, int y, int wheel_delta)
+{
+  const uint64_t previous = prev_position.exchange(pack_position(x, y), std::memory_order_relaxed);
+  const int delta_x = x - static_cast<int32_t>(previous >> 32);
+  const int delta_y = y - static_cast<int32_t>(previous & 0xffffffffU);
+  const int threshold = sensitivity.load(std::memory_order_relaxed);
+
+  return abs(delta_x) >= threshold || abs(delta_y) >= threshold || wheel_delta != 0
+         || button_is_pressed.load(std::memory_order_relaxed);
+}
+
 //! Mouse activity is reported by the input monitor.
 void
 LocalActivityMonitor::mouse_notify(int x, int y, int wheel_delta)
 {
-  lock.lock();
-  const int delta_x = x - prev_x;
-  const int delta_y = y - prev_y;
-  prev_x = x;
-  prev_y = y;
-
-  if (abs(delta_x) >= sensitivity || abs(delta_y) >= sensitivity || wheel_delta != 0 || button_is_pressed)
+  if (is_significant_motion(x, y, wheel_delta))
     {
       action_notify();
     }
-  lock.unlock();
 }
 
 //! Mouse button activity is reported by the input monitor.
 void
 LocalActivityMonitor::button_notify(bool is_press)
 {
-  lock.lock();
-
-  button_is_pressed = is_press;
+  button_is_pressed.store(is_press, std::memory_order_relaxed);
 
   if (is_press)
     {
       action_notify();
     }
-
-  lock.unlock();
 }
 
 //! Keyboard activity is reported by the input monitor.
@@ -266,30 +317,43 @@ LocalActivityMonitor::keyboard_notify(bool repeat)
 {
   (void)repeat;
 
-  lock.lock();
   action_notify();
-  lock.unlock();
+}
+
+//! Motion only moves last_action_time while active, which the coalescer tracks.
+bool
+LocalActivityMonitor::is_motion_coalescable()
+{
+  return state.load(std::memory_order_relaxed) == ACTIVITY_MONITOR_ACTIVE;
 }
 
 //! Calls the callback listener.
 void
 LocalActivityMonitor::call_listener()
 {
-  IActivityMonitorListener::Ptr l;
+  if (!has_listener.load())
+    {
+      return;
+    }
 
-  lock.lock();
-  l = listener;
-  lock.unlock();
+  IActivityMonitorListener::Ptr l;
+  {
+    std::scoped_lock guard(config_lock);
+    l = listener;
+  }
 
   if (l)
     {
       // Listener is set.
       if (!l->action_notify())
         {
-          // Remove listener.
-          lock.lock();
-          listener.reset();
-          lock.unlock();
+          // Remove listener, unless it was replaced in the meantime.
+          std::scoped_lock guard(config_lock);
+          if (listener == l)
+            {
+              listener.reset();
+              has_listener.store(false);
+            }
         }
     }
 }
@@ -303,6 +367,7 @@ LocalActivityMonitor::load_config()
   int activity = CoreConfig::monitor_activity()();
   int idle = CoreConfig::monitor_idle()();
   int sensitivity = CoreConfig::monitor_sensitivity()();
+  motion_quantum = std::max(0, CoreConfig::monitor_motion_quantum()());
 
   // Pre 1.0 compatibility...
   if (noise < 50)
@@ -323,9 +388,14 @@ LocalActivityMonitor::load_config()
       CoreConfig::monitor_idle().set(noise);
     }
 
-  TRACE_MSG("Monitor config = {} {} {} {}", noise, activity, idle, sensitivity);
+  TRACE_MSG("Monitor config = {} {} {} {} {}", noise, activity, idle, sensitivity, motion_quantum);
 
   set_parameters(noise, activity, idle, sensitivity);
+
+  if (input_monitor != nullptr)
+    {
+      input_monitor->set_motion_coalescing(std::chrono::milliseconds(motion_quantum), sensitivity);
+    }
 }
 
 // TODO: implement somewhere else:
@@ -18,13 +18,14 @@
 #ifndef LOCALACTIVITYMONITOR_HH
 #define LOCALACTIVITYMONITOR_HH
 
-#include <thread>
+#include <atomic>
 #include <mutex>
 
 #include "IActivityMonitor.hh"
 
 #include "config/Config.hh"
 #include "utils/TimeSource.hh"
+#include "utils/Diagnostics.hh"
 #include "utils/Signals.hh"
 #include "utils/Enum.hh"
 #include "input-monitor/IInputMonitor.hh"
@@ -46,21 +47,28 @@ public:
   void force_idle() override;
   bool is_active() override;
   void set_listener(IActivityMonitorListener::Ptr l) override;
+  boost::signals2::signal<void()> &signal_activity_started() override;
+
+  workrave::input_monitor::IInputMonitor::Statistics get_input_statistics() const override;
 
   // IInputMonitorListener
   void action_notify() override;
   void mouse_notify(int x, int y, int wheel = 0) override;
   void button_notify(bool is_press) override;
   void keyboard_notify(bool repeat) override;
+  bool is_motion_coalescable() override;
 
 private:
   void call_listener();
+  void publish_statistics();
 
   void load_config();
   void set_parameters(int noise, int activity, int idle, int sensitivity);
   void get_parameters(int &noise, int &activity, int &idle, int &sensitivity) const;
 
   void process_state();
+  bool is_recently_active() const;
+  bool is_significant_motion(int x, int y, int wheel_delta);
 
   //! State of the activity monitor.
   enum LocalActivityMonitorState
@@ -82,42 +90,63 @@ private:
   //! The actual monitoring driver.
   workrave::input_monitor::IInputMonitor::Ptr input_monitor;
 
-  //! the current state.
-  LocalActivityMonitorState state{ACTIVITY_MONITOR_IDLE};
-
-  //! Internal locking
-  std::recursive_mutex lock;
+  //! The current state.
+  //
+  // Advanced by the input monitor thread (the single producer) in
+  // action_notify(). The main thread only moves it to IDLE, FORCED_IDLE or
+  // SUSPENDED, using compare-and-swap so that no transition is lost.
+  std::atomic<LocalActivityMonitorState> state{ACTIVITY_MONITOR_IDLE};
 
-  //! Previous X coordinate
-  int prev_x{-10};
+  //! Serializes configuration and listener changes. Never taken per input event.
+  std::mutex config_lock;
 
-  //! Previous Y coordinate
-  int prev_y{-10};
+  //! Previous mouse coordinates, X in the high and Y in the low 32 bits.
+  std::atomic<uint64_t> prev_position{pack_position(-10, -10)};
 
   //! Is the button currently pressed?
-  bool button_is_pressed{false};
+  std::atomic<bool> button_is_pressed{false};
 
   //! Last time activity was detected
-  int64_t last_action_time{0};
+  std::atomic<int64_t> last_action_time{0};
 
-  //! First time the \c ACTIVITY_IDLE state was left.
+  //! First time the \c ACTIVITY_IDLE state was left. Only used by the producer.
   int64_t first_action_time{0};
 
   //! The noise threshold
-  int64_t noise_threshold{1 * workrave::utils::TimeSource::TIME_USEC_PER_SEC};
+  std::atomic<int64_t> noise_threshold{1 * workrave::utils::TimeSource::TIME_USEC_PER_SEC};
 
   //! The activity threshold.
-  int64_t activity_threshold{2 * workrave::utils::TimeSource::TIME_USEC_PER_SEC};
+  std::atomic<int64_t> activity_threshold{2 * workrave::utils::TimeSource::TIME_USEC_PER_SEC};
 
   //! The idle threshold.
-  int64_t idle_threshold{5 * workrave::utils::TimeSource::TIME_USEC_PER_SEC};
+  std::atomic<int64_t> idle_threshold{5 * workrave::utils::TimeSource::TIME_USEC_PER_SEC};
 
   //! Mouse sensitivity
-  int sensitivity{3};
+  std::atomic<int> sensitivity{3};
+
+  //! Mouse motion coalescing quantum in milliseconds, 0 when disabled.
+  int motion_quantum{0};
+
+  //! Input events reported by the input monitor.
+  TracedField<uint64_t> events_received{"monitor.events_received", 0, true};
+
+  //! Input events that reached this monitor after coalescing.
+  TracedField<uint64_t> events_forwarded{"monitor.events_forwarded", 0, true};
+
+  //! Is a listener set? Lets the input path skip config_lock when there is none.
+  std::atomic<bool> has_listener{false};
 
   //! Activity listener.
   IActivityMonitorListener::Ptr listener;
 
+  //! Fired when the state becomes active.
+  boost::signals2::signal<void()> activity_started_signal;
+
+  static constexpr uint64_t pack_position(int x, int y)
+  {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+  }
+
   friend struct workrave::utils::enum_traits<LocalActivityMonitor::LocalActivityMonitorState>;
 };
 
@@ -25,6 +25,7 @@
 
 #include <spdlog/spdlog.h>
 
+#include "rpc/Executor.hh"
 #include "rpc/RpcServer.hh"
 
 #include "Core.hh"
@@ -37,10 +38,12 @@ struct RpcCoreServer::Impl
   Impl(Core &core,
        rpc::InstanceRegistry<workrave::BreakId, Break> &break_registry,
        workrave::config::IConfigurator &configurator,
-       std::string listen_address)
-    : core_service(core)
-    , break_service(break_registry)
-    , config_service(configurator)
+       std::string listen_address,
+       std::function<void()> calls_pending)
+    : executor(std::move(calls_pending))
+    , core_service(core, executor)
+    , break_service(break_registry, executor)
+    , config_service(configurator, executor)
     , server(rpc::ServerConfig{.listen_address = listen_address})
   {
     server.register_service(core_service);
@@ -62,6 +65,9 @@ struct RpcCoreServer::Impl
 
   ~Impl()
   {
+    // Shutting down waits for running handlers, which may be waiting for
+    // this very thread.
+    executor.close();
     server.shutdown();
   }
 
@@ -70,6 +76,9 @@ struct RpcCoreServer::Impl
   Impl(Impl &&) = delete;
   Impl &operator=(Impl &&) = delete;
 
+  // Core, Break and the Configurator belong to the main loop; every call
+  // is run there.
+  rpc::LoopExecutor executor;
   workrave::core::rpc::CoreService core_service;
   workrave::core::rpc::BreakService break_service;
   workrave::config::rpc::ConfigService config_service;
@@ -79,8 +88,9 @@ struct RpcCoreServer::Impl
 RpcCoreServer::RpcCoreServer(Core &core,
                               rpc::InstanceRegistry<workrave::BreakId, Break> &break_registry,
                               workrave::config::IConfigurator &configurator,
-                              std::string listen_address)
-  : impl_(std::make_unique<Impl>(core, break_registry, configurator, std::move(listen_address)))
+                              std::string listen_address,
+                              std::function<void()> calls_pending)
+  : impl_(std::make_unique<Impl>(core, break_registry, configurator, std::move(listen_address), std::move(calls_pending)))
 {
 }
 
@@ -91,3 +101,9 @@ RpcCoreServer::bound_port() const
 {
   return impl_->server.bound_port();
 }
+
+void
+RpcCoreServer::dispatch_pending_calls()
+{
+  impl_->executor.drain();
+}
@@ -18,6 +18,7 @@
 #ifndef WORKRAVE_CORENEXT_RPCCORESERVER_HH
 #define WORKRAVE_CORENEXT_RPCCORESERVER_HH
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -60,7 +61,8 @@ public:
   RpcCoreServer(Core &core,
                 rpc::InstanceRegistry<workrave::BreakId, Break> &break_registry,
                 workrave::config::IConfigurator &configurator,
-                std::string listen_address);
+                std::string listen_address,
+                std::function<void()> calls_pending);
   ~RpcCoreServer();
 
   RpcCoreServer(const RpcCoreServer &) = delete;
@@ -68,6 +70,9 @@ public:
 
   [[nodiscard]] int bound_port() const;
 
+  //! Runs the calls queued since calls_pending was last invoked. Main thread only.
+  void dispatch_pending_calls();
+
 private:
   struct Impl;
   std::unique_ptr<Impl> impl_;
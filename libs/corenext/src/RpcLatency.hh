@@ -0,0 +1,45 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef RPCLATENCY_HH
+#define RPCLATENCY_HH
+
+#include <cstdint>
+#include <string>
+
+namespace workrave
+{
+  //! Call count and latency of one gRPC method since startup, in microseconds.
+  /*!
+   *  Percentiles are bucket upper bounds, at most 12.5% above the true value
+   *  (see rpc::LatencyHistogram).
+   */
+  struct RpcLatency
+  {
+    std::string service;
+    std::string method;
+    int64_t calls{0};
+    int64_t failed{0};
+    int64_t mean_usec{0};
+    int64_t p50_usec{0};
+    int64_t p90_usec{0};
+    int64_t p99_usec{0};
+    int64_t max_usec{0};
+  };
+} // namespace workrave
+
+#endif // RPCLATENCY_HH
@@ -28,6 +28,7 @@
 #include "debug.hh"
 #include "utils/TimeSource.hh"
 
+#include <algorithm>
 #include <sstream>
 #include <ctime>
 #include <utility>
@@ -389,6 +390,31 @@ Timer::is_running() const
   return timer_state == STATE_RUNNING;
 }
 
+//! Returns the monotonic time, in seconds, of the next limit or reset, or 0 if none is due.
+int64_t
+Timer::get_next_event_time() const
+{
+  int64_t next = 0;
+  auto consider = [&next](int64_t time) {
+    if (time != 0 && (next == 0 || time < next))
+      {
+        next = time;
+      }
+  };
+
+  consider(next_limit_time);
+  consider(next_reset_time);
+
+  if ((daily_auto_reset != nullptr) && next_daily_reset_time != 0)
+    {
+      // The daily reset follows the wall clock.
+      int64_t remaining = next_daily_reset_time - TimeSource::get_real_time_sec_sync();
+      consider(TimeSource::get_monotonic_time_sec_sync() + std::max(remaining, int64_t{0}));
+    }
+
+  return next;
+}
+
 bool
 Timer::is_enabled() const
 {
@@ -501,14 +527,27 @@ Timer::get_id() const
   return timer_id;
 }
 
+Timer::SavedState
+Timer::get_saved_state() const
+{
+  SavedState state;
+  state.save_time = TimeSource::get_real_time_sec_sync();
+  state.elapsed = get_elapsed_time();
+  state.last_reset = last_daily_reset_time;
+  state.overdue = total_overdue_timespan;
+  state.snooze_inhibited = snooze_inhibited;
+  state.last_limit_elapsed = elapsed_timespan_at_last_limit;
+  return state;
+}
+
 std::string
 Timer::serialize_state() const
 {
-  stringstream ss;
+  const SavedState state = get_saved_state();
 
-  ss << timer_id << " " << TimeSource::get_real_time_sec_sync() << " " << get_elapsed_time() << " " << last_daily_reset_time
-     << " " << total_overdue_timespan << " " << snooze_inhibited << " " << 0 << " " << elapsed_timespan_at_last_limit << " "
-     << 0 /* timezone */;
+  stringstream ss;
+  ss << timer_id << " " << state.save_time << " " << state.elapsed << " " << state.last_reset << " " << state.overdue << " "
+     << state.snooze_inhibited << " " << state.last_limit_time << " " << state.last_limit_elapsed << " " << state.timezone;
 
   return ss.str();
 }
@@ -516,42 +555,44 @@ Timer::serialize_state() const
 bool
 Timer::deserialize_state(const std::string &state, int version)
 {
-  TRACE_ENTRY();
   istringstream ss(state);
 
-  int64_t save_time = 0;
-  int64_t elapsed = 0;
-  int64_t last_reset = 0;
-  int64_t overdue = 0;
-  int64_t llt = 0;
-  int64_t lle = 0;
-  bool si = false;
-
-  ss >> save_time >> elapsed >> last_reset >> overdue >> si >> llt >> lle;
+  SavedState saved;
+  ss >> saved.save_time >> saved.elapsed >> saved.last_reset >> saved.overdue >> saved.snooze_inhibited >> saved.last_limit_time
+    >> saved.last_limit_elapsed;
 
   if (version == 3)
     {
       // Ignored.
-      int64_t tz = 0;
-      ss >> tz;
+      ss >> saved.timezone;
     }
 
+  restore_saved_state(saved);
+  return true;
+}
+
+void
+Timer::restore_saved_state(const SavedState &state)
+{
+  TRACE_ENTRY();
+  int64_t last_reset = state.last_reset;
+
   // Sanity check...
-  if (last_reset > save_time)
+  if (last_reset > state.save_time)
     {
-      last_reset = save_time;
+      last_reset = state.save_time;
     }
 
-  TRACE_VAR(si, llt, lle);
+  TRACE_VAR(state.snooze_inhibited, state.last_limit_time, state.last_limit_elapsed);
   TRACE_VAR(snooze_inhibited);
 
   last_daily_reset_time = last_reset;
-  total_overdue_timespan = overdue;
+  total_overdue_timespan = state.overdue;
   elapsed_timespan = 0;
   last_start_time = 0;
   last_stop_time = 0;
 
-  bool tooOld = (is_auto_reset_enabled() && (TimeSource::get_real_time_sec_sync() - save_time > auto_reset_interval));
+  bool tooOld = (is_auto_reset_enabled() && (TimeSource::get_real_time_sec_sync() - state.save_time > auto_reset_interval));
 
   if (!tooOld)
     {
@@ -559,21 +600,20 @@ Timer::deserialize_state(const std::string &state, int version)
         {
           next_reset_time = TimeSource::get_monotonic_time_sec_sync() + auto_reset_interval;
         }
-      elapsed_timespan = elapsed;
-      snooze_inhibited = si;
+      elapsed_timespan = state.elapsed;
+      snooze_inhibited = state.snooze_inhibited;
     }
 
   // overdue, so snooze
   if (is_limit_enabled() && get_elapsed_time() >= limit_interval)
     {
-      elapsed_timespan_at_last_limit = lle;
+      elapsed_timespan_at_last_limit = state.last_limit_elapsed;
       compute_next_limit_time();
     }
 
   compute_next_daily_reset_time();
 
   TRACE_MSG("elapsed = {}", elapsed_timespan);
-  return true;
 }
 
 // void
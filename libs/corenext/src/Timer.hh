@@ -102,6 +102,7 @@ public:
   int64_t get_elapsed_idle_time() const;
   bool is_running() const;
   bool is_enabled() const;
+  int64_t get_next_event_time() const;
 
   // Auto-resetting.
   void set_auto_reset(int reset_time);
@@ -125,7 +126,22 @@ public:
   // Timer ID
   std::string get_id() const;
 
+  //! What a timer keeps across restarts.
+  struct SavedState
+  {
+    int64_t save_time{0};
+    int64_t elapsed{0};
+    int64_t last_reset{0};
+    int64_t overdue{0};
+    bool snooze_inhibited{false};
+    int64_t last_limit_time{0};
+    int64_t last_limit_elapsed{0};
+    int64_t timezone{0};
+  };
+
   // State serialization.
+  SavedState get_saved_state() const;
+  void restore_saved_state(const SavedState &state);
   std::string serialize_state() const;
   bool deserialize_state(const std::string &state, int version);
   // void set_state(int elapsed, int idle, int overdue = -1);
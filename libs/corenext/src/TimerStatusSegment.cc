@@ -0,0 +1,115 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "TimerStatusSegment.hh"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(WorkraveTimerStatusBreak) == 32);
+static_assert(sizeof(WorkraveTimerStatusSegment) == 16 + 16 + WORKRAVE_TIMER_STATUS_BREAKS * 32);
+static_assert(std::atomic_ref<uint32_t>::is_always_lock_free);
+
+TimerStatusSegment::TimerStatusSegment(std::filesystem::path path)
+  : path(std::move(path))
+{
+  // Never write into a file that readers of a previous instance still have
+  // mapped, or that a crashed instance left half-written.
+  if (::unlink(this->path.c_str()) < 0 && errno != ENOENT)
+    {
+      throw std::system_error(errno, std::generic_category(), "cannot remove " + this->path.string());
+    }
+
+  const int fd = ::open(this->path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC | O_NOFOLLOW, 0600);
+  if (fd < 0)
+    {
+      throw std::system_error(errno, std::generic_category(), "cannot create " + this->path.string());
+    }
+
+  struct stat st{};
+  void *addr = MAP_FAILED;
+  if (::fstat(fd, &st) == 0 && ::ftruncate(fd, sizeof(WorkraveTimerStatusSegment)) == 0)
+    {
+      addr = ::mmap(nullptr, sizeof(WorkraveTimerStatusSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+  const int error = errno;
+  ::close(fd);
+
+  if (addr == MAP_FAILED)
+    {
+      ::unlink(this->path.c_str());
+      throw std::system_error(error, std::generic_category(), "cannot map " + this->path.string());
+    }
+
+  device = st.st_dev;
+  inode = st.st_ino;
+
+  // The file is zero-filled; the magic number is what makes it valid.
+  segment = static_cast<WorkraveTimerStatusSegment *>(addr);
+  segment->version = WORKRAVE_TIMER_STATUS_VERSION;
+  segment->size = sizeof(WorkraveTimerStatusSegment);
+  std::atomic_ref<uint32_t>(segment->magic).store(WORKRAVE_TIMER_STATUS_MAGIC, std::memory_order_release);
+}
+
+TimerStatusSegment::~TimerStatusSegment()
+{
+  WorkraveTimerStatusData closed{};
+  publish(closed);
+
+  ::munmap(segment, sizeof(WorkraveTimerStatusSegment));
+
+  struct stat st{};
+  if (::stat(path.c_str(), &st) == 0 && st.st_dev == device && st.st_ino == inode)
+    {
+      ::unlink(path.c_str());
+    }
+}
+
+std::filesystem::path
+TimerStatusSegment::get_default_path()
+{
+  const char *runtime_dir = std::getenv("XDG_RUNTIME_DIR");
+  if (runtime_dir == nullptr || *runtime_dir == '\0')
+    {
+      return {};
+    }
+  return std::filesystem::path(runtime_dir) / WORKRAVE_TIMER_STATUS_FILENAME;
+}
+
+void
+TimerStatusSegment::publish(const WorkraveTimerStatusData &data)
+{
+  std::atomic_ref<uint32_t> sequence(segment->sequence);
+  const uint32_t seq = sequence.load(std::memory_order_relaxed);
+
+  sequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(&segment->data, &data, sizeof(data));
+  sequence.store(seq + 2, std::memory_order_release);
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef TIMERSTATUSSEGMENT_HH
+#define TIMERSTATUSSEGMENT_HH
+
+#include <filesystem>
+
+#include <sys/types.h>
+
+#include "core/TimerStatus.h"
+
+//! Writer of the shared timer status segment (see core/TimerStatus.h).
+/*!
+ *  The segment is a file that is created afresh, mapped shared and unlinked
+ *  again on destruction, unless another instance has replaced it already.
+ *  Readers that still have the old file mapped see updated == 0 and reopen it.
+ */
+class TimerStatusSegment
+{
+public:
+  //! Creates and maps the segment at path. Throws std::system_error on failure.
+  explicit TimerStatusSegment(std::filesystem::path path);
+  ~TimerStatusSegment();
+
+  TimerStatusSegment(const TimerStatusSegment &) = delete;
+  TimerStatusSegment &operator=(const TimerStatusSegment &) = delete;
+
+  //! $XDG_RUNTIME_DIR/workrave-timers, or an empty path without a runtime directory.
+  static std::filesystem::path get_default_path();
+
+  //! Replaces the contents of the segment under the sequence lock.
+  void publish(const WorkraveTimerStatusData &data);
+
+private:
+  std::filesystem::path path;
+  //! Identifies the file, which a newer instance may have replaced by now.
+  dev_t device{};
+  ino_t inode{};
+  WorkraveTimerStatusSegment *segment{nullptr};
+};
+
+#endif // TIMERSTATUSSEGMENT_HH
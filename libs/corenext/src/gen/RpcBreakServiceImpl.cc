@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcBreakServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,8 +15,9 @@ namespace workrave::core::rpc
 {
 
 
-BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &registry)
+BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &registry, ::rpc::Executor &executor)
   : registry_(registry)
+  , executor_(executor)
   , service_descriptor_anchor_(&::descriptor_table_RpcBreak_2eproto)
 {
 }
@@ -25,6 +28,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::GetNameRequest *request,
                                                             ::workrave::breaks::GetNameResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "GetName");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -32,19 +38,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.get_name();
+      auto rpc_result = executor_.run([&] { return impl_.get_name(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "GetName", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "GetName", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -52,6 +62,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::IsEnabledRequest *request,
                                                             ::workrave::breaks::IsEnabledResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "IsEnabled");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -59,19 +72,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.is_enabled();
+      auto rpc_result = executor_.run([&] { return impl_.is_enabled(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "IsEnabled", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "IsEnabled", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -79,6 +96,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::IsTimerRunningRequest *request,
                                                             ::workrave::breaks::IsTimerRunningResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "IsTimerRunning");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -86,19 +106,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.is_running();
+      auto rpc_result = executor_.run([&] { return impl_.is_running(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "IsTimerRunning", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "IsTimerRunning", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -106,6 +130,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::IsTakingRequest *request,
                                                             ::workrave::breaks::IsTakingResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "IsTaking");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -113,19 +140,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.is_taking();
+      auto rpc_result = executor_.run([&] { return impl_.is_taking(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "IsTaking", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "IsTaking", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -133,6 +164,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::IsMaxPreludesReachedRequest *request,
                                                             ::workrave::breaks::IsMaxPreludesReachedResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "IsMaxPreludesReached");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -140,19 +174,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.is_max_preludes_reached();
+      auto rpc_result = executor_.run([&] { return impl_.is_max_preludes_reached(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "IsMaxPreludesReached", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "IsMaxPreludesReached", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -160,6 +198,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::IsActiveRequest *request,
                                                             ::workrave::breaks::IsActiveResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "IsActive");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -167,19 +208,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.is_active();
+      auto rpc_result = executor_.run([&] { return impl_.is_active(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "IsActive", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "IsActive", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -187,6 +232,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::GetTimerElapsedRequest *request,
                                                             ::workrave::breaks::GetTimerElapsedResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "GetTimerElapsed");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -194,19 +242,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.get_elapsed_time();
+      auto rpc_result = executor_.run([&] { return impl_.get_elapsed_time(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "GetTimerElapsed", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "GetTimerElapsed", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -214,6 +266,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::GetTimerIdleRequest *request,
                                                             ::workrave::breaks::GetTimerIdleResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "GetTimerIdle");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -221,19 +276,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.get_elapsed_idle_time();
+      auto rpc_result = executor_.run([&] { return impl_.get_elapsed_idle_time(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "GetTimerIdle", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "GetTimerIdle", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -241,6 +300,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::GetAutoResetRequest *request,
                                                             ::workrave::breaks::GetAutoResetResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "GetAutoReset");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -248,19 +310,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.get_auto_reset();
+      auto rpc_result = executor_.run([&] { return impl_.get_auto_reset(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "GetAutoReset", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "GetAutoReset", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -268,6 +334,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::IsAutoResetEnabledRequest *request,
                                                             ::workrave::breaks::IsAutoResetEnabledResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "IsAutoResetEnabled");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -275,19 +344,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.is_auto_reset_enabled();
+      auto rpc_result = executor_.run([&] { return impl_.is_auto_reset_enabled(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "IsAutoResetEnabled", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "IsAutoResetEnabled", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -295,6 +368,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::GetLimitRequest *request,
                                                             ::workrave::breaks::GetLimitResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "GetLimit");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -302,19 +378,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.get_limit();
+      auto rpc_result = executor_.run([&] { return impl_.get_limit(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "GetLimit", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "GetLimit", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -322,6 +402,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::IsLimitEnabledRequest *request,
                                                             ::workrave::breaks::IsLimitEnabledResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "IsLimitEnabled");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -329,19 +412,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.is_limit_enabled();
+      auto rpc_result = executor_.run([&] { return impl_.is_limit_enabled(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "IsLimitEnabled", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "IsLimitEnabled", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -349,6 +436,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::GetTimerOverdueRequest *request,
                                                             ::workrave::breaks::GetTimerOverdueResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "GetTimerOverdue");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -356,19 +446,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.get_total_overdue_time();
+      auto rpc_result = executor_.run([&] { return impl_.get_total_overdue_time(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "GetTimerOverdue", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "GetTimerOverdue", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -376,6 +470,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::PostponeBreakRequest *request,
                                                             ::workrave::breaks::PostponeBreakResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "PostponeBreak");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -383,16 +480,20 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      impl_.postpone_break();
+      executor_.run([&] { impl_.postpone_break(); });
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "PostponeBreak", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "PostponeBreak", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -400,6 +501,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::SkipBreakRequest *request,
                                                             ::workrave::breaks::SkipBreakResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "SkipBreak");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -407,16 +511,20 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      impl_.skip_break();
+      executor_.run([&] { impl_.skip_break(); });
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "SkipBreak", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "SkipBreak", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -424,6 +532,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::GetTimerRemainingRequest *request,
                                                             ::workrave::breaks::GetTimerRemainingResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "GetTimerRemaining");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -431,19 +542,23 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.get_timer_remaining();
+      auto rpc_result = executor_.run([&] { return impl_.get_timer_remaining(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "GetTimerRemaining", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "GetTimerRemaining", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -451,6 +566,9 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
                                                             const ::workrave::breaks::GetBreakStateRequest *request,
                                                             ::workrave::breaks::GetBreakStateResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.BreakService", "GetBreakState");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -458,84 +576,94 @@ BreakService::BreakService(::rpc::InstanceRegistry<workrave::BreakId, Break> &re
 
 
 
-      auto rpc_result = impl_.get_break_stage();
+      auto rpc_result = executor_.run([&] { return impl_.get_break_stage(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.BreakService", "GetBreakState", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.BreakService", "GetBreakState", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
 
-::grpc::Status BreakService::BreakEvent(::grpc::ServerContext *context,
-                                                            const ::workrave::breaks::BreakEventRequest *request,
-                                                            ::grpc::ServerWriter<::workrave::breaks::BreakEventEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::breaks::BreakEventEvent> *BreakService::BreakEvent(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::breaks::BreakEventRequest *request)
 {
-
-  auto &impl_ = registry_.resolve(static_cast<workrave::BreakId>(request->id()));
-
-  ::rpc::EventQueue<::workrave::breaks::BreakEventEvent> queue;
-  auto connection = impl_.signal_break_event().connect(
-    [&queue](workrave::BreakEvent value)
+  try
     {
-      ::workrave::breaks::BreakEventEvent event;
 
-      event.set_value(static_cast<::workrave::breaks::BreakEvent>(value));
+      const auto id = static_cast<workrave::BreakId>(request->id());
+      auto &impl_ = registry_.resolve(id);
+
+      return signal_break_event_broadcaster_.subscribe(
+        id,
+        [&impl_](auto &events)
+        {
+          return impl_.signal_break_event().connect(
+            [&events](workrave::BreakEvent value)
+            {
+              ::workrave::breaks::BreakEventEvent event;
 
-      queue.push(event);
-    });
+              event.set_value(static_cast<::workrave::breaks::BreakEvent>(value));
 
-  ::workrave::breaks::BreakEventEvent event;
-  while (queue.wait_and_pop(event, context))
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
     {
-      if (!writer->Write(event))
-        {
-          break;
-        }
+      return ::rpc::reject_stream<::workrave::breaks::BreakEventEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::breaks::BreakEventEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
-
-  connection.disconnect();
-  return ::grpc::Status::OK;
 }
 
 
-::grpc::Status BreakService::BreakStateChanged(::grpc::ServerContext *context,
-                                                            const ::workrave::breaks::BreakStateChangedRequest *request,
-                                                            ::grpc::ServerWriter<::workrave::breaks::BreakStateChangedEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::breaks::BreakStateChangedEvent> *BreakService::BreakStateChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::breaks::BreakStateChangedRequest *request)
 {
-
-  auto &impl_ = registry_.resolve(static_cast<workrave::BreakId>(request->id()));
-
-  ::rpc::EventQueue<::workrave::breaks::BreakStateChangedEvent> queue;
-  auto connection = impl_.signal_break_stage_changed().connect(
-    [&queue](BreakStage value)
+  try
     {
-      ::workrave::breaks::BreakStateChangedEvent event;
 
-      event.set_value(static_cast<::workrave::breaks::BreakStage>(value));
+      const auto id = static_cast<workrave::BreakId>(request->id());
+      auto &impl_ = registry_.resolve(id);
+
+      return signal_break_stage_changed_broadcaster_.subscribe(
+        id,
+        [&impl_](auto &events)
+        {
+          return impl_.signal_break_stage_changed().connect(
+            [&events](BreakStage value)
+            {
+              ::workrave::breaks::BreakStateChangedEvent event;
 
-      queue.push(event);
-    });
+              event.set_value(static_cast<::workrave::breaks::BreakStage>(value));
 
-  ::workrave::breaks::BreakStateChangedEvent event;
-  while (queue.wait_and_pop(event, context))
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
     {
-      if (!writer->Write(event))
-        {
-          break;
-        }
+      return ::rpc::reject_stream<::workrave::breaks::BreakStateChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::breaks::BreakStateChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
-
-  connection.disconnect();
-  return ::grpc::Status::OK;
 }
 
 
@@ -7,17 +7,19 @@
 #include "Core.hh"
 
 
-#include "rpc/EventQueue.hh"
+#include "rpc/EventBroadcaster.hh"
 
+#include "rpc/Executor.hh"
 
 
 namespace workrave::core::rpc
 {
-class CoreService final : public ::workrave::rpc::CoreService::Service
+class CoreService final : public ::workrave::rpc::CoreService::WithCallbackMethod_OperationModeChanged<::workrave::rpc::CoreService::WithCallbackMethod_UsageModeChanged<::workrave::rpc::CoreService::WithCallbackMethod_TimerSnapshotChanged<::workrave::rpc::CoreService::Service>>>
 {
 public:
 
-  explicit CoreService(Core &impl);
+  explicit CoreService(Core &impl,
+                       ::rpc::Executor &executor = ::rpc::Executor::inline_executor());
 
 
 
@@ -65,20 +67,37 @@ public:
                                  const ::workrave::core::ReportActivityRequest *request,
                                  ::workrave::core::ReportActivityResponse *response) override;
 
+  ::grpc::Status GetTimerSnapshot(::grpc::ServerContext *context,
+                                 const ::workrave::core::GetTimerSnapshotRequest *request,
+                                 ::workrave::core::GetTimerSnapshotResponse *response) override;
 
+  ::grpc::Status GetRpcLatencies(::grpc::ServerContext *context,
+                                 const ::workrave::core::GetRpcLatenciesRequest *request,
+                                 ::workrave::core::GetRpcLatenciesResponse *response) override;
 
-  ::grpc::Status OperationModeChanged(::grpc::ServerContext *context,
-                                 const ::workrave::core::OperationModeChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::core::OperationModeChangedEvent> *writer) override;
 
-  ::grpc::Status UsageModeChanged(::grpc::ServerContext *context,
-                                 const ::workrave::core::UsageModeChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::core::UsageModeChangedEvent> *writer) override;
+
+  ::grpc::ServerWriteReactor<::workrave::core::OperationModeChangedEvent> *OperationModeChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::core::OperationModeChangedRequest *request) override;
+
+  ::grpc::ServerWriteReactor<::workrave::core::UsageModeChangedEvent> *UsageModeChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::core::UsageModeChangedRequest *request) override;
+
+  ::grpc::ServerWriteReactor<::workrave::core::TimerSnapshotChangedEvent> *TimerSnapshotChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::core::TimerSnapshotChangedRequest *request) override;
 
 
 private:
 
   Core &impl_;
+  ::rpc::Executor &executor_;
+
+
+  ::rpc::EventBroadcaster<::workrave::core::OperationModeChangedEvent> signal_operation_mode_changed_broadcaster_{{.capacity = 1, .policy = ::rpc::OverflowPolicy::DropOldest}};
+
+  ::rpc::EventBroadcaster<::workrave::core::UsageModeChangedEvent> signal_usage_mode_changed_broadcaster_{{.capacity = 1, .policy = ::rpc::OverflowPolicy::DropOldest}};
+
+  ::rpc::EventBroadcaster<::workrave::core::TimerSnapshotChangedEvent> signal_timer_snapshot_changed_broadcaster_;
 
 
   [[maybe_unused]] const void *const service_descriptor_anchor_;
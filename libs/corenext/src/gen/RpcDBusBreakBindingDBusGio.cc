@@ -10,6 +10,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -88,6 +89,43 @@ struct GioCodec<workrave::BreakEvent>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::BreakEvent>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::BreakEvent &value)
+  {
+    switch (value)
+      {
+
+      case workrave::BreakEvent::ShowPrelude: writer.write_string("show_prelude"); return;
+
+      case workrave::BreakEvent::ShowBreak: writer.write_string("show_break"); return;
+
+      case workrave::BreakEvent::ShowBreakForced: writer.write_string("show_break_forced"); return;
+
+      case workrave::BreakEvent::BreakStart: writer.write_string("break_start"); return;
+
+      case workrave::BreakEvent::BreakIdle: writer.write_string("break_idle"); return;
+
+      case workrave::BreakEvent::BreakStop: writer.write_string("break_stop"); return;
+
+      case workrave::BreakEvent::BreakIgnored: writer.write_string("break_ignored"); return;
+
+      case workrave::BreakEvent::BreakPostponed: writer.write_string("break_postponed"); return;
+
+      case workrave::BreakEvent::BreakSkipped: writer.write_string("break_skipped"); return;
+
+      case workrave::BreakEvent::BreakTaken: writer.write_string("break_taken"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 namespace workrave::rpc::dbus
@@ -138,6 +176,33 @@ struct GioCodec<BreakStage>
       }
   }
 };
+
+template<>
+struct GioSerial<BreakStage>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const BreakStage &value)
+  {
+    switch (value)
+      {
+
+      case BreakStage::None: writer.write_string("none"); return;
+
+      case BreakStage::Snoozed: writer.write_string("snoozed"); return;
+
+      case BreakStage::Prelude: writer.write_string("prelude"); return;
+
+      case BreakStage::Taking: writer.write_string("taking"); return;
+
+      case BreakStage::Delayed: writer.write_string("delayed"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 
@@ -822,25 +887,15 @@ org_workrave_BreakInterface::dispatch_GetBreakState(GVariant *parameters, GDBusM
 void
 org_workrave_BreakInterface::emit_BreakEvent(workrave::BreakEvent value)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
-
-  values.push_back(::workrave::rpc::dbus::GioCodec<workrave::BreakEvent>::encode(value));
-
   server_.emit_signal(path_, "org.workrave.BreakInterface", "BreakEvent",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+                      ::workrave::rpc::dbus::gio_encode_tuple(value),
+                      nullptr);
 }
 void
 org_workrave_BreakInterface::emit_BreakStateChanged(BreakStage value)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
-
-  values.push_back(::workrave::rpc::dbus::GioCodec<BreakStage>::encode(value));
-
   server_.emit_signal(path_, "org.workrave.BreakInterface", "BreakStateChanged",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+                      ::workrave::rpc::dbus::gio_encode_tuple(value),
+                      nullptr);
 }
 } // namespace workrave::core::rpc
@@ -10,6 +10,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -66,6 +67,31 @@ struct GioCodec<workrave::BreakId>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::BreakId>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::BreakId &value)
+  {
+    switch (value)
+      {
+
+      case workrave::BreakId::BREAK_ID_NONE: writer.write_string("none"); return;
+
+      case workrave::BreakId::BREAK_ID_MICRO_BREAK: writer.write_string("microbreak"); return;
+
+      case workrave::BreakId::BREAK_ID_REST_BREAK: writer.write_string("restbreak"); return;
+
+      case workrave::BreakId::BREAK_ID_DAILY_LIMIT: writer.write_string("dailylimit"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 namespace workrave::rpc::dbus
@@ -108,6 +134,29 @@ struct GioCodec<workrave::BreakHint>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::BreakHint>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::BreakHint &value)
+  {
+    switch (value)
+      {
+
+      case workrave::BreakHint::Normal: writer.write_string("normal"); return;
+
+      case workrave::BreakHint::UserInitiated: writer.write_string("userinitiated"); return;
+
+      case workrave::BreakHint::NaturalBreak: writer.write_string("naturalbreak"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 namespace workrave::rpc::dbus
@@ -182,6 +231,29 @@ struct GioCodec<workrave::OperationMode>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::OperationMode>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::OperationMode &value)
+  {
+    switch (value)
+      {
+
+      case workrave::OperationMode::Normal: writer.write_string("normal"); return;
+
+      case workrave::OperationMode::Suspended: writer.write_string("suspended"); return;
+
+      case workrave::OperationMode::Quiet: writer.write_string("quiet"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
 } // namespace workrave::rpc::dbus
 
 namespace workrave::rpc::dbus
@@ -245,9 +317,186 @@ struct GioCodec<workrave::UsageMode>
       }
   }
 };
+
+template<>
+struct GioSerial<workrave::UsageMode>
+{
+  static constexpr size_t alignment = 1;
+  static constexpr size_t fixed_size = 0;
+
+  static void write(GioWriter &writer, const workrave::UsageMode &value)
+  {
+    switch (value)
+      {
+
+      case workrave::UsageMode::Normal: writer.write_string("normal"); return;
+
+      case workrave::UsageMode::Reading: writer.write_string("reading"); return;
+
+      default:
+        throw Error(std::string(error_names::invalid_args), "Type error in enum");
+      }
+  }
+};
+} // namespace workrave::rpc::dbus
+
+namespace workrave::rpc::dbus
+{
+template<>
+struct GioSignature<workrave::BreakSnapshot>
+{
+  static std::string value()
+  {
+    std::string result = "(";
+
+    result += GioSignature<workrave::BreakId>::value();
+
+    result += GioSignature<bool>::value();
+
+    result += GioSignature<bool>::value();
+
+    result += GioSignature<std::string>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += ")";
+    return result;
+  }
+};
+
+template<>
+struct GioFields<workrave::BreakSnapshot>
+{
+  static auto tie(const workrave::BreakSnapshot &value)
+  {
+    return std::tie(value.id, value.enabled, value.running, value.stage, value.elapsed, value.idle, value.remaining, value.overdue);
+  }
+};
+
+template<>
+struct GioCodec<workrave::BreakSnapshot>
+{
+  static workrave::BreakSnapshot decode(GVariant *variant)
+  {
+    gio_require_type(variant, GioSignature<workrave::BreakSnapshot>::value());
+    workrave::BreakSnapshot result{};
+
+    result.id = gio_decode_child<workrave::BreakId>(variant, 0);
+
+    result.enabled = gio_decode_child<bool>(variant, 1);
+
+    result.running = gio_decode_child<bool>(variant, 2);
+
+    result.stage = gio_decode_child<std::string>(variant, 3);
+
+    result.elapsed = gio_decode_child<int64_t>(variant, 4);
+
+    result.idle = gio_decode_child<int64_t>(variant, 5);
+
+    result.remaining = gio_decode_child<int64_t>(variant, 6);
+
+    result.overdue = gio_decode_child<int64_t>(variant, 7);
+
+    return result;
+  }
+
+  static GVariant *encode(const workrave::BreakSnapshot &value)
+  {
+    return std::apply([](const auto &...fields) { return gio_encode_tuple(fields...); },
+                      GioFields<workrave::BreakSnapshot>::tie(value));
+  }
+};
 } // namespace workrave::rpc::dbus
 
 
+
+namespace workrave::rpc::dbus
+{
+template<>
+struct GioSignature<workrave::RpcLatency>
+{
+  static std::string value()
+  {
+    std::string result = "(";
+
+    result += GioSignature<std::string>::value();
+
+    result += GioSignature<std::string>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += GioSignature<int64_t>::value();
+
+    result += ")";
+    return result;
+  }
+};
+
+template<>
+struct GioFields<workrave::RpcLatency>
+{
+  static auto tie(const workrave::RpcLatency &value)
+  {
+    return std::tie(value.service, value.method, value.calls, value.failed, value.mean_usec, value.p50_usec, value.p90_usec, value.p99_usec, value.max_usec);
+  }
+};
+
+template<>
+struct GioCodec<workrave::RpcLatency>
+{
+  static workrave::RpcLatency decode(GVariant *variant)
+  {
+    gio_require_type(variant, GioSignature<workrave::RpcLatency>::value());
+    workrave::RpcLatency result{};
+
+    result.service = gio_decode_child<std::string>(variant, 0);
+
+    result.method = gio_decode_child<std::string>(variant, 1);
+
+    result.calls = gio_decode_child<int64_t>(variant, 2);
+
+    result.failed = gio_decode_child<int64_t>(variant, 3);
+
+    result.mean_usec = gio_decode_child<int64_t>(variant, 4);
+
+    result.p50_usec = gio_decode_child<int64_t>(variant, 5);
+
+    result.p90_usec = gio_decode_child<int64_t>(variant, 6);
+
+    result.p99_usec = gio_decode_child<int64_t>(variant, 7);
+
+    result.max_usec = gio_decode_child<int64_t>(variant, 8);
+
+    return result;
+  }
+
+  static GVariant *encode(const workrave::RpcLatency &value)
+  {
+    return std::apply([](const auto &...fields) { return gio_encode_tuple(fields...); },
+                      GioFields<workrave::RpcLatency>::tie(value));
+  }
+};
+} // namespace workrave::rpc::dbus
+
+
+
+
 namespace workrave::core::rpc
 {
 
@@ -271,6 +520,11 @@ org_workrave_CoreInterface::org_workrave_CoreInterface(::workrave::rpc::dbus::Gi
       emit_UsageModeChanged(value);
     }));
 
+  signal_connections_.emplace_back(implementation_.signal_timer_snapshot_changed().connect(
+    [this](std::vector<workrave::BreakSnapshot> value) {
+      emit_TimerSnapshotChanged(value);
+    }));
+
 }
 
 std::string_view
@@ -357,6 +611,18 @@ org_workrave_CoreInterface::introspection() const noexcept
 
   "    </method>\n"
 
+  "    <method name=\"GetTimerSnapshot\">\n"
+
+  "      <arg type=\"a(sbbsxxxx)\" name=\"result\" direction=\"out\" />\n"
+
+  "    </method>\n"
+
+  "    <method name=\"GetRpcLatencies\">\n"
+
+  "      <arg type=\"a(ssxxxxxxx)\" name=\"result\" direction=\"out\" />\n"
+
+  "    </method>\n"
+
 
   "    <signal name=\"OperationModeChanged\">\n"
 
@@ -370,6 +636,12 @@ org_workrave_CoreInterface::introspection() const noexcept
 
   "    </signal>\n"
 
+  "    <signal name=\"TimerSnapshotChanged\">\n"
+
+  "      <arg type=\"a(sbbsxxxx)\" name=\"value\" />\n"
+
+  "    </signal>\n"
+
   "  </interface>\n";
   return xml;
 }
@@ -379,7 +651,7 @@ org_workrave_CoreInterface::dispatch(std::string_view method, GVariant *paramete
 {
   using Method = void (org_workrave_CoreInterface::*)(GVariant *, GDBusMethodInvocation *);
   struct Entry { std::string_view name; Method method; };
-  static constexpr std::array<Entry, 11> methods = { {
+  static constexpr std::array<Entry, 13> methods = { {
 
     {.name = "ForceBreak", .method = &org_workrave_CoreInterface::dispatch_ForceBreak},
 
@@ -403,6 +675,10 @@ org_workrave_CoreInterface::dispatch(std::string_view method, GVariant *paramete
 
     {.name = "ReportActivity", .method = &org_workrave_CoreInterface::dispatch_ReportActivity},
 
+    {.name = "GetTimerSnapshot", .method = &org_workrave_CoreInterface::dispatch_GetTimerSnapshot},
+
+    {.name = "GetRpcLatencies", .method = &org_workrave_CoreInterface::dispatch_GetRpcLatencies},
+
   } };
   for (const auto &entry: methods)
     {
@@ -768,27 +1044,80 @@ org_workrave_CoreInterface::dispatch_ReportActivity(GVariant *parameters, GDBusM
 
 
 void
-org_workrave_CoreInterface::emit_OperationModeChanged(workrave::OperationMode value)
+org_workrave_CoreInterface::dispatch_GetTimerSnapshot(GVariant *parameters, GDBusMethodInvocation *invocation)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
+  if (parameters == nullptr || !g_variant_is_of_type(parameters, G_VARIANT_TYPE_TUPLE)
+      || g_variant_n_children(parameters) != 0)
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::invalid_args),
+        "Incorrect number of input parameters for org.workrave.CoreInterface.GetTimerSnapshot");
+    }
 
-  values.push_back(::workrave::rpc::dbus::GioCodec<workrave::OperationMode>::encode(value));
 
-  server_.emit_signal(path_, "org.workrave.CoreInterface", "OperationModeChanged",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+  std::vector<workrave::BreakSnapshot> p_result{};
+  p_result = implementation_.get_timer_snapshot();
+
+
+  std::vector<GVariant *> reply_values;
+  ::workrave::rpc::dbus::GioUnixFdList reply_fd_list;
+
+  reply_values.push_back(::workrave::rpc::dbus::GioCodec<std::vector<workrave::BreakSnapshot>>::encode(p_result));
+
+
+  GVariant *reply = g_variant_new_tuple(
+    reply_values.empty() ? nullptr : reply_values.data(), reply_values.size());
+  ::workrave::rpc::dbus::gio_return_method_value(invocation, reply, reply_fd_list.get());
 }
+
+
 void
-org_workrave_CoreInterface::emit_UsageModeChanged(workrave::UsageMode value)
+org_workrave_CoreInterface::dispatch_GetRpcLatencies(GVariant *parameters, GDBusMethodInvocation *invocation)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
+  if (parameters == nullptr || !g_variant_is_of_type(parameters, G_VARIANT_TYPE_TUPLE)
+      || g_variant_n_children(parameters) != 0)
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::invalid_args),
+        "Incorrect number of input parameters for org.workrave.CoreInterface.GetRpcLatencies");
+    }
+
+
+  std::vector<workrave::RpcLatency> p_result{};
+  p_result = implementation_.get_rpc_latencies();
+
+
+  std::vector<GVariant *> reply_values;
+  ::workrave::rpc::dbus::GioUnixFdList reply_fd_list;
+
+  reply_values.push_back(::workrave::rpc::dbus::GioCodec<std::vector<workrave::RpcLatency>>::encode(p_result));
+
+
+  GVariant *reply = g_variant_new_tuple(
+    reply_values.empty() ? nullptr : reply_values.data(), reply_values.size());
+  ::workrave::rpc::dbus::gio_return_method_value(invocation, reply, reply_fd_list.get());
+}
 
-  values.push_back(::workrave::rpc::dbus::GioCodec<workrave::UsageMode>::encode(value));
 
+void
+org_workrave_CoreInterface::emit_OperationModeChanged(workrave::OperationMode value)
+{
+  server_.emit_signal(path_, "org.workrave.CoreInterface", "OperationModeChanged",
+                      ::workrave::rpc::dbus::gio_encode_tuple(value),
+                      nullptr);
+}
+void
+org_workrave_CoreInterface::emit_UsageModeChanged(workrave::UsageMode value)
+{
   server_.emit_signal(path_, "org.workrave.CoreInterface", "UsageModeChanged",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+                      ::workrave::rpc::dbus::gio_encode_tuple(value),
+                      nullptr);
+}
+void
+org_workrave_CoreInterface::emit_TimerSnapshotChanged(std::vector<workrave::BreakSnapshot> value)
+{
+  server_.emit_signal(path_, "org.workrave.CoreInterface", "TimerSnapshotChanged",
+                      ::workrave::rpc::dbus::gio_encode_tuple(value),
+                      nullptr);
 }
 } // namespace workrave::core::rpc
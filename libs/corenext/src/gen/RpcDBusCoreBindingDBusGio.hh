@@ -57,11 +57,17 @@ private:
 
   void dispatch_ReportActivity(GVariant *parameters, GDBusMethodInvocation *invocation);
 
+  void dispatch_GetTimerSnapshot(GVariant *parameters, GDBusMethodInvocation *invocation);
+
+  void dispatch_GetRpcLatencies(GVariant *parameters, GDBusMethodInvocation *invocation);
+
 
   void emit_OperationModeChanged(workrave::OperationMode value);
 
   void emit_UsageModeChanged(workrave::UsageMode value);
 
+  void emit_TimerSnapshotChanged(std::vector<workrave::BreakSnapshot> value);
+
 
 
   ::workrave::rpc::dbus::GioServer &server_;
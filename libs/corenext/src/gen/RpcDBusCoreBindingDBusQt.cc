@@ -364,6 +364,232 @@ struct QtCodec<workrave::UsageMode>
   return arg;
 }
 
+namespace workrave::rpc::dbus
+{
+template<>
+struct QtCodec<workrave::BreakSnapshot>
+{
+  static workrave::BreakSnapshot decode(const QVariant &variant)
+  {
+    const auto arg = variant.value<QDBusArgument>();
+    workrave::BreakSnapshot result{};
+    arg.beginStructure();
+
+    result.id = QtCodec<workrave::BreakId>::decode(arg.asVariant());
+
+    result.enabled = QtCodec<bool>::decode(arg.asVariant());
+
+    result.running = QtCodec<bool>::decode(arg.asVariant());
+
+    result.stage = QtCodec<std::string>::decode(arg.asVariant());
+
+    result.elapsed = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.idle = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.remaining = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.overdue = QtCodec<int64_t>::decode(arg.asVariant());
+
+    arg.endStructure();
+    return result;
+  }
+  static void append(QDBusArgument &arg, const workrave::BreakSnapshot &value)
+  {
+    arg.beginStructure();
+
+    QtCodec<workrave::BreakId>::append(arg, value.id);
+
+    QtCodec<bool>::append(arg, value.enabled);
+
+    QtCodec<bool>::append(arg, value.running);
+
+    QtCodec<std::string>::append(arg, value.stage);
+
+    QtCodec<int64_t>::append(arg, value.elapsed);
+
+    QtCodec<int64_t>::append(arg, value.idle);
+
+    QtCodec<int64_t>::append(arg, value.remaining);
+
+    QtCodec<int64_t>::append(arg, value.overdue);
+
+    arg.endStructure();
+  }
+  static QVariant encode(const workrave::BreakSnapshot &value)
+  {
+    QDBusArgument arg;
+    append(arg, value);
+    return QVariant::fromValue(arg);
+  }
+};
+} // namespace workrave::rpc::dbus
+
+// See the enum case above for why these are at global scope, not nested in
+// workrave::rpc::dbus: ADL needs to find them from workrave::BreakSnapshot's own associated
+// namespace, not this library's.
+[[maybe_unused]] static QDBusArgument &operator<<(QDBusArgument &arg, const workrave::BreakSnapshot &data)
+{
+  workrave::rpc::dbus::QtCodec<workrave::BreakSnapshot>::append(arg, data);
+  return arg;
+}
+
+[[maybe_unused]] static const QDBusArgument &operator>>(const QDBusArgument &arg, workrave::BreakSnapshot &data)
+{
+  data = workrave::rpc::dbus::QtCodec<workrave::BreakSnapshot>::decode(QVariant::fromValue(arg));
+  return arg;
+}
+
+namespace workrave::rpc::dbus
+{
+template<>
+struct QtCodec<std::vector<workrave::BreakSnapshot>>
+{
+  static std::vector<workrave::BreakSnapshot> decode(const QVariant &variant)
+  {
+    const auto arg = variant.value<QDBusArgument>();
+    std::vector<workrave::BreakSnapshot> result;
+    arg.beginArray();
+    while (!arg.atEnd())
+      {
+        result.push_back(QtCodec<workrave::BreakSnapshot>::decode(arg.asVariant()));
+      }
+    arg.endArray();
+    return result;
+  }
+  static void append(QDBusArgument &arg, const std::vector<workrave::BreakSnapshot> &value)
+  {
+    arg.beginArray(qMetaTypeId<QVariant>());
+    for (const auto &item : value)
+      {
+        QtCodec<workrave::BreakSnapshot>::append(arg, item);
+      }
+    arg.endArray();
+  }
+  static QVariant encode(const std::vector<workrave::BreakSnapshot> &value)
+  {
+    QDBusArgument arg;
+    append(arg, value);
+    return QVariant::fromValue(arg);
+  }
+};
+} // namespace workrave::rpc::dbus
+
+namespace workrave::rpc::dbus
+{
+template<>
+struct QtCodec<workrave::RpcLatency>
+{
+  static workrave::RpcLatency decode(const QVariant &variant)
+  {
+    const auto arg = variant.value<QDBusArgument>();
+    workrave::RpcLatency result{};
+    arg.beginStructure();
+
+    result.service = QtCodec<std::string>::decode(arg.asVariant());
+
+    result.method = QtCodec<std::string>::decode(arg.asVariant());
+
+    result.calls = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.failed = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.mean_usec = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.p50_usec = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.p90_usec = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.p99_usec = QtCodec<int64_t>::decode(arg.asVariant());
+
+    result.max_usec = QtCodec<int64_t>::decode(arg.asVariant());
+
+    arg.endStructure();
+    return result;
+  }
+  static void append(QDBusArgument &arg, const workrave::RpcLatency &value)
+  {
+    arg.beginStructure();
+
+    QtCodec<std::string>::append(arg, value.service);
+
+    QtCodec<std::string>::append(arg, value.method);
+
+    QtCodec<int64_t>::append(arg, value.calls);
+
+    QtCodec<int64_t>::append(arg, value.failed);
+
+    QtCodec<int64_t>::append(arg, value.mean_usec);
+
+    QtCodec<int64_t>::append(arg, value.p50_usec);
+
+    QtCodec<int64_t>::append(arg, value.p90_usec);
+
+    QtCodec<int64_t>::append(arg, value.p99_usec);
+
+    QtCodec<int64_t>::append(arg, value.max_usec);
+
+    arg.endStructure();
+  }
+  static QVariant encode(const workrave::RpcLatency &value)
+  {
+    QDBusArgument arg;
+    append(arg, value);
+    return QVariant::fromValue(arg);
+  }
+};
+} // namespace workrave::rpc::dbus
+
+// See the enum case above for why these are at global scope, not nested in
+// workrave::rpc::dbus: ADL needs to find them from workrave::RpcLatency's own associated
+// namespace, not this library's.
+[[maybe_unused]] static QDBusArgument &operator<<(QDBusArgument &arg, const workrave::RpcLatency &data)
+{
+  workrave::rpc::dbus::QtCodec<workrave::RpcLatency>::append(arg, data);
+  return arg;
+}
+
+[[maybe_unused]] static const QDBusArgument &operator>>(const QDBusArgument &arg, workrave::RpcLatency &data)
+{
+  data = workrave::rpc::dbus::QtCodec<workrave::RpcLatency>::decode(QVariant::fromValue(arg));
+  return arg;
+}
+
+namespace workrave::rpc::dbus
+{
+template<>
+struct QtCodec<std::vector<workrave::RpcLatency>>
+{
+  static std::vector<workrave::RpcLatency> decode(const QVariant &variant)
+  {
+    const auto arg = variant.value<QDBusArgument>();
+    std::vector<workrave::RpcLatency> result;
+    arg.beginArray();
+    while (!arg.atEnd())
+      {
+        result.push_back(QtCodec<workrave::RpcLatency>::decode(arg.asVariant()));
+      }
+    arg.endArray();
+    return result;
+  }
+  static void append(QDBusArgument &arg, const std::vector<workrave::RpcLatency> &value)
+  {
+    arg.beginArray(qMetaTypeId<QVariant>());
+    for (const auto &item : value)
+      {
+        QtCodec<workrave::RpcLatency>::append(arg, item);
+      }
+    arg.endArray();
+  }
+  static QVariant encode(const std::vector<workrave::RpcLatency> &value)
+  {
+    QDBusArgument arg;
+    append(arg, value);
+    return QVariant::fromValue(arg);
+  }
+};
+} // namespace workrave::rpc::dbus
+
 
 namespace workrave::core::rpc
 {
@@ -387,6 +613,10 @@ org_workrave_CoreInterface::org_workrave_CoreInterface(::workrave::rpc::dbus::Qt
 
   qDBusRegisterMetaType<workrave::UsageMode>();
 
+  qDBusRegisterMetaType<workrave::BreakSnapshot>();
+
+  qDBusRegisterMetaType<workrave::RpcLatency>();
+
   signal_connections_.emplace_back(implementation_.signal_operation_mode_changed().connect(
     [this](workrave::OperationMode value) {
       emit_OperationModeChanged(value);
@@ -397,6 +627,11 @@ org_workrave_CoreInterface::org_workrave_CoreInterface(::workrave::rpc::dbus::Qt
       emit_UsageModeChanged(value);
     }));
 
+  signal_connections_.emplace_back(implementation_.signal_timer_snapshot_changed().connect(
+    [this](std::vector<workrave::BreakSnapshot> value) {
+      emit_TimerSnapshotChanged(value);
+    }));
+
 }
 
 std::string_view
@@ -558,6 +793,30 @@ org_workrave_CoreInterface::introspection() const noexcept
 
   "\n"
 
+  "    <method name=\"GetTimerSnapshot\">\n"
+
+  "\n"
+
+  "      <arg type=\"a(sbbsxxxx)\" name=\"result\" direction=\"out\" />\n"
+
+  "\n"
+
+  "    </method>\n"
+
+  "\n"
+
+  "    <method name=\"GetRpcLatencies\">\n"
+
+  "\n"
+
+  "      <arg type=\"a(ssxxxxxxx)\" name=\"result\" direction=\"out\" />\n"
+
+  "\n"
+
+  "    </method>\n"
+
+  "\n"
+
   "\n"
 
   "    <signal name=\"OperationModeChanged\">\n"
@@ -584,6 +843,18 @@ org_workrave_CoreInterface::introspection() const noexcept
 
   "\n"
 
+  "    <signal name=\"TimerSnapshotChanged\">\n"
+
+  "\n"
+
+  "      <arg type=\"a(sbbsxxxx)\" name=\"value\" />\n"
+
+  "\n"
+
+  "    </signal>\n"
+
+  "\n"
+
   "  </interface>\n";
   return xml;
 }
@@ -597,7 +868,7 @@ org_workrave_CoreInterface::dispatch(const QDBusMessage &message, const QDBusCon
     std::string_view name;
     Method method;
   };
-  static constexpr std::array<Entry, 11> methods =
+  static constexpr std::array<Entry, 13> methods =
   { {
 
       {.name = "ForceBreak", .method = &org_workrave_CoreInterface::dispatch_ForceBreak},
@@ -622,6 +893,10 @@ org_workrave_CoreInterface::dispatch(const QDBusMessage &message, const QDBusCon
 
       {.name = "ReportActivity", .method = &org_workrave_CoreInterface::dispatch_ReportActivity},
 
+      {.name = "GetTimerSnapshot", .method = &org_workrave_CoreInterface::dispatch_GetTimerSnapshot},
+
+      {.name = "GetRpcLatencies", .method = &org_workrave_CoreInterface::dispatch_GetRpcLatencies},
+
   } };
 
   const std::string method_name = message.member().toStdString();
@@ -1088,6 +1363,80 @@ org_workrave_CoreInterface::dispatch_ReportActivity(const QDBusMessage &message,
 }
 
 
+void
+org_workrave_CoreInterface::dispatch_GetTimerSnapshot(const QDBusMessage &message, const QDBusConnection &connection)
+{
+
+
+  std::vector<workrave::BreakSnapshot> p_result{};
+
+
+  const auto num_in_args = message.arguments().size();
+  if (num_in_args != 0)
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::invalid_args),
+        "Incorrect number of input parameters for org.workrave.CoreInterface.GetTimerSnapshot");
+    }
+
+
+
+
+  p_result = implementation_.get_timer_snapshot();
+
+
+  QDBusMessage reply = message.createReply();
+
+  reply << ::workrave::rpc::dbus::QtCodec<std::vector<workrave::BreakSnapshot>>::encode(p_result);
+
+
+
+  if (!connection.send(reply))
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::failed),
+        "Failed to send reply for org.workrave.CoreInterface.GetTimerSnapshot");
+    }
+}
+
+
+void
+org_workrave_CoreInterface::dispatch_GetRpcLatencies(const QDBusMessage &message, const QDBusConnection &connection)
+{
+
+
+  std::vector<workrave::RpcLatency> p_result{};
+
+
+  const auto num_in_args = message.arguments().size();
+  if (num_in_args != 0)
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::invalid_args),
+        "Incorrect number of input parameters for org.workrave.CoreInterface.GetRpcLatencies");
+    }
+
+
+
+
+  p_result = implementation_.get_rpc_latencies();
+
+
+  QDBusMessage reply = message.createReply();
+
+  reply << ::workrave::rpc::dbus::QtCodec<std::vector<workrave::RpcLatency>>::encode(p_result);
+
+
+
+  if (!connection.send(reply))
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::failed),
+        "Failed to send reply for org.workrave.CoreInterface.GetRpcLatencies");
+    }
+}
+
+
 void
 org_workrave_CoreInterface::emit_OperationModeChanged(workrave::OperationMode value)
 {
@@ -1106,4 +1455,13 @@ org_workrave_CoreInterface::emit_UsageModeChanged(workrave::UsageMode value)
 
   server_.emit_signal(path_, "org.workrave.CoreInterface", "UsageModeChanged", arguments);
 }
+void
+org_workrave_CoreInterface::emit_TimerSnapshotChanged(std::vector<workrave::BreakSnapshot> value)
+{
+  QVariantList arguments;
+
+  arguments << ::workrave::rpc::dbus::QtCodec<std::vector<workrave::BreakSnapshot>>::encode(value);
+
+  server_.emit_signal(path_, "org.workrave.CoreInterface", "TimerSnapshotChanged", arguments);
+}
 } // namespace workrave::core::rpc
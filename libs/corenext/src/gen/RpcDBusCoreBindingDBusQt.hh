@@ -55,11 +55,17 @@ private:
 
   void dispatch_ReportActivity(const QDBusMessage &message, const QDBusConnection &connection);
 
+  void dispatch_GetTimerSnapshot(const QDBusMessage &message, const QDBusConnection &connection);
+
+  void dispatch_GetRpcLatencies(const QDBusMessage &message, const QDBusConnection &connection);
+
 
   void emit_OperationModeChanged(workrave::OperationMode value);
 
   void emit_UsageModeChanged(workrave::UsageMode value);
 
+  void emit_TimerSnapshotChanged(std::vector<workrave::BreakSnapshot> value);
+
 
 
   ::workrave::rpc::dbus::QtServer &server_;
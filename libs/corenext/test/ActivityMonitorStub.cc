@@ -31,8 +31,14 @@ ActivityMonitorStub::ActivityMonitorStub()
 void
 ActivityMonitorStub::set_active(bool active)
 {
+  const bool started = active && !is_active();
   this->active = active;
   forced_idle = false;
+
+  if (started && is_active())
+    {
+      activity_started_signal();
+    }
 }
 
 void
@@ -75,6 +81,18 @@ ActivityMonitorStub::set_listener(IActivityMonitorListener::Ptr l)
   listener = l;
 }
 
+boost::signals2::signal<void()> &
+ActivityMonitorStub::signal_activity_started()
+{
+  return activity_started_signal;
+}
+
+workrave::input_monitor::IInputMonitor::Statistics
+ActivityMonitorStub::get_input_statistics() const
+{
+  return {};
+}
+
 void
 ActivityMonitorStub::notify()
 {
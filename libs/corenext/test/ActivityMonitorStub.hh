@@ -40,6 +40,8 @@ public:
   void force_idle() override;
   bool is_active() override;
   void set_listener(IActivityMonitorListener::Ptr l) override;
+  boost::signals2::signal<void()> &signal_activity_started() override;
+  workrave::input_monitor::IInputMonitor::Statistics get_input_statistics() const override;
 
   void notify();
 
@@ -48,6 +50,7 @@ private:
   bool suspended;
   bool forced_idle;
   IActivityMonitorListener::Ptr listener;
+  boost::signals2::signal<void()> activity_started_signal;
 };
 
 #endif // LOCALACTIVITYMONITOR_HH
@@ -50,9 +50,11 @@ using namespace std::chrono_literals;
 #include "config/SettingCache.hh"
 
 #include "utils/Paths.hh"
+#include "utils/SnapshotFile.hh"
 #include "utils/TimeSource.hh"
 #include "debug.hh"
 
+#include "Core.hh"
 #include "Timer.hh"
 #include "ICoreTestHooks.hh"
 #include "stats/IStatistics.hh"
@@ -1636,6 +1638,67 @@ TEST_F(IntegrationTest, test_user_active)
   verify();
 }
 
+TEST_F(IntegrationTest, test_timer_snapshot)
+{
+  init();
+
+  auto *c = dynamic_cast<Core *>(core.get());
+  ASSERT_NE(c, nullptr);
+
+  using workrave::BreakSnapshot;
+  constexpr auto mb = workrave::BREAK_ID_MICRO_BREAK;
+  constexpr auto rb = workrave::BREAK_ID_REST_BREAK;
+  constexpr auto dl = workrave::BREAK_ID_DAILY_LIMIT;
+
+  // The limits are 300s, 1500s and 14400s. Activity is counted one heartbeat late.
+  tick(true, 100);
+  EXPECT_EQ(c->get_timer_snapshot(),
+            (std::vector<BreakSnapshot>{{mb, true, true, "none", 99, 0, 201, 0},
+                                        {rb, true, true, "none", 99, 0, 1401, 0},
+                                        {dl, true, true, "none", 99, 0, 14301, 0}}));
+
+  // Idle, but not long enough for any auto-reset.
+  tick(false, 10);
+  EXPECT_EQ(c->get_timer_snapshot(),
+            (std::vector<BreakSnapshot>{{mb, true, false, "none", 100, 9, 200, 0},
+                                        {rb, true, false, "none", 100, 9, 1400, 0},
+                                        {dl, true, false, "none", 100, 9, 14300, 0}}));
+
+  // Past the micro break's 20s auto-reset only.
+  tick(false, 15);
+  EXPECT_EQ(c->get_timer_snapshot(),
+            (std::vector<BreakSnapshot>{{mb, true, false, "none", 0, 24, 300, 0},
+                                        {rb, true, false, "none", 100, 24, 1400, 0},
+                                        {dl, true, false, "none", 100, 24, 14300, 0}}));
+
+  tick(true, 250);
+  EXPECT_EQ(c->get_timer_snapshot(),
+            (std::vector<BreakSnapshot>{{mb, true, true, "none", 249, 0, 51, 0},
+                                        {rb, true, true, "none", 349, 0, 1151, 0},
+                                        {dl, true, true, "none", 349, 0, 14051, 0}}));
+}
+
+TEST_F(IntegrationTest, test_timer_snapshot_changed)
+{
+  init();
+
+  auto *c = dynamic_cast<Core *>(core.get());
+  ASSERT_NE(c, nullptr);
+
+  std::vector<std::vector<workrave::BreakSnapshot>> frames;
+  boost::signals2::scoped_connection connection =
+    c->signal_timer_snapshot_changed().connect([&](std::vector<workrave::BreakSnapshot> s) { frames.push_back(std::move(s)); });
+
+  // Active: the timers move every heartbeat.
+  tick(true, 10);
+  EXPECT_EQ(frames.size(), 10U);
+  for (size_t i = 1; i < frames.size(); i++)
+    {
+      EXPECT_NE(frames[i], frames[i - 1]);
+    }
+  EXPECT_EQ(frames.back(), c->get_timer_snapshot());
+}
+
 TEST_F(IntegrationTest, test_core_services_and_force_idle)
 {
   init();
@@ -1676,9 +1739,10 @@ TEST_F(IntegrationTest, test_statistics_counters_and_delete_history)
     0);
 }
 
-//! Break counters other than TOTAL_OVERDUE are written straight to the store, so they
-//! must be durable even without a save_day()/update() in between.
-TEST_F(IntegrationTest, test_statistics_break_counter_is_durable_immediately)
+//! Break counters other than TOTAL_OVERDUE are written straight to the store, which
+//! group-commits them, so they must be durable after a flush even without a
+//! save_day()/update() in between.
+TEST_F(IntegrationTest, test_statistics_break_counter_is_durable_after_flush)
 {
   init();
 
@@ -1686,9 +1750,10 @@ TEST_F(IntegrationTest, test_statistics_break_counter_is_durable_immediately)
   ASSERT_TRUE(statistics != nullptr);
 
   statistics->get_current_day()->break_stats[workrave::BREAK_ID_MICRO_BREAK][workrave::stats::BreakStatValue::Prompted].add(1);
+  statistics->flush();
 
   // Read the store directly, bypassing Statistics's own in-memory current_day, to
-  // prove the increment reached the store immediately.
+  // prove the increment reached the store.
   auto store = workrave::stats::StatisticsStoreFactory::create(workrave::utils::Paths::get_state_directory());
   auto today = store->load_today();
   ASSERT_TRUE(today.has_value());
@@ -1890,6 +1955,97 @@ TEST_F(IntegrationTest, test_load_missing_timer_state)
   EXPECT_EQ(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_elapsed_time(), 0);
 }
 
+namespace
+{
+  std::vector<workrave::utils::SnapshotFile::Record> make_timer_snapshot(int64_t now)
+  {
+    return {{"micro_pause", {now, 15, 0, 0, 0, 0, 0, 0}},
+            {"rest_break", {now, 25, 0, 0, 0, 0, 0, 0}},
+            {"daily_limit", {now, 35, 0, 0, 0, 0, 0, 0}}};
+  }
+
+  std::string make_text_timer_state(int64_t now)
+  {
+    std::ostringstream state;
+    state << "WorkRaveState 3\n"
+          << now << "\n"
+          << "micro_pause " << now << " 10 0 0 0 0 0 0\n"
+          << "rest_break " << now << " 20 0 0 0 0 0 0\n"
+          << "daily_limit " << now << " 30 0 0 0 0 0 0\n";
+    return state.str();
+  }
+
+  int64_t simulated_now()
+  {
+    auto simulated_time = SimulatedTime::create();
+    simulated_time->reset();
+    return simulated_time->get_real_time_usec() / 1000000;
+  }
+} // namespace
+
+TEST_F(IntegrationTest, test_load_timer_snapshot)
+{
+  const auto state_directory = workrave::utils::Paths::get_state_directory();
+  std::filesystem::create_directories(state_directory);
+  ASSERT_TRUE(workrave::utils::SnapshotFile::write(state_directory / "state.bin", make_timer_snapshot(simulated_now())));
+
+  init_without_timer_state();
+
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_elapsed_time(), 15);
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_REST_BREAK)->get_elapsed_time(), 25);
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_DAILY_LIMIT)->get_elapsed_time(), 35);
+}
+
+TEST_F(IntegrationTest, test_load_newer_text_timer_state_over_snapshot)
+{
+  const auto state_directory = workrave::utils::Paths::get_state_directory();
+  const auto snapshot_path = state_directory / "state.bin";
+  std::filesystem::create_directories(state_directory);
+  ASSERT_TRUE(workrave::utils::SnapshotFile::write(snapshot_path, make_timer_snapshot(simulated_now())));
+  std::filesystem::last_write_time(snapshot_path, std::filesystem::last_write_time(snapshot_path) - 1h);
+
+  // As written by an older Workrave after this one last ran.
+  init_with_timer_state(make_text_timer_state(simulated_now()), true);
+
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_elapsed_time(), 10);
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_REST_BREAK)->get_elapsed_time(), 20);
+}
+
+TEST_F(IntegrationTest, test_load_damaged_timer_snapshot_falls_back_to_text)
+{
+  const auto state_directory = workrave::utils::Paths::get_state_directory();
+  const auto text_path = state_directory / "state";
+  std::filesystem::create_directories(state_directory);
+  {
+    std::ofstream text_file(text_path);
+    text_file << make_text_timer_state(simulated_now());
+  }
+  std::filesystem::last_write_time(text_path, std::filesystem::last_write_time(text_path) - 1h);
+  {
+    std::ofstream snapshot_file(state_directory / "state.bin", std::ios::binary);
+    snapshot_file << "WRSN";
+  }
+
+  install_load_timer_state_hook = false;
+  init();
+
+  EXPECT_EQ(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_elapsed_time(), 10);
+}
+
+TEST_F(IntegrationTest, test_save_writes_timer_snapshot)
+{
+  init();
+  // The state is saved once a minute, so this is sure to save it at least once after the start.
+  tick(true, 90);
+
+  const auto records = workrave::utils::SnapshotFile::read(workrave::utils::Paths::get_state_directory() / "state.bin");
+  ASSERT_TRUE(records.has_value());
+  ASSERT_EQ(records->size(), static_cast<size_t>(workrave::BREAK_ID_SIZEOF));
+  EXPECT_EQ(records->at(workrave::BREAK_ID_MICRO_BREAK).id, "micro_pause");
+  ASSERT_GE(records->at(workrave::BREAK_ID_MICRO_BREAK).values.size(), 8U);
+  EXPECT_GT(records->at(workrave::BREAK_ID_MICRO_BREAK).values[1], 0);
+}
+
 TEST_F(IntegrationTest, test_user_ignores_first_prelude)
 {
   init();
@@ -2994,6 +3150,66 @@ TEST_F(IntegrationTest, test_daily_limit_reset)
   verify();
 }
 
+TEST_F(IntegrationTest, test_heartbeat_delay_while_active)
+{
+  init();
+
+  tick(true, 10);
+
+  EXPECT_EQ(core->get_next_heartbeat_delay(), std::chrono::milliseconds{1000});
+}
+
+TEST_F(IntegrationTest, test_heartbeat_delay_waits_for_next_reset)
+{
+  init();
+
+  auto rest_break = core->get_break(workrave::BREAK_ID_REST_BREAK);
+
+  tick(true, 10);
+  tick(false, static_cast<int>(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_auto_reset()) + 1);
+  ASSERT_GT(rest_break->get_elapsed_time(), 0);
+
+  workrave::utils::TimeSource::sync();
+  core->heartbeat();
+  const auto delay = core->get_next_heartbeat_delay();
+  EXPECT_GT(delay, std::chrono::milliseconds{1000});
+  EXPECT_LE(delay, std::chrono::seconds{rest_break->get_auto_reset()});
+
+  // Nothing happens until the deadline...
+  sim->current_time += std::chrono::duration_cast<std::chrono::microseconds>(delay).count() - 1000000;
+  workrave::utils::TimeSource::sync();
+  core->heartbeat();
+  EXPECT_GT(rest_break->get_elapsed_time(), 0);
+
+  // ...at which the rest break resets, as it would have with a heartbeat every second.
+  sim->current_time += 1000000;
+  workrave::utils::TimeSource::sync();
+  core->heartbeat();
+  EXPECT_EQ(rest_break->get_elapsed_time(), 0);
+}
+
+TEST_F(IntegrationTest, test_heartbeat_needed_when_user_becomes_active)
+{
+  init();
+
+  tick(true, 10);
+  tick(false, static_cast<int>(core->get_break(workrave::BREAK_ID_MICRO_BREAK)->get_auto_reset()) + 1);
+  ASSERT_GT(core->get_next_heartbeat_delay(), std::chrono::milliseconds{1000});
+
+  int needed = 0;
+  auto connection = core->signal_heartbeat_needed().connect([&needed]() { needed++; });
+
+  monitor->set_active(true);
+  EXPECT_EQ(needed, 1);
+
+  // Once per quiet period.
+  monitor->set_active(false);
+  monitor->set_active(true);
+  EXPECT_EQ(needed, 1);
+
+  connection.disconnect();
+}
+
 // TODO: daily limit + change limit
 // TODO: daily limit + statistics reset
 // TODO: forced restbreak in reading mode (active state)
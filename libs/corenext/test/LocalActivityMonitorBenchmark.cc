@@ -0,0 +1,190 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Pushes synthetic mouse events through LocalActivityMonitor from one
+// thread while other threads poll is_active(), next to the same state
+// machine guarded by a recursive mutex as it was before. Not part of the
+// test suite; run by hand:
+//
+//   workrave-core-next-activity-benchmark [events] [readers]
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LocalActivityMonitor.hh"
+#include "utils/TimeSource.hh"
+
+using namespace workrave::utils;
+
+namespace
+{
+  //! What the input path of LocalActivityMonitor did before it became lock-free.
+  class LockedActivityMonitor
+  {
+  public:
+    void mouse_notify(int x, int y, int wheel_delta)
+    {
+      lock.lock();
+      const int delta_x = x - prev_x;
+      const int delta_y = y - prev_y;
+      prev_x = x;
+      prev_y = y;
+
+      if (abs(delta_x) >= sensitivity || abs(delta_y) >= sensitivity || wheel_delta != 0)
+        {
+          action_notify();
+        }
+      lock.unlock();
+    }
+
+    bool is_active()
+    {
+      lock.lock();
+      if (active && TimeSource::get_monotonic_time_usec() - last_action_time > idle_threshold)
+        {
+          active = false;
+        }
+      const bool ret = active;
+      lock.unlock();
+      return ret;
+    }
+
+  private:
+    void action_notify()
+    {
+      lock.lock();
+      const int64_t now = TimeSource::get_monotonic_time_usec();
+      if (!active)
+        {
+          if (now - last_action_time > noise_threshold)
+            {
+              first_action_time = now;
+            }
+          else if (now - first_action_time >= activity_threshold)
+            {
+              active = true;
+            }
+        }
+      last_action_time = now;
+      lock.unlock();
+    }
+
+    std::recursive_mutex lock;
+    int prev_x{-10};
+    int prev_y{-10};
+    bool active{false};
+    int64_t last_action_time{0};
+    int64_t first_action_time{0};
+    int64_t noise_threshold{1 * TimeSource::TIME_USEC_PER_SEC};
+    int64_t activity_threshold{2 * TimeSource::TIME_USEC_PER_SEC};
+    int64_t idle_threshold{5 * TimeSource::TIME_USEC_PER_SEC};
+    int sensitivity{3};
+  };
+
+  template<typename Monitor>
+  void
+  measure(const std::string &name, Monitor &monitor, int events, int readers)
+  {
+    // Time every 64th event; timing each one would dominate the result.
+    constexpr int sample_interval = 64;
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> polling;
+    for (int i = 0; i < readers; i++)
+      {
+        polling.emplace_back([&monitor, &done] {
+          while (!done.load(std::memory_order_relaxed))
+            {
+              (void)monitor.is_active();
+            }
+        });
+      }
+
+    std::vector<int64_t> latencies;
+    latencies.reserve(events / sample_interval + 1);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < events; i++)
+      {
+        const int x = (i * 7) % 1920;
+        const int y = (i * 5) % 1080;
+        if (i % sample_interval == 0)
+          {
+            const auto before = std::chrono::steady_clock::now();
+            monitor.mouse_notify(x, y, 0);
+            const auto latency = std::chrono::steady_clock::now() - before;
+            latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+          }
+        else
+          {
+            monitor.mouse_notify(x, y, 0);
+          }
+      }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    done = true;
+    for (auto &t: polling)
+      {
+        t.join();
+      }
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double p) {
+      return latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))];
+    };
+
+    std::cout << name << " (" << readers << " readers): "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / events << " ns/event, "
+              << "p50 " << percentile(0.50) << " ns, p99 " << percentile(0.99) << " ns, max " << latencies.back() << " ns"
+              << std::endl;
+  }
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  const int events = argc > 1 ? std::atoi(argv[1]) : 5000000;
+  const int readers = argc > 2 ? std::atoi(argv[2]) : 3;
+
+  if (events <= 0 || readers < 0)
+    {
+      std::cerr << "usage: " << argv[0] << " [events] [readers]" << std::endl;
+      return 1;
+    }
+
+  for (int r: {0, readers})
+    {
+      LockedActivityMonitor locked;
+      measure("recursive mutex", locked, events, r);
+
+      LocalActivityMonitor lock_free(nullptr, nullptr);
+      measure("LocalActivityMonitor", lock_free, events, r);
+    }
+
+  return 0;
+}
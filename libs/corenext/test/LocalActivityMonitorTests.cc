@@ -0,0 +1,206 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "config/ConfiguratorFactory.hh"
+#include "config/SettingCache.hh"
+#include "core/CoreConfig.hh"
+#include "input-monitor/InputMonitorFactoryStub.hh"
+
+#include "LocalActivityMonitor.hh"
+#include "SimulatedTime.hh"
+
+using namespace workrave::config;
+using namespace workrave::input_monitor;
+
+namespace
+{
+  class CountingListener : public IActivityMonitorListener
+  {
+  public:
+    bool action_notify() override
+    {
+      count++;
+      return true;
+    }
+
+    int count{0};
+  };
+
+  enum class Motion
+  {
+    Still,
+    Jitter,
+    Move,
+    Slow,
+  };
+
+  struct Phase
+  {
+    int duration_ms;
+    Motion motion;
+  };
+
+  //! Mixes jitter, bursts and pauses around the noise (9 s), activity (1 s) and idle (5 s) thresholds.
+  const std::vector<Phase> script{{1500, Motion::Jitter},
+                                  {800, Motion::Move},
+                                  {500, Motion::Still},
+                                  {3000, Motion::Move},
+                                  {4000, Motion::Still},
+                                  {200, Motion::Move},
+                                  {6000, Motion::Still},
+                                  {12000, Motion::Slow},
+                                  {3000, Motion::Jitter},
+                                  {2000, Motion::Move},
+                                  {5500, Motion::Still}};
+} // namespace
+
+class LocalActivityMonitorTest : public ::testing::Test
+{
+protected:
+  LocalActivityMonitorTest()
+  {
+    sim = SimulatedTime::create();
+    sim->reset();
+  }
+
+  //! Replays the script with one mouse event per millisecond, sampling is_active() every 10 ms.
+  std::vector<bool> replay(int motion_quantum, int &listener_calls)
+  {
+    SettingCache::reset();
+    auto config = ConfiguratorFactory::create(ConfigFileFormat::Ini);
+    CoreConfig::init(config);
+    config->set_value("monitor/motion_quantum", motion_quantum);
+
+    auto monitor = std::make_shared<LocalActivityMonitor>(config, nullptr);
+    auto listener = std::make_shared<CountingListener>();
+    monitor->init();
+    monitor->set_listener(listener);
+
+    std::vector<bool> samples;
+    int x = 100;
+    int y = 100;
+    int t = 0;
+    for (const auto &phase: script)
+      {
+        for (int i = 0; i < phase.duration_ms; i++, t++)
+          {
+            switch (phase.motion)
+              {
+              case Motion::Still:
+                break;
+              case Motion::Jitter:
+                x += (t % 2 == 0) ? 1 : -1;
+                test::fire_mouse(x, y);
+                break;
+              case Motion::Move:
+                x += 4;
+                y += 2;
+                test::fire_mouse(x, y);
+                break;
+              case Motion::Slow:
+                if (t % 400 == 0)
+                  {
+                    x += 10;
+                    test::fire_mouse(x, y);
+                  }
+                break;
+              }
+
+            if (t % 10 == 0)
+              {
+                samples.push_back(monitor->is_active());
+              }
+            sim->current_time += 1000;
+          }
+      }
+
+    listener_calls = listener->count;
+    return samples;
+  }
+
+  SimulatedTime::Ptr sim;
+};
+
+TEST_F(LocalActivityMonitorTest, coalescing_keeps_thresholds_exact)
+{
+  int direct_calls = 0;
+  int coalesced_calls = 0;
+  const auto direct = replay(0, direct_calls);
+  const auto coalesced = replay(50, coalesced_calls);
+
+  ASSERT_EQ(direct.size(), coalesced.size());
+  for (size_t i = 0; i < direct.size(); i++)
+    {
+      EXPECT_EQ(direct[i], coalesced[i]) << "at " << i * 10 << " ms";
+    }
+
+  // Sanity check that the script exercises both states.
+  EXPECT_NE(std::find(direct.begin(), direct.end(), true), direct.end());
+  EXPECT_NE(std::find(direct.begin(), direct.end(), false), direct.end());
+
+  EXPECT_LT(coalesced_calls * 4, direct_calls);
+}
+
+//! Input that arrives while is_active() decides that the user went idle, and so
+//! still finds the monitor active, must not be lost.
+TEST_F(LocalActivityMonitorTest, input_during_idle_check_is_not_lost)
+{
+  SettingCache::reset();
+  auto config = ConfiguratorFactory::create(ConfigFileFormat::Ini);
+  CoreConfig::init(config);
+  config->set_value("monitor/motion_quantum", 0);
+
+  auto monitor = std::make_shared<LocalActivityMonitor>(config, nullptr);
+  monitor->init();
+
+  int x = 100;
+  for (int i = 0; i < 1500; i++)
+    {
+      x += 4;
+      test::fire_mouse(x, 100);
+      sim->current_time += 1000;
+    }
+  ASSERT_TRUE(monitor->is_active());
+
+  // Past the idle threshold, with a button press between reading the last
+  // action time and moving the state to idle.
+  sim->current_time += 6000 * 1000;
+  bool pressed = false;
+  test::set_motion_time_probe([&]() {
+    if (!pressed)
+      {
+        pressed = true;
+        test::fire_button(true);
+      }
+  });
+
+  EXPECT_TRUE(monitor->is_active());
+  EXPECT_TRUE(pressed);
+  test::set_motion_time_probe({});
+
+  EXPECT_TRUE(monitor->is_active());
+}
@@ -0,0 +1,191 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "TimerStatusSegment.hh"
+#include "timerstatus.h"
+
+class TimerStatusTest : public ::testing::Test
+{
+protected:
+  TimerStatusTest()
+  {
+    std::string name = "workrave-timer-status-test";
+    const auto *info = ::testing::UnitTest::GetInstance()->current_test_info();
+    if (info != nullptr)
+      {
+        name += std::string("-") + info->name();
+      }
+    directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    path = directory / WORKRAVE_TIMER_STATUS_FILENAME;
+  }
+
+  ~TimerStatusTest() override
+  {
+    std::filesystem::remove_all(directory);
+  }
+
+  TimerStatusTest(const TimerStatusTest &) = delete;
+  TimerStatusTest &operator=(const TimerStatusTest &) = delete;
+  TimerStatusTest(TimerStatusTest &&) = delete;
+  TimerStatusTest &operator=(TimerStatusTest &&) = delete;
+
+  WorkraveTimerStatusReader *open_reader() const
+  {
+    return workrave_timer_status_open(path.c_str());
+  }
+
+  std::filesystem::path directory;
+  std::filesystem::path path;
+};
+
+namespace
+{
+  WorkraveTimerStatusData make_data()
+  {
+    WorkraveTimerStatusData data{};
+    data.updated = 1700000000;
+    data.operation_mode = 2;
+    data.breaks[0] = {120, 180, 3, WORKRAVE_TIMER_STATUS_STATE_PRELUDE, WORKRAVE_TIMER_STATUS_FLAG_ENABLED};
+    data.breaks[1] = {1200, 2700, 3, WORKRAVE_TIMER_STATUS_STATE_NONE, WORKRAVE_TIMER_STATUS_FLAG_ENABLED};
+    data.breaks[2] = {7200, -1, 0, WORKRAVE_TIMER_STATUS_STATE_NONE, 0};
+    return data;
+  }
+
+  struct ReaderDeleter
+  {
+    void operator()(WorkraveTimerStatusReader *reader) const
+    {
+      workrave_timer_status_close(reader);
+    }
+  };
+  using Reader = std::unique_ptr<WorkraveTimerStatusReader, ReaderDeleter>;
+} // namespace
+
+TEST_F(TimerStatusTest, publishedDataIsRead)
+{
+  TimerStatusSegment segment(path);
+  const WorkraveTimerStatusData expected = make_data();
+  segment.publish(expected);
+
+  Reader reader(open_reader());
+  ASSERT_NE(reader, nullptr);
+
+  WorkraveTimerStatusData data{};
+  ASSERT_EQ(workrave_timer_status_read(reader.get(), &data), WORKRAVE_TIMER_STATUS_OK);
+  EXPECT_EQ(std::memcmp(&data, &expected, sizeof(data)), 0);
+
+  WorkraveTimerStatusData next = expected;
+  next.breaks[0].elapsed++;
+  segment.publish(next);
+  ASSERT_EQ(workrave_timer_status_read(reader.get(), &data), WORKRAVE_TIMER_STATUS_OK);
+  EXPECT_EQ(data.breaks[0].elapsed, 121);
+}
+
+TEST_F(TimerStatusTest, readerRejectsMissingOrIncompatibleSegment)
+{
+  EXPECT_EQ(open_reader(), nullptr);
+
+  std::ofstream(path, std::ios::binary) << std::string(sizeof(WorkraveTimerStatusSegment), '\0');
+  EXPECT_EQ(open_reader(), nullptr);
+
+  std::filesystem::remove(path);
+  std::ofstream(path, std::ios::binary) << "WRTS";
+  EXPECT_EQ(open_reader(), nullptr);
+}
+
+TEST_F(TimerStatusTest, writerExitIsReported)
+{
+  auto segment = std::make_unique<TimerStatusSegment>(path);
+  segment->publish(make_data());
+
+  Reader reader(open_reader());
+  ASSERT_NE(reader, nullptr);
+
+  segment.reset();
+  EXPECT_FALSE(std::filesystem::exists(path));
+
+  WorkraveTimerStatusData data{};
+  EXPECT_EQ(workrave_timer_status_read(reader.get(), &data), WORKRAVE_TIMER_STATUS_CLOSED);
+}
+
+TEST_F(TimerStatusTest, restartDoesNotReuseMappedFile)
+{
+  auto first = std::make_unique<TimerStatusSegment>(path);
+  first->publish(make_data());
+  Reader old_reader(open_reader());
+  ASSERT_NE(old_reader, nullptr);
+
+  TimerStatusSegment second(path);
+  WorkraveTimerStatusData fresh = make_data();
+  fresh.updated++;
+  second.publish(fresh);
+
+  WorkraveTimerStatusData data{};
+  ASSERT_EQ(workrave_timer_status_read(old_reader.get(), &data), WORKRAVE_TIMER_STATUS_OK);
+  EXPECT_EQ(data.updated, 1700000000);
+
+  // The old writer exiting late must leave the new segment in place.
+  first.reset();
+  EXPECT_EQ(workrave_timer_status_read(old_reader.get(), &data), WORKRAVE_TIMER_STATUS_CLOSED);
+
+  Reader new_reader(open_reader());
+  ASSERT_NE(new_reader, nullptr);
+  ASSERT_EQ(workrave_timer_status_read(new_reader.get(), &data), WORKRAVE_TIMER_STATUS_OK);
+  EXPECT_EQ(data.updated, 1700000001);
+}
+
+TEST_F(TimerStatusTest, updateInProgressIsNotRead)
+{
+  TimerStatusSegment segment(path);
+  segment.publish(make_data());
+  Reader reader(open_reader());
+  ASSERT_NE(reader, nullptr);
+
+  // Stand in for a writer that is halfway through publish().
+  const int fd = ::open(path.c_str(), O_RDWR);
+  ASSERT_GE(fd, 0);
+  void *addr = ::mmap(nullptr, sizeof(WorkraveTimerStatusSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  ASSERT_NE(addr, MAP_FAILED);
+  auto *raw = static_cast<WorkraveTimerStatusSegment *>(addr);
+  raw->sequence++;
+
+  WorkraveTimerStatusData data{};
+  EXPECT_EQ(workrave_timer_status_read(reader.get(), &data), WORKRAVE_TIMER_STATUS_BUSY);
+
+  raw->sequence++;
+  EXPECT_EQ(workrave_timer_status_read(reader.get(), &data), WORKRAVE_TIMER_STATUS_OK);
+  ::munmap(addr, sizeof(WorkraveTimerStatusSegment));
+}
@@ -18,6 +18,8 @@
 #ifndef WORKRAVE_INPUT_MONITOR_IINPUTMONITOR_HH
 #define WORKRAVE_INPUT_MONITOR_IINPUTMONITOR_HH
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 
 namespace workrave
@@ -32,6 +34,16 @@ namespace workrave
     public:
       using Ptr = std::shared_ptr<IInputMonitor>;
 
+      //! Event counters, for diagnostics.
+      struct Statistics
+      {
+        //! Events reported by the platform.
+        uint64_t events_received{0};
+
+        //! Events passed on to listeners.
+        uint64_t events_forwarded{0};
+      };
+
       virtual ~IInputMonitor() = default;
 
       //! Initializes the activity monitor.
@@ -45,6 +57,20 @@ namespace workrave
 
       //! Unsubscribe for activity monitor.
       virtual void unsubscribe(IInputMonitorListener *listener) = 0;
+
+      //! Collapses bursts of mouse motion into at most one notification per quantum.
+      //!
+      //! Motion of less than sensitivity pixels is dropped, and significant motion is
+      //! reported through IInputMonitorListener::action_notify(). Significant motion is
+      //! only rate limited while all listeners report is_motion_coalescable(). A zero
+      //! quantum disables coalescing and reports every event through mouse_notify().
+      virtual void set_motion_coalescing(std::chrono::milliseconds quantum, int sensitivity) = 0;
+
+      //! Returns the monotonic time (usec) of the last significant motion, including coalesced motion.
+      [[nodiscard]] virtual int64_t get_last_motion_time() const = 0;
+
+      //! Returns the event counters.
+      [[nodiscard]] virtual Statistics get_statistics() const = 0;
     };
   } // namespace input_monitor
 } // namespace workrave
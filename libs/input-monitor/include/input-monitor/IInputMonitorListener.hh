@@ -39,6 +39,11 @@ namespace workrave
 
       //! Reports keyboard activity
       virtual void keyboard_notify(bool repeat) = 0;
+
+      //! Returns whether mouse motion may be rate limited without affecting the listener.
+      //!
+      //! Called from the input monitor thread for every coalescing decision.
+      virtual bool is_motion_coalescable() = 0;
     };
   } // namespace input_monitor
 } // namespace workrave
@@ -4,11 +4,16 @@
 #ifndef WORKRAVE_INPUT_MONITOR_FACTORY_STUB_HH
 #define WORKRAVE_INPUT_MONITOR_FACTORY_STUB_HH
 
+#include <functional>
+
 namespace workrave::input_monitor::test
 {
   void fire_mouse(int x, int y, int wheel = 0);
   void fire_button(bool is_press);
   void fire_keyboard(bool repeat);
+
+  //! Runs probe whenever the last motion time is asked for, to interleave input with a reader.
+  void set_motion_time_probe(std::function<void()> probe);
 } // namespace workrave::input_monitor::test
 
 #endif // WORKRAVE_INPUT_MONITOR_FACTORY_STUB_HH
@@ -21,7 +21,14 @@
 
 #include "InputMonitor.hh"
 
+#include <algorithm>
+#include <cstdlib>
+
+#include "input-monitor/IInputMonitorListener.hh"
+#include "utils/TimeSource.hh"
+
 using namespace workrave::input_monitor;
+using namespace workrave::utils;
 
 void
 InputMonitor::subscribe(IInputMonitorListener *listener)
@@ -35,27 +42,107 @@ InputMonitor::unsubscribe(IInputMonitorListener *listener)
   listeners.remove(listener);
 }
 
+void
+InputMonitor::set_motion_coalescing(std::chrono::milliseconds quantum, int sensitivity)
+{
+  motion_sensitivity.store(sensitivity, std::memory_order_relaxed);
+  motion_quantum.store(std::chrono::duration_cast<std::chrono::microseconds>(quantum).count(), std::memory_order_relaxed);
+}
+
+int64_t
+InputMonitor::get_last_motion_time() const
+{
+  return last_motion_time.load(std::memory_order_acquire);
+}
+
+IInputMonitor::Statistics
+InputMonitor::get_statistics() const
+{
+  return {events_received.load(std::memory_order_relaxed), events_forwarded.load(std::memory_order_relaxed)};
+}
+
+//! Returns whether motion exceeds the sensitivity, and records the position.
+bool
+InputMonitor::is_significant_motion(int x, int y, int wheel)
+{
+  const int delta_x = x - prev_x;
+  const int delta_y = y - prev_y;
+  prev_x = x;
+  prev_y = y;
+
+  const int threshold = motion_sensitivity.load(std::memory_order_relaxed);
+  return abs(delta_x) >= threshold || abs(delta_y) >= threshold || wheel != 0
+         || button_is_pressed.load(std::memory_order_relaxed);
+}
+
+bool
+InputMonitor::is_motion_coalescable()
+{
+  return std::all_of(listeners.begin(), listeners.end(), [](auto *l) { return l->is_motion_coalescable(); });
+}
+
 void
 InputMonitor::fire_action()
 {
+  events_received.fetch_add(1, std::memory_order_relaxed);
+  events_forwarded.fetch_add(1, std::memory_order_relaxed);
   for (auto &l: listeners)
     {
       l->action_notify();
     }
 }
 
+//! Reports mouse motion, coalescing bursts when enabled.
+//
+// While coalescing, jitter below the sensitivity is dropped here instead of
+// in the listener, and significant motion is reported as a generic action.
+// Significant motion is only dropped while the listeners report that it
+// cannot change their state, so their noise and activity thresholds see
+// every event they would have seen without coalescing.
 void
 InputMonitor::fire_mouse(int x, int y, int wheel)
 {
+  events_received.fetch_add(1, std::memory_order_relaxed);
+
+  const int64_t quantum = motion_quantum.load(std::memory_order_relaxed);
+  if (quantum == 0)
+    {
+      events_forwarded.fetch_add(1, std::memory_order_relaxed);
+      for (auto &l: listeners)
+        {
+          l->mouse_notify(x, y, wheel);
+        }
+      return;
+    }
+
+  if (!is_significant_motion(x, y, wheel))
+    {
+      return;
+    }
+
+  const int64_t now = TimeSource::get_monotonic_time_usec();
+  last_motion_time.store(now, std::memory_order_release);
+
+  if (now - last_forwarded_motion_time < quantum && is_motion_coalescable())
+    {
+      return;
+    }
+
+  last_forwarded_motion_time = now;
+  events_forwarded.fetch_add(1, std::memory_order_relaxed);
   for (auto &l: listeners)
     {
-      l->mouse_notify(x, y, wheel);
+      l->action_notify();
     }
 }
 
 void
 InputMonitor::fire_button(bool is_press)
 {
+  button_is_pressed.store(is_press, std::memory_order_relaxed);
+
+  events_received.fetch_add(1, std::memory_order_relaxed);
+  events_forwarded.fetch_add(1, std::memory_order_relaxed);
   for (auto &l: listeners)
     {
       l->button_notify(is_press);
@@ -65,6 +152,8 @@ InputMonitor::fire_button(bool is_press)
 void
 InputMonitor::fire_keyboard(bool repeat)
 {
+  events_received.fetch_add(1, std::memory_order_relaxed);
+  events_forwarded.fetch_add(1, std::memory_order_relaxed);
   for (auto &l: listeners)
     {
       l->keyboard_notify(repeat);
@@ -18,6 +18,7 @@
 #ifndef INPUTMONITOR_HH
 #define INPUTMONITOR_HH
 
+#include <atomic>
 #include <list>
 
 #include "input-monitor/IInputMonitor.hh"
@@ -29,6 +30,9 @@ class InputMonitor : public workrave::input_monitor::IInputMonitor
 public:
   void subscribe(workrave::input_monitor::IInputMonitorListener *listener) override;
   void unsubscribe(workrave::input_monitor::IInputMonitorListener *listener) override;
+  void set_motion_coalescing(std::chrono::milliseconds quantum, int sensitivity) override;
+  int64_t get_last_motion_time() const override;
+  Statistics get_statistics() const override;
 
 protected:
   void fire_action();
@@ -37,7 +41,32 @@ protected:
   void fire_keyboard(bool repeat);
 
 private:
+  bool is_significant_motion(int x, int y, int wheel);
+  bool is_motion_coalescable();
+
   std::list<workrave::input_monitor::IInputMonitorListener *> listeners;
+
+  //! Coalescing quantum in microseconds, 0 when disabled.
+  std::atomic<int64_t> motion_quantum{0};
+
+  //! Minimum motion in pixels that counts as activity while coalescing.
+  std::atomic<int> motion_sensitivity{3};
+
+  //! Time of the last significant motion, forwarded or not.
+  std::atomic<int64_t> last_motion_time{0};
+
+  //! Is a mouse button currently pressed?
+  std::atomic<bool> button_is_pressed{false};
+
+  //! Previous mouse position. Only used by the input thread.
+  int prev_x{-10};
+  int prev_y{-10};
+
+  //! Time the last significant motion was forwarded. Only used by the input thread.
+  int64_t last_forwarded_motion_time{0};
+
+  std::atomic<uint64_t> events_received{0};
+  std::atomic<uint64_t> events_forwarded{0};
 };
 
 #endif // INPUTMONITOR_HH
@@ -20,6 +20,7 @@
 #include "input-monitor/InputMonitorFactoryStub.hh"
 #include "input-monitor/IInputMonitor.hh"
 #include "input-monitor/IInputMonitorListener.hh"
+#include "InputMonitor.hh"
 
 #include "config/IConfigurator.hh"
 
@@ -29,15 +30,11 @@
 using namespace workrave::input_monitor;
 using namespace workrave::config;
 
-namespace
-{
-  std::vector<IInputMonitorListener *> listeners;
-}
-
-class InputMonitorStub : public IInputMonitor
+class InputMonitorStub : public InputMonitor
 {
 public:
-  ~InputMonitorStub() override = default;
+  InputMonitorStub();
+  ~InputMonitorStub() override;
 
   bool init() override
   {
@@ -48,44 +45,72 @@ public:
   {
   }
 
-  void subscribe(IInputMonitorListener *listener) override
-  {
-    listeners.push_back(listener);
-  }
+  int64_t get_last_motion_time() const override;
 
-  void unsubscribe(IInputMonitorListener *listener) override
-  {
-    std::erase(listeners, listener);
-  }
+  using InputMonitor::fire_button;
+  using InputMonitor::fire_keyboard;
+  using InputMonitor::fire_mouse;
 };
 
+namespace
+{
+  std::vector<InputMonitorStub *> monitors;
+  std::function<void()> motion_time_probe;
+} // namespace
+
+InputMonitorStub::InputMonitorStub()
+{
+  monitors.push_back(this);
+}
+
+InputMonitorStub::~InputMonitorStub()
+{
+  std::erase(monitors, this);
+}
+
+int64_t
+InputMonitorStub::get_last_motion_time() const
+{
+  if (motion_time_probe)
+    {
+      motion_time_probe();
+    }
+  return InputMonitor::get_last_motion_time();
+}
+
 void
 workrave::input_monitor::test::fire_mouse(int x, int y, int wheel)
 {
-  for (auto *listener: listeners)
+  for (auto *monitor: monitors)
     {
-      listener->mouse_notify(x, y, wheel);
+      monitor->fire_mouse(x, y, wheel);
     }
 }
 
 void
 workrave::input_monitor::test::fire_button(bool is_press)
 {
-  for (auto *listener: listeners)
+  for (auto *monitor: monitors)
     {
-      listener->button_notify(is_press);
+      monitor->fire_button(is_press);
     }
 }
 
 void
 workrave::input_monitor::test::fire_keyboard(bool repeat)
 {
-  for (auto *listener: listeners)
+  for (auto *monitor: monitors)
     {
-      listener->keyboard_notify(repeat);
+      monitor->fire_keyboard(repeat);
     }
 }
 
+void
+workrave::input_monitor::test::set_motion_time_probe(std::function<void()> probe)
+{
+  motion_time_probe = std::move(probe);
+}
+
 void
 InputMonitorFactory::init(IConfigurator::Ptr config, const char *display)
 {
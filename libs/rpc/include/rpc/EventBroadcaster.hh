@@ -0,0 +1,524 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef WORKRAVE_RPC_EVENTBROADCASTER_HH
+#define WORKRAVE_RPC_EVENTBROADCASTER_HH
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/signals2.hpp>
+#include <grpcpp/alarm.h>
+#include <grpcpp/grpcpp.h>
+
+#include "rpc/EventQueue.hh"
+#include "rpc/Executor.hh"
+
+// Fans one signal out to every subscriber of a gRPC server-streaming RPC
+// without dedicating a thread to any of them. Each subscriber is a
+// callback-API ServerWriteReactor with one write in flight; the next event
+// is written from OnWriteDone(), and a client that goes away is noticed
+// through OnCancel() rather than by polling.
+//
+// The broadcaster holds a single connection to the source signal while it
+// has subscribers: an emission is encoded once by the slot and shared by
+// all streams.
+//
+// Each stream buffers what the client has not read yet in a bounded
+// EventQueue, configured per broadcaster: a client that stops reading
+// either loses events under the queue's OverflowPolicy or, by default, is
+// disconnected with RESOURCE_EXHAUSTED. stats() reports how close the
+// queues came to their capacity and what was lost; the same figures are
+// reported process-wide under the event's message name (see
+// rpc::event_queue_stats()).
+//
+// A stream of state frames (e.g. the timer snapshot) can be subscribed with
+// StreamOptions: the client picks a minimum interval between writes, only
+// the newest pending frame is kept, and a new subscriber starts with the
+// current state instead of waiting for the next change. That state is taken
+// on the executor's thread; the subscribing gRPC thread does not wait for it.
+namespace rpc
+{
+  struct StreamOptions
+  {
+    // Minimum time between the start of two writes; 0 writes each event as
+    // soon as the previous write has completed.
+    std::chrono::milliseconds min_interval{0};
+
+    // Keep only the newest pending event, dropping the ones the client had
+    // no time for, and send the current state on subscribe.
+    bool latest_only{false};
+  };
+
+  template<typename Event>
+  class EventBroadcaster
+  {
+  public:
+    // Connects the source signal to publish(). Only called when the first
+    // subscriber arrives.
+    using Connector = std::function<boost::signals2::connection(EventBroadcaster &)>;
+
+    // Produces the current state for a latest_only subscriber.
+    using Snapshot = std::function<Event()>;
+
+    using QueueOptions = EventQueueOptions<std::shared_ptr<const Event>>;
+
+    // Called, without any lock held, when the last subscriber has gone. It
+    // may destroy the broadcaster.
+    using EmptyHandler = std::function<void()>;
+
+    explicit EventBroadcaster(QueueOptions queue_options = {}, EmptyHandler on_empty = {})
+      : queue_options_(std::move(queue_options))
+      , on_empty_(std::move(on_empty))
+      , stats_id_(register_event_queue_stats(std::string(Event::descriptor()->full_name()), [this]() { return stats(); }))
+    {
+    }
+
+    ~EventBroadcaster()
+    {
+      unregister_event_queue_stats(stats_id_);
+    }
+
+    EventBroadcaster(const EventBroadcaster &) = delete;
+    EventBroadcaster &operator=(const EventBroadcaster &) = delete;
+
+    // Returns the reactor for a new stream; gRPC owns it from here on.
+    // For a latest_only stream that finds nothing published since the source
+    // was connected, current() is dispatched to executor; the stream starts
+    // with its result, unless an event was published meanwhile. If current()
+    // throws, the stream is finished with INVALID_ARGUMENT. Throws
+    // ExecutorClosed if the executor no longer accepts calls.
+    grpc::ServerWriteReactor<Event> *subscribe(const Connector &connect,
+                                               const StreamOptions &options = {},
+                                               const Snapshot &current = {},
+                                               Executor &executor = Executor::inline_executor())
+    {
+      auto *stream = new Stream(*this, options);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        streams_.push_back(stream);
+        if (!connection_.connected())
+          {
+            connection_ = connect(*this);
+          }
+        if (!options.latest_only || !current)
+          {
+            return stream;
+          }
+        if (latest_)
+          {
+            stream->push(latest_);
+            return stream;
+          }
+        stream->expect_snapshot();
+      }
+
+      try
+        {
+          executor.dispatch([stream, current]() { stream->deliver_snapshot(current); });
+        }
+      catch (...)
+        {
+          unsubscribe(stream);
+          delete stream;
+          throw;
+        }
+      return stream;
+    }
+
+    void publish(Event event)
+    {
+      auto shared = std::make_shared<const Event>(std::move(event));
+      std::lock_guard<std::mutex> lock(mutex_);
+      latest_ = shared;
+      for (Stream *stream: streams_)
+        {
+          stream->push(shared);
+        }
+    }
+
+    [[nodiscard]] size_t subscriber_count() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return streams_.size();
+    }
+
+    // Queue statistics of all streams so far, open and closed.
+    [[nodiscard]] EventQueueStats stats() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      EventQueueStats stats = closed_stats_;
+      for (const Stream *stream: streams_)
+        {
+          stats.add(stream->stats());
+        }
+      return stats;
+    }
+
+  private:
+    class Stream : public grpc::ServerWriteReactor<Event>
+    {
+    public:
+      Stream(EventBroadcaster &owner, const StreamOptions &options)
+        : owner_(owner)
+        , options_(options)
+        , pending_(options.latest_only ? QueueOptions{.capacity = 1, .policy = OverflowPolicy::DropOldest}
+                                       : owner.queue_options_)
+      {
+      }
+
+      void push(std::shared_ptr<const Event> event)
+      {
+        const bool accepted = pending_.push(std::move(event));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        received_ = true;
+        if (!accepted)
+          {
+            finish(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "client does not keep up with events"));
+          }
+        else if (!writing_)
+          {
+            write_next();
+          }
+      }
+
+      [[nodiscard]] EventQueueStats stats() const
+      {
+        return pending_.stats();
+      }
+
+      // Keeps the stream alive until deliver_snapshot() has run.
+      void expect_snapshot()
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        snapshot_pending_ = true;
+      }
+
+      // Runs on the executor's thread.
+      void deliver_snapshot(const Snapshot &current)
+      {
+        std::shared_ptr<const Event> initial;
+        grpc::Status error;
+        try
+          {
+            initial = std::make_shared<const Event>(current());
+          }
+        catch (const std::exception &e)
+          {
+            error = grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, e.what());
+          }
+
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          snapshot_pending_ = false;
+          if (!done_)
+            {
+              if (!initial)
+                {
+                  finish(std::move(error));
+                }
+              else if (!received_)
+                {
+                  // Anything published meanwhile is at least as new.
+                  pending_.push(std::move(initial));
+                  if (!writing_)
+                    {
+                      write_next();
+                    }
+                }
+              return;
+            }
+          if (waiting_)
+            {
+              return;
+            }
+        }
+        delete this;
+      }
+
+      void OnWriteDone(bool ok) override
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        writing_ = false;
+        if (!ok)
+          {
+            finish(grpc::Status::OK);
+            return;
+          }
+        write_next();
+      }
+
+      void OnCancel() override
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finish(grpc::Status::OK);
+      }
+
+      void OnDone() override
+      {
+        owner_.unsubscribe(this);
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          done_ = true;
+          if (waiting_)
+            {
+              // The cancelled alarm still runs on_alarm().
+              alarm_.Cancel();
+            }
+          if (waiting_ || snapshot_pending_)
+            {
+              // Deleted by whichever of on_alarm() and deliver_snapshot()
+              // runs last.
+              return;
+            }
+        }
+        delete this;
+      }
+
+    private:
+      // Must be called with mutex_ held.
+      void write_next()
+      {
+        if (finished_ || waiting_ || pending_.empty())
+          {
+            return;
+          }
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto due = last_write_ + options_.min_interval;
+        if (now < due)
+          {
+            // Events that arrive until then replace the pending one if the
+            // stream is latest_only.
+            waiting_ = true;
+            alarm_.Set(std::chrono::system_clock::now()
+                         + std::chrono::duration_cast<std::chrono::system_clock::duration>(due - now),
+                       [this](bool /*ok*/) { on_alarm(); });
+            return;
+          }
+
+        if (pending_.try_pop(current_))
+          {
+            writing_ = true;
+            last_write_ = now;
+            this->StartWrite(current_.get());
+          }
+      }
+
+      void on_alarm()
+      {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          waiting_ = false;
+          if (!done_)
+            {
+              if (!writing_)
+                {
+                  write_next();
+                }
+              return;
+            }
+          if (snapshot_pending_)
+            {
+              return;
+            }
+        }
+        delete this;
+      }
+
+      // Must be called with mutex_ held.
+      void finish(grpc::Status status)
+      {
+        if (!finished_)
+          {
+            finished_ = true;
+            this->Finish(std::move(status));
+          }
+      }
+
+      EventBroadcaster &owner_;
+      const StreamOptions options_;
+      EventQueue<std::shared_ptr<const Event>> pending_;
+      std::mutex mutex_;
+      grpc::Alarm alarm_;
+      std::shared_ptr<const Event> current_;
+      std::chrono::steady_clock::time_point last_write_;
+      bool writing_{false};
+      bool waiting_{false};
+      bool finished_{false};
+      bool done_{false};
+      bool received_{false};
+      bool snapshot_pending_{false};
+    };
+
+    void unsubscribe(Stream *stream)
+    {
+      EmptyHandler on_empty;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = std::find(streams_.begin(), streams_.end(), stream);
+        if (it == streams_.end())
+          {
+            return;
+          }
+        closed_stats_.add(stream->stats());
+        streams_.erase(it);
+        if (!streams_.empty())
+          {
+            return;
+          }
+
+        // Without a connection the cached event would go stale.
+        connection_.disconnect();
+        latest_.reset();
+        on_empty = on_empty_;
+      }
+
+      // Must be last: this may be gone afterwards.
+      if (on_empty)
+        {
+          on_empty();
+        }
+    }
+
+  private:
+    const QueueOptions queue_options_;
+    const EmptyHandler on_empty_;
+    mutable std::mutex mutex_;
+    std::vector<Stream *> streams_;
+    EventQueueStats closed_stats_;
+    const uint64_t stats_id_;
+    boost::signals2::scoped_connection connection_;
+    std::shared_ptr<const Event> latest_;
+  };
+
+  // One broadcaster per instance of a keyed service (see rpc::InstanceRegistry).
+  // A broadcaster exists only while its key has subscribers, so instances that
+  // come and go do not leave broadcasters behind.
+  template<typename Key, typename Event>
+  class KeyedEventBroadcaster
+  {
+  public:
+    using Broadcaster = EventBroadcaster<Event>;
+    using QueueOptions = typename Broadcaster::QueueOptions;
+
+    explicit KeyedEventBroadcaster(QueueOptions queue_options = {})
+      : queue_options_(std::move(queue_options))
+    {
+    }
+
+    KeyedEventBroadcaster(const KeyedEventBroadcaster &) = delete;
+    KeyedEventBroadcaster &operator=(const KeyedEventBroadcaster &) = delete;
+
+    // See EventBroadcaster::subscribe().
+    grpc::ServerWriteReactor<Event> *subscribe(const Key &key,
+                                               const typename Broadcaster::Connector &connect,
+                                               const StreamOptions &options = {},
+                                               const typename Broadcaster::Snapshot &current = {},
+                                               Executor &executor = Executor::inline_executor())
+    {
+      // The reference keeps the broadcaster alive until the stream is in it.
+      std::shared_ptr<Broadcaster> broadcaster = get(key);
+      grpc::ServerWriteReactor<Event> *stream = nullptr;
+      try
+        {
+          stream = broadcaster->subscribe(connect, options, current, executor);
+        }
+      catch (...)
+        {
+          broadcaster.reset();
+          prune(key);
+          throw;
+        }
+
+      // The stream may have ended already, while the reference kept the
+      // broadcaster from being pruned.
+      broadcaster.reset();
+      prune(key);
+      return stream;
+    }
+
+    // The number of keys that have a broadcaster.
+    [[nodiscard]] size_t size() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return broadcasters_.size();
+    }
+
+  private:
+    std::shared_ptr<Broadcaster> get(const Key &key)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &broadcaster = broadcasters_[key];
+      if (!broadcaster)
+        {
+          broadcaster = std::make_shared<Broadcaster>(queue_options_, [this, key]() { prune(key); });
+        }
+      return broadcaster;
+    }
+
+    void prune(const Key &key)
+    {
+      std::shared_ptr<Broadcaster> pruned;
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto it = broadcasters_.find(key);
+      if (it != broadcasters_.end() && it->second.use_count() == 1 && it->second->subscriber_count() == 0)
+        {
+          // Destroyed once the lock is released.
+          pruned = std::move(it->second);
+          broadcasters_.erase(it);
+        }
+    }
+
+    const QueueOptions queue_options_;
+    mutable std::mutex mutex_;
+    std::map<Key, std::shared_ptr<Broadcaster>> broadcasters_;
+  };
+
+  // A stream that ends right away with an error status, e.g. when the
+  // request names an instance that is not registered.
+  template<typename Event>
+  grpc::ServerWriteReactor<Event> *reject_stream(grpc::Status status)
+  {
+    class Rejected : public grpc::ServerWriteReactor<Event>
+    {
+    public:
+      explicit Rejected(grpc::Status status)
+      {
+        this->Finish(std::move(status));
+      }
+
+      void OnDone() override
+      {
+        delete this;
+      }
+    };
+    return new Rejected(std::move(status));
+  }
+} // namespace rpc
+
+#endif // WORKRAVE_RPC_EVENTBROADCASTER_HH
@@ -14,67 +14,219 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
-
 #ifndef WORKRAVE_RPC_EVENTQUEUE_HH
 #define WORKRAVE_RPC_EVENTQUEUE_HH
 
-#include <chrono>
-#include <condition_variable>
-#include <deque>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <mutex>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
-#include <grpcpp/grpcpp.h>
-
-// Bridges a synchronous callback source (a boost::signals2::signal, firing
-// on whatever thread calls e.g. Core::set_operation_mode()) into a gRPC
-// server-streaming RPC handler, which must call ServerWriter::Write() only
-// from its own handler thread. The signal's slot pushes events into this
-// queue; the handler thread pops them and writes them out — never called
-// concurrently from two threads.
+// Per-subscriber buffer of a gRPC server-streaming RPC (see
+// rpc::EventBroadcaster). A synchronous callback source (a
+// boost::signals2::signal, firing on whatever thread calls e.g.
+// Core::set_operation_mode()) pushes events; the stream's reactor pops them
+// one at a time as each previous write completes. Nothing ever blocks on
+// the queue: an empty queue just means the reactor goes quiet until the
+// next push.
 //
-// wait_and_pop() polls with a short timeout (rather than waiting forever)
-// so it notices client disconnects/cancellation even when no new event
-// ever arrives.
+// The queue is a ring buffer of at most `capacity` events, so a client that
+// stops reading costs a fixed amount of memory. What happens to an event
+// that does not fit is chosen per stream (see OverflowPolicy).
 namespace rpc
 {
+  enum class OverflowPolicy
+  {
+    // Discard the oldest pending event. For state, where only the newest
+    // value matters.
+    DropOldest,
+
+    // A new event replaces the pending event with the same key, wherever
+    // it is queued; if there is none and the queue is full, the oldest is
+    // discarded. For state of several objects, e.g. one value per setting.
+    Coalesce,
+
+    // Reject the event. For events a client cannot miss: the stream is
+    // ended instead, and the client can resubscribe and resynchronize.
+    Disconnect,
+  };
+
+  struct EventQueueStats
+  {
+    // Most events pending at any one time.
+    size_t high_water{0};
+    // Events discarded to make room (DropOldest, Coalesce).
+    size_t dropped{0};
+    // Events replaced by a newer one with the same key (Coalesce).
+    size_t coalesced{0};
+    // Events refused because the queue was full (Disconnect).
+    size_t rejected{0};
+
+    void add(const EventQueueStats &other)
+    {
+      high_water = std::max(high_water, other.high_water);
+      dropped += other.dropped;
+      coalesced += other.coalesced;
+      rejected += other.rejected;
+    }
+  };
+
+  struct StreamQueueStats
+  {
+    std::string stream;
+    EventQueueStats stats;
+  };
+
+  // Process-wide queue statistics by stream, so that they can be reported
+  // outside the service that owns the queues. A source is asked for its
+  // figures on every report; what it reported last is kept once it
+  // unregisters, so streams that come and go are still counted.
+  using EventQueueStatsSource = std::function<EventQueueStats()>;
+
+  // Returns the id to unregister the source with.
+  [[nodiscard]] uint64_t register_event_queue_stats(std::string_view stream, EventQueueStatsSource source);
+  void unregister_event_queue_stats(uint64_t id);
+
+  // Statistics of every stream that had a source so far, ordered by stream.
+  [[nodiscard]] std::vector<StreamQueueStats> event_queue_stats();
+
+  template<typename T>
+  struct EventQueueOptions
+  {
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    // 0 means unbounded.
+    size_t capacity{DEFAULT_CAPACITY};
+    OverflowPolicy policy{OverflowPolicy::Disconnect};
+    // Coalesce only: whether two events are about the same thing.
+    std::function<bool(const T &, const T &)> same_key;
+  };
+
   template<typename T>
   class EventQueue
   {
   public:
-    void push(T value)
+    explicit EventQueue(EventQueueOptions<T> options = {})
+      : options_(std::move(options))
     {
-      std::lock_guard<std::mutex> lock(mutex_);
-      queue_.push_back(std::move(value));
-      cv_.notify_one();
     }
 
-    // Blocks until an event is available or the context is cancelled.
-    // Returns false when the stream should end (client gone).
-    bool wait_and_pop(T &out, grpc::ServerContext *context)
+    // Returns false if the event was refused (OverflowPolicy::Disconnect).
+    bool push(T value)
     {
-      std::unique_lock<std::mutex> lock(mutex_);
-      while (queue_.empty())
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (options_.policy == OverflowPolicy::Coalesce && options_.same_key)
+        {
+          for (size_t i = 0; i < count_; i++)
+            {
+              T &pending = at(i);
+              if (options_.same_key(pending, value))
+                {
+                  pending = std::move(value);
+                  stats_.coalesced++;
+                  return true;
+                }
+            }
+        }
+
+      if (options_.capacity != 0 && count_ >= options_.capacity)
         {
-          if (context->IsCancelled())
+          if (options_.policy == OverflowPolicy::Disconnect)
             {
+              stats_.rejected++;
               return false;
             }
-          cv_.wait_for(lock, std::chrono::milliseconds(200));
+          pop_front();
+          stats_.dropped++;
         }
-      if (context->IsCancelled())
+
+      if (count_ == slots_.size())
+        {
+          grow();
+        }
+      at(count_) = std::move(value);
+      count_++;
+      stats_.high_water = std::max(stats_.high_water, count_);
+      return true;
+    }
+
+    // Returns false if no event is pending.
+    bool try_pop(T &out)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (count_ == 0)
         {
           return false;
         }
-      out = std::move(queue_.front());
-      queue_.pop_front();
+      out = std::move(at(0));
+      pop_front();
       return true;
     }
 
+    [[nodiscard]] bool empty() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return count_ == 0;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return count_;
+    }
+
+    [[nodiscard]] EventQueueStats stats() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return stats_;
+    }
+
   private:
-    std::mutex mutex_;
-    std::condition_variable cv_;
-    std::deque<T> queue_;
+    // Must be called with mutex_ held.
+    T &at(size_t index)
+    {
+      return slots_[(head_ + index) % slots_.size()];
+    }
+
+    // Must be called with mutex_ held.
+    void pop_front()
+    {
+      // Reset the slot so that it does not keep the event alive.
+      at(0) = T{};
+      head_ = (head_ + 1) % slots_.size();
+      count_--;
+    }
+
+    // Must be called with mutex_ held. Slots are allocated as needed, never
+    // beyond the capacity.
+    void grow()
+    {
+      size_t size = std::max<size_t>(slots_.size() * 2, 8);
+      if (options_.capacity != 0)
+        {
+          size = std::min(size, options_.capacity);
+        }
+
+      std::vector<T> slots(size);
+      for (size_t i = 0; i < count_; i++)
+        {
+          slots[i] = std::move(at(i));
+        }
+      slots_.swap(slots);
+      head_ = 0;
+    }
+
+    const EventQueueOptions<T> options_;
+    mutable std::mutex mutex_;
+    std::vector<T> slots_;
+    size_t head_{0};
+    size_t count_{0};
+    EventQueueStats stats_;
   };
 } // namespace rpc
 
@@ -0,0 +1,134 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef WORKRAVE_RPC_EXECUTOR_HH
+#define WORKRAVE_RPC_EXECUTOR_HH
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rpc/RpcException.hh"
+
+// Decides which thread runs the real method behind a generated gRPC
+// handler. gRPC calls handlers on its own worker threads, while Core, Break
+// and the Configurator are otherwise only touched from the GLib/Qt main
+// loop (heartbeat, UI). A generated adapter hands every call to its
+// Executor; decoding the request and encoding the response stay on the
+// gRPC thread.
+namespace rpc
+{
+  // Thrown by Executor::run() once the executor no longer accepts calls.
+  // Generated handlers report it as UNAVAILABLE.
+  class ExecutorClosed : public RpcException
+  {
+  public:
+    ExecutorClosed()
+      : RpcException("server is shutting down")
+    {
+    }
+  };
+
+  class Executor
+  {
+  public:
+    virtual ~Executor() = default;
+
+    // Runs f on the executor's thread, blocks until it is done and returns
+    // its result. Exceptions thrown by f are rethrown here.
+    template<typename F>
+    std::invoke_result_t<F &> run(F &&f)
+    {
+      using Result = std::invoke_result_t<F &>;
+      if (runs_on_current_thread())
+        {
+          return f();
+        }
+
+      auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+      std::future<Result> result = task->get_future();
+      post([task] { (*task)(); });
+      return result.get();
+    }
+
+    // Runs f on the executor's thread without waiting for it: directly when
+    // called on that thread, queued otherwise. f must not throw. Throws
+    // ExecutorClosed if the executor no longer accepts calls.
+    void dispatch(std::function<void()> f)
+    {
+      if (runs_on_current_thread())
+        {
+          f();
+          return;
+        }
+      post(std::move(f));
+    }
+
+    // Runs every call directly on the calling thread; the default for
+    // generated adapters.
+    static Executor &inline_executor();
+
+  protected:
+    [[nodiscard]] virtual bool runs_on_current_thread() const = 0;
+
+    // Queues a task for the executor's thread. Throws ExecutorClosed if the
+    // executor no longer accepts calls.
+    virtual void post(std::function<void()> task) = 0;
+  };
+
+  // Marshals calls onto an event loop that owns the target objects. The
+  // loop is woken once per batch: wakeup() is called (from any thread) when
+  // the first call is queued, and the loop then runs everything queued so
+  // far from a single drain(). Calls made on the loop's own thread run
+  // directly, so a handler can never wait for itself.
+  class LoopExecutor : public Executor
+  {
+  public:
+    explicit LoopExecutor(std::function<void()> wakeup);
+    ~LoopExecutor() override;
+
+    LoopExecutor(const LoopExecutor &) = delete;
+    LoopExecutor &operator=(const LoopExecutor &) = delete;
+
+    // Runs all calls queued so far. Owning loop only.
+    void drain();
+
+    // Runs what is still queued and rejects later calls, so that shutting
+    // down the server cannot wait for a loop that is busy doing just that.
+    // Owning loop only.
+    void close();
+
+  protected:
+    [[nodiscard]] bool runs_on_current_thread() const override;
+    void post(std::function<void()> task) override;
+
+  private:
+    std::function<void()> wakeup_;
+    const std::thread::id owner_{std::this_thread::get_id()};
+    std::mutex mutex_;
+    std::vector<std::function<void()>> pending_;
+    bool wakeup_requested_{false};
+    bool closed_{false};
+  };
+} // namespace rpc
+
+#endif // WORKRAVE_RPC_EXECUTOR_HH
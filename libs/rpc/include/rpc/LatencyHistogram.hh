@@ -0,0 +1,87 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef WORKRAVE_RPC_LATENCYHISTOGRAM_HH
+#define WORKRAVE_RPC_LATENCYHISTOGRAM_HH
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rpc
+{
+  // Call latencies of one RPC method, in log-linear (HDR-style) buckets:
+  // exact below 8 µs, then 8 buckets per power of two, so every bucket is
+  // within 12.5% of the latencies it counts. Recording is a handful of
+  // relaxed atomic increments and never blocks, so it can run on every call;
+  // a summary is computed from a racy but consistent-enough copy.
+  class LatencyHistogram
+  {
+  public:
+    struct Summary
+    {
+      uint64_t calls{0};
+      uint64_t failed{0};
+      std::chrono::microseconds mean{0};
+      std::chrono::microseconds p50{0};
+      std::chrono::microseconds p90{0};
+      std::chrono::microseconds p99{0};
+      std::chrono::microseconds max{0};
+    };
+
+    void record(std::chrono::microseconds latency, bool ok) noexcept;
+    [[nodiscard]] Summary summarize() const;
+
+    // Latencies beyond the last bucket (about 19 hours) are counted in it.
+    static constexpr int sub_bucket_bits = 3;
+    static constexpr int max_exponent = 36;
+    static constexpr std::size_t bucket_count = (max_exponent - sub_bucket_bits + 1) << sub_bucket_bits;
+
+    [[nodiscard]] static std::size_t bucket_index(uint64_t usec) noexcept;
+    // The largest latency counted in the bucket.
+    [[nodiscard]] static uint64_t bucket_upper_bound(std::size_t index) noexcept;
+
+  private:
+    std::array<std::atomic<uint64_t>, bucket_count> buckets_{};
+    std::atomic<uint64_t> calls_{0};
+    std::atomic<uint64_t> failed_{0};
+    std::atomic<uint64_t> total_usec_{0};
+    std::atomic<uint64_t> max_usec_{0};
+  };
+
+  struct MethodLatency
+  {
+    std::string service;
+    std::string method;
+    LatencyHistogram::Summary summary;
+  };
+
+  // The process-wide histogram of service/method, created on first use and
+  // never destroyed, so callers may keep the reference (generated services
+  // look it up once per method).
+  [[nodiscard]] LatencyHistogram &method_latency_histogram(std::string_view service, std::string_view method);
+
+  // Summaries of every method called so far, ordered by service and method.
+  [[nodiscard]] std::vector<MethodLatency> method_latencies();
+} // namespace rpc
+
+#endif // WORKRAVE_RPC_LATENCYHISTOGRAM_HH
@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string_view>
 
+#include <grpcpp/support/status.h>
+
 namespace google::protobuf
 {
   class Message;
@@ -14,11 +18,29 @@ namespace google::protobuf
 
 namespace rpc
 {
+  class LatencyHistogram;
+
   struct RequestInfo
   {
     std::string_view service;
     std::string_view method;
     const google::protobuf::Message &request;
+    // Partially filled or empty unless status is OK.
+    const google::protobuf::Message &response;
+    const grpc::Status &status;
+    // From entering the generated handler, so including any wait for the
+    // executor, to completion.
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+
+    // Encoded sizes in bytes; computed on request, as they are not free.
+    [[nodiscard]] std::size_t request_size() const;
+    [[nodiscard]] std::size_t response_size() const;
+
+    [[nodiscard]] std::chrono::microseconds latency() const
+    {
+      return std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    }
   };
 
   using RequestInterceptor = std::function<void(const RequestInfo &)>;
@@ -56,7 +78,9 @@ namespace rpc
 
   [[nodiscard]] RequestInterceptorRegistration register_request_interceptor(RequestInterceptor interceptor);
 
-  // Called by generated adapters after the real C++ method completed
-  // successfully. Interceptor failures never change the primary RPC result.
-  void intercept_request(const RequestInfo &request) noexcept;
+  // Called by generated adapters after every unary call, failed ones
+  // included. Sets request.end, records the latency in the method's
+  // histogram and then runs the interceptors. Interceptor failures never
+  // change the primary RPC result.
+  void intercept_request(LatencyHistogram &latency, RequestInfo request) noexcept;
 } // namespace rpc
@@ -36,9 +36,11 @@ namespace rpc
 {
   struct ServerConfig
   {
-    // e.g. "127.0.0.1:0" (ephemeral loopback, used by tests) or
+    // e.g. "127.0.0.1:0" (ephemeral loopback) or
     // "unix:/run/workrave/rpc.sock". A configuration point, not hardcoded —
     // the production transport choice is deliberately deferred, see the plan.
+    // Empty: no listener at all, only in_process_channel() reaches the
+    // services (tests, embedding).
     std::string listen_address;
     std::shared_ptr<grpc::ServerCredentials> credentials = grpc::InsecureServerCredentials();
 
@@ -76,6 +78,14 @@ namespace rpc
       return bound_port_;
     }
 
+    // A channel to the running server that bypasses sockets and HTTP/2
+    // framing altogether; requests still go through protobuf and the
+    // generated services. Available with or without a listen address.
+    // Unlike a socket client, an in-process channel must not be used after
+    // shutdown(): gRPC does not fail such calls cleanly. Throws RpcException
+    // if the server is not running.
+    [[nodiscard]] std::shared_ptr<grpc::Channel> in_process_channel() const;
+
   private:
     void remove_stale_unix_socket() const;
 
@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <list>
 #include <map>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -14,6 +16,7 @@
 #include <gio/gio.h>
 
 #include "rpc/dbus/Error.hh"
+#include "rpc/dbus/GioSerializer.hh"
 #include "rpc/dbus/WireTypes.hh"
 
 namespace workrave::rpc::dbus
@@ -324,15 +327,22 @@ namespace workrave::rpc::dbus
 
     static GVariant *encode(const std::vector<Value> &value)
     {
-      const std::string signature = GioSignature<std::vector<Value>>::value();
-      GVariantType *type = g_variant_type_new(signature.c_str());
-      GVariantBuilder builder;
-      g_variant_builder_init(&builder, type);
-      for (const auto &item: value)
-        g_variant_builder_add_value(&builder, GioCodec<Value>::encode(item));
-      GVariant *result = g_variant_builder_end(&builder);
-      g_variant_type_free(type);
-      return result;
+      if constexpr (GioSerializable<std::vector<Value>>)
+        {
+          return gio_serialize(value);
+        }
+      else
+        {
+          const std::string signature = GioSignature<std::vector<Value>>::value();
+          GVariantType *type = g_variant_type_new(signature.c_str());
+          GVariantBuilder builder;
+          g_variant_builder_init(&builder, type);
+          for (const auto &item: value)
+            g_variant_builder_add_value(&builder, GioCodec<Value>::encode(item));
+          GVariant *result = g_variant_builder_end(&builder);
+          g_variant_type_free(type);
+          return result;
+        }
     }
   };
 
@@ -363,15 +373,22 @@ namespace workrave::rpc::dbus
 
     static GVariant *encode(const std::list<Value> &value)
     {
-      const std::string signature = GioSignature<std::list<Value>>::value();
-      GVariantType *type = g_variant_type_new(signature.c_str());
-      GVariantBuilder builder;
-      g_variant_builder_init(&builder, type);
-      for (const auto &item: value)
-        g_variant_builder_add_value(&builder, GioCodec<Value>::encode(item));
-      GVariant *result = g_variant_builder_end(&builder);
-      g_variant_type_free(type);
-      return result;
+      if constexpr (GioSerializable<std::list<Value>>)
+        {
+          return gio_serialize(value);
+        }
+      else
+        {
+          const std::string signature = GioSignature<std::list<Value>>::value();
+          GVariantType *type = g_variant_type_new(signature.c_str());
+          GVariantBuilder builder;
+          g_variant_builder_init(&builder, type);
+          for (const auto &item: value)
+            g_variant_builder_add_value(&builder, GioCodec<Value>::encode(item));
+          GVariant *result = g_variant_builder_end(&builder);
+          g_variant_type_free(type);
+          return result;
+        }
     }
   };
 
@@ -404,22 +421,54 @@ namespace workrave::rpc::dbus
 
     static GVariant *encode(const std::map<Key, Value> &value)
     {
-      const std::string signature = GioSignature<std::map<Key, Value>>::value();
-      GVariantType *type = g_variant_type_new(signature.c_str());
-      GVariantBuilder builder;
-      g_variant_builder_init(&builder, type);
-      for (const auto &[key, item]: value)
+      if constexpr (GioSerializable<std::map<Key, Value>>)
         {
-          g_variant_builder_add_value(
-            &builder,
-            g_variant_new_dict_entry(GioCodec<Key>::encode(key), GioCodec<Value>::encode(item)));
+          return gio_serialize(value);
         }
-      GVariant *result = g_variant_builder_end(&builder);
-      g_variant_type_free(type);
-      return result;
+      else
+        {
+          const std::string signature = GioSignature<std::map<Key, Value>>::value();
+          GVariantType *type = g_variant_type_new(signature.c_str());
+          GVariantBuilder builder;
+          g_variant_builder_init(&builder, type);
+          for (const auto &[key, item]: value)
+            {
+              g_variant_builder_add_value(
+                &builder,
+                g_variant_new_dict_entry(GioCodec<Key>::encode(key), GioCodec<Value>::encode(item)));
+            }
+          GVariant *result = g_variant_builder_end(&builder);
+          g_variant_type_free(type);
+          return result;
+        }
+    }
+  };
+
+  template<typename... Values>
+  struct GioSignature<std::tuple<Values...>>
+  {
+    static std::string value()
+    {
+      return "(" + (std::string() + ... + GioSignature<Values>::value()) + ")";
     }
   };
 
+  // Encodes a struct, or the arguments of a signal, as a tuple: directly
+  // serialized if every value allows it, otherwise one child at a time.
+  template<typename... Values>
+  GVariant *gio_encode_tuple(const Values &...values)
+  {
+    if constexpr ((GioSerializable<Values> && ...))
+      {
+        return gio_serialize_tuple(values...);
+      }
+    else
+      {
+        std::array<GVariant *, sizeof...(Values)> children{GioCodec<Values>::encode(values)...};
+        return g_variant_new_tuple(children.data(), children.size());
+      }
+  }
+
   template<typename T>
   T gio_decode_child(GVariant *tuple, gsize index)
   {
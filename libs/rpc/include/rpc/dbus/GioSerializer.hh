@@ -0,0 +1,416 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gio/gio.h>
+
+#include "rpc/dbus/Error.hh"
+
+// Writes values directly in GVariant's serialized format into a pooled
+// buffer and wraps the result with g_variant_new_from_data(). Building the
+// same value from g_variant_new_*() and GVariantBuilder allocates a GVariant
+// per element and then serializes the tree a second time.
+//
+// A type can be written this way if GioSerial<T> is defined for it: the
+// fixed-size D-Bus scalars, strings, structs whose fields all qualify
+// (described by a generated GioFields<T>), and arrays and maps of these.
+// GioCodec picks this path by itself for such types and falls back to the
+// builder for anything else (variants, object paths, file descriptors,
+// durations, flags).
+namespace workrave::rpc::dbus
+{
+  template<typename T>
+  struct GioSignature;
+
+  struct GioSerialBuffer
+  {
+    std::vector<unsigned char> data;
+    // Framing offsets of the containers that are being written.
+    std::vector<size_t> offsets;
+  };
+
+  // Keeps the buffers of serialized variants that GLib has released, so
+  // that encoding a message in steady state does not allocate.
+  class GioSerialBufferPool
+  {
+  public:
+    static GioSerialBufferPool &instance()
+    {
+      // Never destroyed: GLib may release a variant after static
+      // destructors have run.
+      static auto *pool = new GioSerialBufferPool();
+      return *pool;
+    }
+
+    std::unique_ptr<GioSerialBuffer> acquire()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!idle_.empty())
+          {
+            std::unique_ptr<GioSerialBuffer> buffer = std::move(idle_.back());
+            idle_.pop_back();
+            return buffer;
+          }
+      }
+      return std::make_unique<GioSerialBuffer>();
+    }
+
+    // Called from whichever thread drops the last reference to the variant.
+    void release(std::unique_ptr<GioSerialBuffer> buffer)
+    {
+      if (buffer->data.capacity() > MAX_BUFFER_SIZE)
+        {
+          return;
+        }
+      buffer->data.clear();
+      buffer->offsets.clear();
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (idle_.size() < MAX_IDLE_BUFFERS)
+        {
+          idle_.push_back(std::move(buffer));
+        }
+    }
+
+  private:
+    GioSerialBufferPool()
+    {
+      idle_.reserve(MAX_IDLE_BUFFERS);
+    }
+
+    static constexpr size_t MAX_IDLE_BUFFERS = 16;
+    static constexpr size_t MAX_BUFFER_SIZE = 64 * 1024;
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<GioSerialBuffer>> idle_;
+  };
+
+  // Size of the framing offsets of a container with `count` offsets after a
+  // body of `body_size` bytes: the smallest that can address the whole
+  // container.
+  constexpr size_t gio_offset_size(size_t body_size, size_t count)
+  {
+    if (body_size + count <= 0xff)
+      return 1;
+    if (body_size + 2 * count <= 0xffff)
+      return 2;
+    if (body_size + 4 * count <= 0xffffffff)
+      return 4;
+    return 8;
+  }
+
+  struct GioContainer
+  {
+    size_t start;
+    size_t first_offset;
+  };
+
+  class GioWriter
+  {
+  public:
+    explicit GioWriter(GioSerialBuffer &buffer) noexcept
+      : data_(buffer.data)
+      , offsets_(buffer.offsets)
+    {
+    }
+
+    [[nodiscard]] size_t position() const noexcept
+    {
+      return data_.size();
+    }
+
+    // Padding is always zero; GLib trusts the result to be in normal form.
+    void pad_to(size_t position)
+    {
+      if (position > data_.size())
+        data_.resize(position, 0);
+    }
+
+    void align(size_t alignment)
+    {
+      pad_to((data_.size() + alignment - 1) & ~(alignment - 1));
+    }
+
+    template<typename T>
+    void write_fixed(T value)
+    {
+      align(sizeof(T));
+      const size_t at = data_.size();
+      data_.resize(at + sizeof(T));
+      std::memcpy(data_.data() + at, &value, sizeof(T));
+    }
+
+    // Stops at the first NUL, like g_variant_new_string().
+    void write_string(const char *value)
+    {
+      const size_t length = std::strlen(value);
+      if (g_utf8_validate(value, static_cast<gssize>(length), nullptr) == FALSE)
+        {
+          throw Error(std::string(error_names::invalid_args), "DBus string is not valid UTF-8");
+        }
+      data_.insert(data_.end(), value, value + length + 1);
+    }
+
+    [[nodiscard]] GioContainer begin() const noexcept
+    {
+      return GioContainer{data_.size(), offsets_.size()};
+    }
+
+    // Records the end of a variable-sized member of `container`.
+    void mark_end(const GioContainer &container)
+    {
+      offsets_.push_back(data_.size() - container.start);
+    }
+
+    // Appends the recorded framing offsets: in reverse for a tuple, in
+    // order for an array.
+    void end(const GioContainer &container, bool reversed)
+    {
+      const size_t count = offsets_.size() - container.first_offset;
+      if (count == 0)
+        {
+          return;
+        }
+
+      const size_t width = gio_offset_size(data_.size() - container.start, count);
+      for (size_t i = 0; i < count; i++)
+        {
+          const size_t offset = offsets_[container.first_offset + (reversed ? count - 1 - i : i)];
+          for (size_t byte = 0; byte < width; byte++)
+            {
+              data_.push_back(static_cast<unsigned char>(offset >> (8 * byte)));
+            }
+        }
+      offsets_.resize(container.first_offset);
+    }
+
+  private:
+    std::vector<unsigned char> &data_;
+    std::vector<size_t> &offsets_;
+  };
+
+  // Specialized for every type that can be written directly; each
+  // specialization provides its alignment, its size if that is fixed (0
+  // otherwise), and write().
+  template<typename T>
+  struct GioSerial;
+
+  template<typename T>
+  concept GioSerializable = requires(GioWriter &writer, const T &value) {
+    GioSerial<T>::alignment;
+    GioSerial<T>::fixed_size;
+    GioSerial<T>::write(writer, value);
+  };
+
+  // Generated for each struct: tie() returns its fields in wire order.
+  template<typename T>
+  struct GioFields;
+
+  template<typename T>
+    requires std::is_same_v<T, bool> || std::is_same_v<T, uint8_t>
+             || (std::is_integral_v<T> && sizeof(T) >= 2 && sizeof(T) <= 8) || std::is_floating_point_v<T>
+  struct GioSerial<T>
+  {
+    // GVariant stores a boolean in one byte and any floating point value as
+    // a double.
+    using Wire = std::conditional_t<std::is_same_v<T, bool>,
+                                    uint8_t,
+                                    std::conditional_t<std::is_floating_point_v<T>, double, T>>;
+
+    static constexpr size_t alignment = sizeof(Wire);
+    static constexpr size_t fixed_size = sizeof(Wire);
+
+    static void write(GioWriter &writer, T value)
+    {
+      writer.write_fixed(static_cast<Wire>(value));
+    }
+  };
+
+  template<>
+  struct GioSerial<std::string>
+  {
+    static constexpr size_t alignment = 1;
+    static constexpr size_t fixed_size = 0;
+
+    static void write(GioWriter &writer, const std::string &value)
+    {
+      writer.write_string(value.c_str());
+    }
+  };
+
+  template<typename... Fields>
+  struct GioTupleSerial
+  {
+    static constexpr size_t alignment = std::max({size_t{1}, GioSerial<Fields>::alignment...});
+
+    static constexpr size_t fixed_size = [] {
+      if ((... || (GioSerial<Fields>::fixed_size == 0)))
+        {
+          return size_t{0};
+        }
+      size_t size = 0;
+      ((size = ((size + GioSerial<Fields>::alignment - 1) & ~(GioSerial<Fields>::alignment - 1))
+               + GioSerial<Fields>::fixed_size),
+       ...);
+      size = (size + alignment - 1) & ~(alignment - 1);
+      // The unit tuple still takes one byte.
+      return std::max(size, size_t{1});
+    }();
+
+    static void write(GioWriter &writer, const Fields &...fields)
+    {
+      const GioContainer tuple = writer.begin();
+      size_t index = 0;
+      (write_member<Fields>(writer, tuple, fields, ++index == sizeof...(Fields)), ...);
+      if constexpr (fixed_size != 0)
+        {
+          writer.pad_to(tuple.start + fixed_size);
+        }
+      else
+        {
+          writer.end(tuple, true);
+        }
+    }
+
+  private:
+    template<typename Field>
+    static void write_member(GioWriter &writer, const GioContainer &tuple, const Field &value, bool last)
+    {
+      writer.align(GioSerial<Field>::alignment);
+      GioSerial<Field>::write(writer, value);
+      // Only the end of the last member follows from the container size.
+      if (GioSerial<Field>::fixed_size == 0 && !last)
+        {
+          writer.mark_end(tuple);
+        }
+    }
+  };
+
+  template<typename Tuple>
+  struct GioFieldsSerial;
+
+  template<typename... Fields>
+  struct GioFieldsSerial<std::tuple<Fields...>>
+  {
+    static constexpr bool serializable = (GioSerializable<std::remove_cvref_t<Fields>> && ...);
+    using Tuple = GioTupleSerial<std::remove_cvref_t<Fields>...>;
+  };
+
+  template<typename T>
+  using GioFieldsTuple = decltype(GioFields<T>::tie(std::declval<const T &>()));
+
+  template<typename T>
+    requires requires { typename GioFieldsTuple<T>; } && GioFieldsSerial<GioFieldsTuple<T>>::serializable
+  struct GioSerial<T> : GioFieldsSerial<GioFieldsTuple<T>>::Tuple
+  {
+    static void write(GioWriter &writer, const T &value)
+    {
+      std::apply([&writer](const auto &...fields) { GioFieldsSerial<GioFieldsTuple<T>>::Tuple::write(writer, fields...); },
+                 GioFields<T>::tie(value));
+    }
+  };
+
+  template<typename Sequence, typename Value>
+  struct GioArraySerial
+  {
+    static constexpr size_t alignment = GioSerial<Value>::alignment;
+    static constexpr size_t fixed_size = 0;
+
+    static void write(GioWriter &writer, const Sequence &values)
+    {
+      const GioContainer array = writer.begin();
+      for (const auto &value: values)
+        {
+          writer.align(alignment);
+          GioSerial<Value>::write(writer, value);
+          if constexpr (GioSerial<Value>::fixed_size == 0)
+            {
+              writer.mark_end(array);
+            }
+        }
+      writer.end(array, false);
+    }
+  };
+
+  template<GioSerializable Value>
+  struct GioSerial<std::vector<Value>> : GioArraySerial<std::vector<Value>, Value>
+  {
+  };
+
+  template<GioSerializable Value>
+  struct GioSerial<std::list<Value>> : GioArraySerial<std::list<Value>, Value>
+  {
+  };
+
+  // A dictionary entry is laid out as a tuple of two.
+  template<GioSerializable Key, GioSerializable Value>
+  struct GioSerial<std::pair<const Key, Value>> : GioTupleSerial<Key, Value>
+  {
+    static void write(GioWriter &writer, const std::pair<const Key, Value> &entry)
+    {
+      GioTupleSerial<Key, Value>::write(writer, entry.first, entry.second);
+    }
+  };
+
+  template<GioSerializable Key, GioSerializable Value>
+  struct GioSerial<std::map<Key, Value>> : GioArraySerial<std::map<Key, Value>, std::pair<const Key, Value>>
+  {
+  };
+
+  template<typename T>
+  const GVariantType *gio_variant_type()
+  {
+    // Built once per type and kept for the lifetime of the process.
+    static const GVariantType *const type = g_variant_type_new(GioSignature<T>::value().c_str());
+    return type;
+  }
+
+  template<typename Write>
+  GVariant *gio_serialize_as(const GVariantType *type, Write &&write)
+  {
+    std::unique_ptr<GioSerialBuffer> buffer = GioSerialBufferPool::instance().acquire();
+    GioWriter writer(*buffer);
+    write(writer);
+
+    GioSerialBuffer *serialized = buffer.release();
+    return g_variant_new_from_data(
+      type,
+      serialized->data.data(),
+      serialized->data.size(),
+      TRUE,
+      [](gpointer data) {
+        GioSerialBufferPool::instance().release(std::unique_ptr<GioSerialBuffer>(static_cast<GioSerialBuffer *>(data)));
+      },
+      serialized);
+  }
+
+  template<GioSerializable T>
+  GVariant *gio_serialize(const T &value)
+  {
+    return gio_serialize_as(gio_variant_type<T>(), [&value](GioWriter &writer) { GioSerial<T>::write(writer, value); });
+  }
+
+  template<GioSerializable... Values>
+  GVariant *gio_serialize_tuple(const Values &...values)
+  {
+    return gio_serialize_as(gio_variant_type<std::tuple<Values...>>(), [&](GioWriter &writer) {
+      GioTupleSerial<Values...>::write(writer, values...);
+    });
+  }
+}
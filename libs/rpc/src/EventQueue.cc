@@ -0,0 +1,84 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+
+#include "rpc/EventQueue.hh"
+
+#include <map>
+
+namespace rpc
+{
+  namespace
+  {
+    struct StatsRegistry
+    {
+      std::mutex mutex;
+      uint64_t next_id{1};
+      std::map<uint64_t, std::pair<std::string, EventQueueStatsSource>> sources;
+      std::map<std::string, EventQueueStats, std::less<>> retired;
+    };
+
+    auto registry() -> StatsRegistry &
+    {
+      // Never destroyed: static broadcasters may unregister during exit.
+      static auto *instance = new StatsRegistry;
+      return *instance;
+    }
+  } // namespace
+
+  uint64_t register_event_queue_stats(std::string_view stream, EventQueueStatsSource source)
+  {
+    auto &stats = registry();
+    std::scoped_lock lock(stats.mutex);
+    const uint64_t id = stats.next_id++;
+    stats.sources.emplace(id, std::make_pair(std::string(stream), std::move(source)));
+    return id;
+  }
+
+  void unregister_event_queue_stats(uint64_t id)
+  {
+    auto &stats = registry();
+    std::scoped_lock lock(stats.mutex);
+    const auto it = stats.sources.find(id);
+    if (it == stats.sources.end())
+      {
+        return;
+      }
+    const auto &[stream, source] = it->second;
+    stats.retired[stream].add(source());
+    stats.sources.erase(it);
+  }
+
+  std::vector<StreamQueueStats> event_queue_stats()
+  {
+    auto &stats = registry();
+    std::scoped_lock lock(stats.mutex);
+    std::map<std::string, EventQueueStats, std::less<>> totals = stats.retired;
+    for (const auto &[id, entry]: stats.sources)
+      {
+        totals[entry.first].add(entry.second());
+      }
+
+    std::vector<StreamQueueStats> result;
+    result.reserve(totals.size());
+    for (auto &[stream, total]: totals)
+      {
+        result.push_back({stream, total});
+      }
+    return result;
+  }
+} // namespace rpc
@@ -0,0 +1,106 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include "rpc/Executor.hh"
+
+
+namespace rpc
+{
+  namespace
+  {
+    class InlineExecutor : public Executor
+    {
+    protected:
+      [[nodiscard]] bool runs_on_current_thread() const override
+      {
+        return true;
+      }
+
+      void post(std::function<void()> task) override
+      {
+        task();
+      }
+    };
+  } // namespace
+
+  Executor &Executor::inline_executor()
+  {
+    static InlineExecutor executor;
+    return executor;
+  }
+
+  LoopExecutor::LoopExecutor(std::function<void()> wakeup)
+    : wakeup_(std::move(wakeup))
+  {
+  }
+
+  LoopExecutor::~LoopExecutor()
+  {
+    close();
+  }
+
+  void LoopExecutor::drain()
+  {
+    std::vector<std::function<void()>> batch;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      batch.swap(pending_);
+      wakeup_requested_ = false;
+    }
+
+    // Calls queued while this batch runs wait for the next wakeup, which
+    // bounds how long one drain() can hold up the loop.
+    for (auto &task: batch)
+      {
+        task();
+      }
+  }
+
+  void LoopExecutor::close()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    drain();
+  }
+
+  bool LoopExecutor::runs_on_current_thread() const
+  {
+    return std::this_thread::get_id() == owner_;
+  }
+
+  void LoopExecutor::post(std::function<void()> task)
+  {
+    bool wakeup = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_)
+        {
+          throw ExecutorClosed();
+        }
+      pending_.push_back(std::move(task));
+      wakeup = !wakeup_requested_;
+      wakeup_requested_ = true;
+    }
+
+    if (wakeup)
+      {
+        wakeup_();
+      }
+  }
+} // namespace rpc
@@ -0,0 +1,164 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include "rpc/LatencyHistogram.hh"
+
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace rpc
+{
+  std::size_t LatencyHistogram::bucket_index(uint64_t usec) noexcept
+  {
+    constexpr uint64_t sub_buckets = uint64_t{1} << sub_bucket_bits;
+    if (usec < sub_buckets)
+      {
+        return usec;
+      }
+
+    const int exponent = std::bit_width(usec) - 1;
+    if (exponent >= max_exponent)
+      {
+        return bucket_count - 1;
+      }
+    const int shift = exponent - sub_bucket_bits;
+    return (static_cast<std::size_t>(shift + 1) << sub_bucket_bits) + ((usec >> shift) & (sub_buckets - 1));
+  }
+
+  uint64_t LatencyHistogram::bucket_upper_bound(std::size_t index) noexcept
+  {
+    constexpr uint64_t sub_buckets = uint64_t{1} << sub_bucket_bits;
+    if (index < sub_buckets)
+      {
+        return index;
+      }
+
+    const int shift = static_cast<int>(index >> sub_bucket_bits) - 1;
+    const uint64_t lower = (sub_buckets + (index & (sub_buckets - 1))) << shift;
+    return lower + (uint64_t{1} << shift) - 1;
+  }
+
+  void LatencyHistogram::record(std::chrono::microseconds latency, bool ok) noexcept
+  {
+    const auto usec = static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+
+    buckets_[bucket_index(usec)].fetch_add(1, std::memory_order_relaxed);
+    calls_.fetch_add(1, std::memory_order_relaxed);
+    total_usec_.fetch_add(usec, std::memory_order_relaxed);
+    if (!ok)
+      {
+        failed_.fetch_add(1, std::memory_order_relaxed);
+      }
+
+    uint64_t max = max_usec_.load(std::memory_order_relaxed);
+    while (usec > max && !max_usec_.compare_exchange_weak(max, usec, std::memory_order_relaxed))
+      {
+      }
+  }
+
+  LatencyHistogram::Summary LatencyHistogram::summarize() const
+  {
+    // Calls recorded while copying may be in some counters and not yet in
+    // others; the summary is derived from the buckets alone so that the
+    // percentiles always add up.
+    std::array<uint64_t, bucket_count> counts{};
+    uint64_t calls = 0;
+    for (std::size_t i = 0; i < bucket_count; i++)
+      {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        calls += counts[i];
+      }
+
+    Summary summary;
+    summary.calls = calls;
+    if (calls == 0)
+      {
+        return summary;
+      }
+
+    const uint64_t max = max_usec_.load(std::memory_order_relaxed);
+    summary.failed = std::min(failed_.load(std::memory_order_relaxed), calls);
+    summary.mean = std::chrono::microseconds(total_usec_.load(std::memory_order_relaxed) / calls);
+    summary.max = std::chrono::microseconds(max);
+
+    const auto percentile = [&](uint64_t percent) {
+      const uint64_t rank = std::max<uint64_t>((calls * percent + 99) / 100, 1);
+      uint64_t seen = 0;
+      for (std::size_t i = 0; i < bucket_count; i++)
+        {
+          seen += counts[i];
+          if (seen >= rank)
+            {
+              return std::chrono::microseconds(std::min(bucket_upper_bound(i), max));
+            }
+        }
+      return summary.max;
+    };
+    summary.p50 = percentile(50);
+    summary.p90 = percentile(90);
+    summary.p99 = percentile(99);
+    return summary;
+  }
+
+  namespace
+  {
+    struct HistogramRegistry
+    {
+      std::mutex mutex;
+      std::map<std::pair<std::string, std::string>, std::unique_ptr<LatencyHistogram>, std::less<>> histograms;
+    };
+
+    auto registry() -> HistogramRegistry &
+    {
+      // Never destroyed: generated services hold references until exit.
+      static auto *instance = new HistogramRegistry;
+      return *instance;
+    }
+  } // namespace
+
+  LatencyHistogram &method_latency_histogram(std::string_view service, std::string_view method)
+  {
+    auto &histograms = registry();
+    std::scoped_lock lock(histograms.mutex);
+    auto &histogram = histograms.histograms[{std::string(service), std::string(method)}];
+    if (!histogram)
+      {
+        histogram = std::make_unique<LatencyHistogram>();
+      }
+    return *histogram;
+  }
+
+  std::vector<MethodLatency> method_latencies()
+  {
+    auto &histograms = registry();
+    std::vector<MethodLatency> result;
+    std::scoped_lock lock(histograms.mutex);
+    for (const auto &[key, histogram]: histograms.histograms)
+      {
+        LatencyHistogram::Summary summary = histogram->summarize();
+        if (summary.calls > 0)
+          {
+            result.push_back({key.first, key.second, summary});
+          }
+      }
+    return result;
+  }
+} // namespace rpc
@@ -9,6 +9,10 @@
 #include <utility>
 #include <vector>
 
+#include <google/protobuf/message.h>
+
+#include "rpc/LatencyHistogram.hh"
+
 namespace rpc
 {
   namespace detail
@@ -108,8 +112,21 @@ namespace rpc
     return RequestInterceptorRegistration{std::move(entry)};
   }
 
-  void intercept_request(const RequestInfo &request) noexcept
+  std::size_t RequestInfo::request_size() const
+  {
+    return request.ByteSizeLong();
+  }
+
+  std::size_t RequestInfo::response_size() const
   {
+    return response.ByteSizeLong();
+  }
+
+  void intercept_request(LatencyHistogram &latency, RequestInfo request) noexcept
+  {
+    request.end = std::chrono::steady_clock::now();
+    latency.record(request.latency(), request.status.ok());
+
     std::vector<std::shared_ptr<detail::RequestInterceptorEntry>> entries;
     auto &interceptors = registry();
     {
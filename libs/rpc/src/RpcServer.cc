@@ -17,6 +17,7 @@
 
 #include "rpc/RpcServer.hh"
 
+#include <chrono>
 #include <filesystem>
 #include <string_view>
 #include <system_error>
@@ -48,6 +49,7 @@ namespace rpc
   namespace
   {
     constexpr std::string_view unix_prefix = "unix:";
+    constexpr std::chrono::milliseconds shutdown_grace_period{500};
   }
 
   // A unix domain socket left behind by a previous, uncleanly-terminated
@@ -83,10 +85,12 @@ namespace rpc
         grpc::reflection::InitProtoReflectionServerBuilderPlugin();
       }
 
-    remove_stale_unix_socket();
-
     grpc::ServerBuilder builder;
-    builder.AddListeningPort(config_.listen_address, config_.credentials, &bound_port_);
+    if (!config_.listen_address.empty())
+      {
+        remove_stale_unix_socket();
+        builder.AddListeningPort(config_.listen_address, config_.credentials, &bound_port_);
+      }
     for (grpc::Service *service: pending_services_)
       {
         builder.RegisterService(service);
@@ -95,15 +99,28 @@ namespace rpc
     server_ = builder.BuildAndStart();
     if (!server_)
       {
-        throw RpcException("failed to start gRPC server on " + config_.listen_address);
+        throw RpcException(config_.listen_address.empty() ? "failed to start in-process gRPC server"
+                                                          : "failed to start gRPC server on " + config_.listen_address);
+      }
+  }
+
+  std::shared_ptr<grpc::Channel> RpcServer::in_process_channel() const
+  {
+    if (!server_)
+      {
+        throw RpcException("gRPC server is not running");
       }
+    return server_->InProcessChannel(grpc::ChannelArguments());
   }
 
   void RpcServer::shutdown()
   {
     if (server_)
       {
-        server_->Shutdown();
+        // Event streams stay open until the client goes away, so give
+        // in-flight calls a short grace period and then cancel the rest;
+        // their reactors finish from OnCancel().
+        server_->Shutdown(std::chrono::system_clock::now() + shutdown_grace_period);
         server_->Wait();
         server_.reset();
       }
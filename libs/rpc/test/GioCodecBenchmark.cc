@@ -0,0 +1,190 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Times the encoding of the applet's TimersUpdated and MenuUpdated signals,
+// serialized directly into a pooled buffer and built from one GVariant per
+// value as before. Not part of the test suite; run by hand:
+//
+//   workrave-libs-rpc-gio-codec-benchmark [messages]
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include "rpc/dbus/GioCodec.hh"
+
+namespace
+{
+  struct TimerData
+  {
+    std::string bar_text;
+    int slot;
+    uint32_t bar_secondary_color;
+    uint32_t bar_secondary_val;
+    uint32_t bar_secondary_max;
+    uint32_t bar_primary_color;
+    uint32_t bar_primary_val;
+    uint32_t bar_primary_max;
+  };
+
+  struct MenuItem
+  {
+    std::string text;
+    std::string dynamic_text;
+    std::string action;
+    uint32_t command;
+    uint8_t type;
+    uint8_t flags;
+  };
+} // namespace
+
+namespace workrave::rpc::dbus
+{
+  template<>
+  struct GioSignature<TimerData>
+  {
+    static std::string value()
+    {
+      return "(siuuuuuu)";
+    }
+  };
+
+  template<>
+  struct GioFields<TimerData>
+  {
+    static auto tie(const TimerData &value)
+    {
+      return std::tie(value.bar_text,
+                      value.slot,
+                      value.bar_secondary_color,
+                      value.bar_secondary_val,
+                      value.bar_secondary_max,
+                      value.bar_primary_color,
+                      value.bar_primary_val,
+                      value.bar_primary_max);
+    }
+  };
+
+  template<>
+  struct GioSignature<MenuItem>
+  {
+    static std::string value()
+    {
+      return "(sssuyy)";
+    }
+  };
+
+  template<>
+  struct GioFields<MenuItem>
+  {
+    static auto tie(const MenuItem &value)
+    {
+      return std::tie(value.text, value.dynamic_text, value.action, value.command, value.type, value.flags);
+    }
+  };
+} // namespace workrave::rpc::dbus
+
+namespace
+{
+  using namespace workrave::rpc::dbus;
+
+  // The generated code before direct serialization: a GVariant per field.
+  template<typename T>
+  GVariant *encode_with_builder(const T &value)
+  {
+    return std::apply(
+      [](const auto &...fields) {
+        std::array<GVariant *, sizeof...(fields)> children{GioCodec<std::remove_cvref_t<decltype(fields)>>::encode(fields)...};
+        return g_variant_new_tuple(children.data(), children.size());
+      },
+      GioFields<T>::tie(value));
+  }
+
+  GVariant *encode_with_builder(const std::list<MenuItem> &items)
+  {
+    GVariantBuilder builder;
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a(sssuyy)"));
+    for (const auto &item: items)
+      {
+        g_variant_builder_add_value(&builder, encode_with_builder(item));
+      }
+    return g_variant_builder_end(&builder);
+  }
+
+  // Optionally also converts the result into a D-Bus message, which is what
+  // GDBus does with it next.
+  template<typename Encode>
+  void measure(const std::string &name, int messages, Encode &&encode)
+  {
+    for (bool to_blob: {false, true})
+      {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < messages; i++)
+          {
+            GVariant *body = g_variant_ref_sink(encode(i));
+            if (to_blob)
+              {
+                GDBusMessage *message = g_dbus_message_new_signal("/org/workrave/Workrave/UI",
+                                                                  "org.workrave.AppletInterface",
+                                                                  "TimersUpdated");
+                g_dbus_message_set_body(message, body);
+                gsize size = 0;
+                guchar *blob = g_dbus_message_to_blob(message, &size, G_DBUS_CAPABILITY_FLAGS_NONE, nullptr);
+                g_free(blob);
+                g_object_unref(message);
+              }
+            g_variant_unref(body);
+          }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << name << (to_blob ? ", encoded into a D-Bus message: " : ": ")
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / messages << " ns/message"
+                  << std::endl;
+      }
+  }
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  const int messages = argc > 1 ? std::atoi(argv[1]) : 200000;
+  if (messages <= 0)
+    {
+      std::cerr << "usage: " << argv[0] << " [messages]" << std::endl;
+      return 1;
+    }
+
+  const auto timer = [](int i, int slot) {
+    return TimerData{std::to_string(i % 60) + ":" + std::to_string(i % 10) + "0", slot, 1, 10, 300, 2, static_cast<uint32_t>(i % 300), 300};
+  };
+
+  std::list<MenuItem> menu;
+  for (uint32_t i = 0; i < 16; i++)
+    {
+      menu.push_back(MenuItem{"Menu item " + std::to_string(i), "", "workrave.action." + std::to_string(i), i, 1, 0});
+    }
+
+  measure("TimersUpdated, builder", messages, [&](int i) {
+    const std::array<GVariant *, 3> values{encode_with_builder(timer(i, 0)),
+                                           encode_with_builder(timer(i, 1)),
+                                           encode_with_builder(timer(i, 2))};
+    return g_variant_new_tuple(values.data(), values.size());
+  });
+  measure("TimersUpdated, serialized", messages, [&](int i) {
+    return gio_encode_tuple(timer(i, 0), timer(i, 1), timer(i, 2));
+  });
+
+  measure("MenuUpdated (16 items), builder", messages, [&](int) {
+    GVariant *value = encode_with_builder(menu);
+    return g_variant_new_tuple(&value, 1);
+  });
+  measure("MenuUpdated (16 items), serialized", messages, [&](int) { return gio_encode_tuple(menu); });
+
+  return 0;
+}
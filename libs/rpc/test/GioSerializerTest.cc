@@ -0,0 +1,213 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "rpc/dbus/GioCodec.hh"
+
+namespace
+{
+  // The shapes of the applet's TimerData and MenuItem.
+  struct TimerData
+  {
+    std::string bar_text;
+    int slot;
+    uint32_t primary_val;
+    uint32_t primary_max;
+  };
+
+  struct MenuItem
+  {
+    std::string text;
+    uint32_t command;
+    uint8_t flags;
+  };
+
+  struct Sample
+  {
+    int32_t count;
+    bool enabled;
+    double ratio;
+  };
+
+  struct Located
+  {
+    workrave::rpc::dbus::ObjectPath path;
+    int32_t value;
+  };
+} // namespace
+
+// What the generator emits for a struct.
+namespace workrave::rpc::dbus
+{
+  template<>
+  struct GioSignature<TimerData>
+  {
+    static std::string value()
+    {
+      return "(siuu)";
+    }
+  };
+
+  template<>
+  struct GioFields<TimerData>
+  {
+    static auto tie(const TimerData &value)
+    {
+      return std::tie(value.bar_text, value.slot, value.primary_val, value.primary_max);
+    }
+  };
+
+  template<>
+  struct GioSignature<MenuItem>
+  {
+    static std::string value()
+    {
+      return "(suy)";
+    }
+  };
+
+  template<>
+  struct GioFields<MenuItem>
+  {
+    static auto tie(const MenuItem &value)
+    {
+      return std::tie(value.text, value.command, value.flags);
+    }
+  };
+
+  template<>
+  struct GioSignature<Sample>
+  {
+    static std::string value()
+    {
+      return "(ibd)";
+    }
+  };
+
+  template<>
+  struct GioFields<Sample>
+  {
+    static auto tie(const Sample &value)
+    {
+      return std::tie(value.count, value.enabled, value.ratio);
+    }
+  };
+
+  template<>
+  struct GioFields<Located>
+  {
+    static auto tie(const Located &value)
+    {
+      return std::tie(value.path, value.value);
+    }
+  };
+} // namespace workrave::rpc::dbus
+
+namespace
+{
+  using workrave::rpc::dbus::gio_encode_tuple;
+  using workrave::rpc::dbus::gio_serialize;
+  using workrave::rpc::dbus::GioSerializable;
+  using workrave::rpc::dbus::GioVariant;
+
+  GioVariant sink(GVariant *value)
+  {
+    return GioVariant(g_variant_ref_sink(value));
+  }
+
+  // Same type, same bytes: GLib builds the reference in normal form.
+  void expect_same_serialization(GVariant *actual, GVariant *expected)
+  {
+    ASSERT_STREQ(g_variant_get_type_string(actual), g_variant_get_type_string(expected));
+    ASSERT_EQ(g_variant_get_size(actual), g_variant_get_size(expected));
+    EXPECT_EQ(std::memcmp(g_variant_get_data(actual), g_variant_get_data(expected), g_variant_get_size(expected)), 0);
+    EXPECT_TRUE(g_variant_equal(actual, expected));
+  }
+
+  TEST(GioSerializerTest, structMatchesBuilderLayout)
+  {
+    static_assert(GioSerializable<TimerData>);
+    GioVariant actual = sink(gio_serialize(TimerData{"12:34", 2, 300, 1200}));
+    GioVariant expected = sink(g_variant_new_parsed("('12:34', 2, @u 300, @u 1200)"));
+    expect_same_serialization(actual.get(), expected.get());
+  }
+
+  TEST(GioSerializerTest, fixedSizeStructsArePadded)
+  {
+    std::vector<Sample> samples{{1, true, 0.5}, {-7, false, 2.0}};
+    GioVariant actual = sink(gio_serialize(samples));
+    GioVariant expected = sink(g_variant_new_parsed("[(1, true, 0.5), (-7, false, 2.0)]"));
+    expect_same_serialization(actual.get(), expected.get());
+    EXPECT_EQ(g_variant_get_size(actual.get()), 2 * 16U);
+  }
+
+  TEST(GioSerializerTest, signalArgumentsMatchBuilderLayout)
+  {
+    const TimerData micro{"0:30", 0, 10, 30};
+    const TimerData rest{"", 1, 0, 600};
+    GioVariant actual = sink(gio_encode_tuple(micro, rest, true));
+    GioVariant expected = sink(g_variant_new_parsed("(('0:30', 0, @u 10, @u 30), ('', 1, @u 0, @u 600), true)"));
+    expect_same_serialization(actual.get(), expected.get());
+  }
+
+  TEST(GioSerializerTest, largeArraysUseWiderFramingOffsets)
+  {
+    std::list<MenuItem> items;
+    GVariantBuilder builder;
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a(suy)"));
+    for (uint32_t i = 0; i < 300; i++)
+      {
+        const std::string text = "Item " + std::to_string(i);
+        items.push_back(MenuItem{text, i, static_cast<uint8_t>(i)});
+        g_variant_builder_add(&builder, "(suy)", text.c_str(), i, static_cast<guchar>(i));
+      }
+
+    GioVariant actual = sink(gio_serialize(items));
+    GioVariant expected = sink(g_variant_builder_end(&builder));
+    ASSERT_GT(g_variant_get_size(expected.get()), 0xffU);
+    expect_same_serialization(actual.get(), expected.get());
+  }
+
+  TEST(GioSerializerTest, mapsEncodeAsDictionaries)
+  {
+    std::map<std::string, int64_t> totals{{"micro", 12}, {"rest", -3}};
+    GioVariant actual = sink(gio_serialize(totals));
+    GioVariant expected = sink(g_variant_new_parsed("{'micro': @x 12, 'rest': -3}"));
+    expect_same_serialization(actual.get(), expected.get());
+  }
+
+  TEST(GioSerializerTest, invalidUtf8IsRejected)
+  {
+    EXPECT_THROW(gio_serialize(std::string("\xff\xfe")), workrave::rpc::dbus::Error);
+  }
+
+  TEST(GioSerializerTest, unsupportedFieldsFallBackToBuilder)
+  {
+    static_assert(!GioSerializable<Located>);
+    static_assert(!GioSerializable<std::vector<Located>>);
+    GioVariant actual = sink(gio_encode_tuple(workrave::rpc::dbus::ObjectPath{"/org/workrave"}, int32_t{4}));
+    GioVariant expected = sink(g_variant_new_parsed("(objectpath '/org/workrave', 4)"));
+    expect_same_serialization(actual.get(), expected.get());
+  }
+
+  TEST(GioSerializerTest, releasedBuffersAreReused)
+  {
+    const TimerData timer{"5:00", 1, 2, 3};
+    const void *first = nullptr;
+    {
+      GioVariant value = sink(gio_serialize(timer));
+      first = g_variant_get_data(value.get());
+    }
+    GioVariant value = sink(gio_serialize(timer));
+    EXPECT_EQ(g_variant_get_data(value.get()), first);
+  }
+} // namespace
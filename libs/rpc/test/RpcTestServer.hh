@@ -78,10 +78,47 @@ public:
     signal_mode_changed_(mode);
   }
 
+  [[nodiscard]] int32_t get_level() const
+  {
+    return level_;
+  }
+
+  // A state signal, like Core::signal_timer_snapshot_changed(): a new
+  // subscriber first receives get_level(), then only the newest level at
+  // the rate it asked for.
+  // @rpc.signal(name="LevelChanged", latest="get_level")
+  boost::signals2::signal<void(int32_t)> &signal_level_changed()
+  {
+    return signal_level_changed_;
+  }
+
+  void set_level_for_test(int32_t level)
+  {
+    level_ = level;
+    signal_level_changed_(level);
+  }
+
+  // Per-item state: a client that falls behind gets the newest value of
+  // each item rather than every intermediate one.
+  // @rpc.signal(name="ItemChanged", fields="name,value")
+  // @rpc.queue(policy="coalesce", capacity=4, key="name")
+  boost::signals2::signal<void(std::string, int32_t)> &signal_item_changed()
+  {
+    return signal_item_changed_;
+  }
+
+  void fire_item_changed_for_test(const std::string &name, int32_t value)
+  {
+    signal_item_changed_(name, value);
+  }
+
 private:
   bool flag_{false};
   TestMode mode_{TestMode::Idle};
+  int32_t level_{0};
   boost::signals2::signal<void(TestMode)> signal_mode_changed_;
+  boost::signals2::signal<void(int32_t)> signal_level_changed_;
+  boost::signals2::signal<void(std::string, int32_t)> signal_item_changed_;
 };
 
 #endif // WORKRAVE_RPC_TEST_RPCTESTSERVER_HH
@@ -21,16 +21,26 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <future>
+#include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <grpcpp/grpcpp.h>
 
+#include "rpc/EventBroadcaster.hh"
+#include "rpc/EventQueue.hh"
+#include "rpc/Executor.hh"
 #include "rpc/InstanceRegistry.hh"
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
+#include "rpc/RpcException.hh"
 #include "rpc/RpcServer.hh"
 
 #include "RpcKeyed.grpc.pb.h"
@@ -42,7 +52,7 @@
 
 namespace
 {
-  // Client and server coexist in one process against a loopback address —
+  // Client and server coexist in one process over an in-process channel —
   // unlike DBus, gRPC needs no system bus daemon to talk to itself.
   class RpcTest : public ::testing::Test
   {
@@ -50,14 +60,11 @@ namespace
     RpcTest()
       : impl(server_object)
     {
-      rpc::ServerConfig config;
-      config.listen_address = "127.0.0.1:0";
-      rpc_server = std::make_unique<rpc::RpcServer>(config);
+      rpc_server = std::make_unique<rpc::RpcServer>(rpc::ServerConfig{});
       rpc_server->register_service(impl);
       rpc_server->start();
 
-      auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(rpc_server->bound_port()),
-                                         grpc::InsecureChannelCredentials());
+      auto channel = rpc_server->in_process_channel();
       stub = workrave::TestService::NewStub(channel);
     }
 
@@ -131,21 +138,56 @@ TEST_F(RpcTest, interceptor_failure_does_not_change_the_rpc_result)
   EXPECT_EQ(response.result(), "still succeeds pong");
 }
 
-TEST_F(RpcTest, shutdown_rejects_subsequent_calls)
+TEST_F(RpcTest, interceptor_sees_status_sizes_and_timing)
 {
-  grpc::ClientContext first_context;
+  grpc::Status observed_status(grpc::StatusCode::UNKNOWN, "not called");
+  std::size_t request_size = 0;
+  std::size_t response_size = 0;
+  bool ordered = false;
+  auto registration = rpc::register_request_interceptor([&](const rpc::RequestInfo &info) {
+    observed_status = info.status;
+    request_size = info.request_size();
+    response_size = info.response_size();
+    ordered = info.start <= info.end && info.latency().count() >= 0;
+  });
+
+  grpc::ClientContext context;
   workrave::PingRequest request;
-  request.set_message("before shutdown");
-  workrave::PingResponse first_response;
+  request.set_message("sized");
+  workrave::PingResponse response;
 
-  ASSERT_TRUE(stub->Ping(&first_context, request, &first_response).ok());
+  ASSERT_TRUE(stub->Ping(&context, request, &response).ok());
+  EXPECT_TRUE(observed_status.ok());
+  EXPECT_EQ(request_size, request.ByteSizeLong());
+  EXPECT_EQ(response_size, response.ByteSizeLong());
+  EXPECT_TRUE(ordered);
+}
 
-  rpc_server->shutdown();
+TEST_F(RpcTest, generated_calls_are_counted_per_method)
+{
+  const auto calls = [] {
+    for (const auto &entry: rpc::method_latencies())
+      {
+        if (entry.service == "workrave.TestService" && entry.method == "Add")
+          {
+            return entry.summary.calls;
+          }
+      }
+    return uint64_t{0};
+  };
+  const uint64_t before = calls();
 
-  grpc::ClientContext second_context;
-  second_context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(1));
-  workrave::PingResponse second_response;
-  EXPECT_FALSE(stub->Ping(&second_context, request, &second_response).ok());
+  for (int i = 0; i < 3; i++)
+    {
+      grpc::ClientContext context;
+      workrave::AddRequest request;
+      request.set_a(i);
+      request.set_b(1);
+      workrave::AddResponse response;
+      ASSERT_TRUE(stub->Add(&context, request, &response).ok());
+    }
+
+  EXPECT_EQ(calls(), before + 3);
 }
 
 TEST_F(RpcTest, add_calls_real_method)
@@ -206,7 +248,7 @@ TEST_F(RpcTest, greet_const_ref_param)
 
 TEST_F(RpcTest, mode_changed_signal_streams_real_events)
 {
-  // The gRPC analog of a DBus signal — see rpc::EventQueue and
+  // The gRPC analog of a DBus signal — see rpc::EventBroadcaster and
   // libs/corenext/src/Core.hh's @rpc.signal-annotated
   // signal_operation_mode_changed() for the real-world use this proves out.
   grpc::ClientContext ctx;
@@ -232,6 +274,635 @@ TEST_F(RpcTest, mode_changed_signal_streams_real_events)
   (void)reader->Finish();
 }
 
+TEST_F(RpcTest, mode_changed_signal_fans_out_to_every_subscriber)
+{
+  constexpr int subscriber_count = 8;
+  std::vector<std::unique_ptr<grpc::ClientContext>> contexts;
+  std::vector<std::unique_ptr<grpc::ClientReaderInterface<workrave::ModeChangedEvent>>> readers;
+  for (int i = 0; i < subscriber_count; i++)
+    {
+      contexts.push_back(std::make_unique<grpc::ClientContext>());
+      readers.push_back(stub->ModeChanged(contexts.back().get(), workrave::ModeChangedRequest()));
+    }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // One connection to the signal serves all streams.
+  EXPECT_EQ(server_object.signal_mode_changed().num_slots(), 1U);
+
+  server_object.fire_mode_changed_for_test(TestMode::Active);
+  server_object.fire_mode_changed_for_test(TestMode::Idle);
+
+  for (auto &reader: readers)
+    {
+      workrave::ModeChangedEvent event;
+      ASSERT_TRUE(reader->Read(&event));
+      EXPECT_EQ(event.value(), workrave::TestMode::TEST_MODE_ACTIVE);
+      ASSERT_TRUE(reader->Read(&event));
+      EXPECT_EQ(event.value(), workrave::TestMode::TEST_MODE_IDLE);
+    }
+
+  for (int i = 0; i < subscriber_count; i++)
+    {
+      contexts[i]->TryCancel();
+      (void)readers[i]->Finish();
+    }
+
+  // The last subscriber to leave disconnects from the signal.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(server_object.signal_mode_changed().num_slots(), 0U);
+}
+
+TEST_F(RpcTest, level_changed_starts_with_the_current_value)
+{
+  server_object.set_level_for_test(7);
+
+  grpc::ClientContext first_ctx;
+  std::unique_ptr<grpc::ClientReaderInterface<workrave::LevelChangedEvent>> first =
+    stub->LevelChanged(&first_ctx, workrave::LevelChangedRequest());
+
+  // No sleep needed: a state stream never misses the value it starts with.
+  workrave::LevelChangedEvent event;
+  ASSERT_TRUE(first->Read(&event));
+  EXPECT_EQ(event.value(), 7);
+
+  server_object.set_level_for_test(8);
+  ASSERT_TRUE(first->Read(&event));
+  EXPECT_EQ(event.value(), 8);
+
+  // A late subscriber gets the newest value, not the history.
+  grpc::ClientContext second_ctx;
+  std::unique_ptr<grpc::ClientReaderInterface<workrave::LevelChangedEvent>> second =
+    stub->LevelChanged(&second_ctx, workrave::LevelChangedRequest());
+  ASSERT_TRUE(second->Read(&event));
+  EXPECT_EQ(event.value(), 8);
+
+  first_ctx.TryCancel();
+  (void)first->Finish();
+  second_ctx.TryCancel();
+  (void)second->Finish();
+}
+
+TEST_F(RpcTest, level_changed_drops_frames_a_slow_client_has_no_time_for)
+{
+  grpc::ClientContext ctx;
+  workrave::LevelChangedRequest request;
+  request.set_min_interval_ms(300);
+  std::unique_ptr<grpc::ClientReaderInterface<workrave::LevelChangedEvent>> reader = stub->LevelChanged(&ctx, request);
+
+  workrave::LevelChangedEvent event;
+  ASSERT_TRUE(reader->Read(&event));
+  EXPECT_EQ(event.value(), 0);
+  const auto start = std::chrono::steady_clock::now();
+
+  for (int32_t level = 1; level <= 20; level++)
+    {
+      server_object.set_level_for_test(level);
+    }
+
+  // Everything in between is superseded before the interval is up.
+  ASSERT_TRUE(reader->Read(&event));
+  EXPECT_EQ(event.value(), 20);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(250));
+
+  server_object.set_level_for_test(21);
+  ASSERT_TRUE(reader->Read(&event));
+  EXPECT_EQ(event.value(), 21);
+
+  ctx.TryCancel();
+  (void)reader->Finish();
+}
+
+TEST_F(RpcTest, item_changed_keeps_the_newest_value_per_item)
+{
+  grpc::ClientContext ctx;
+  std::unique_ptr<grpc::ClientReaderInterface<workrave::ItemChangedEvent>> reader =
+    stub->ItemChanged(&ctx, workrave::ItemChangedRequest());
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // Far more than the queue holds (capacity 4); updates to an item that
+  // is still queued replace it rather than push others out.
+  const std::vector<std::string> names{"a", "b", "c"};
+  for (int32_t value = 0; value < 300; value++)
+    {
+      server_object.fire_item_changed_for_test(names[value % names.size()], value);
+    }
+  server_object.fire_item_changed_for_test("end", 0);
+
+  std::map<std::string, int32_t> latest;
+  workrave::ItemChangedEvent event;
+  while (event.name() != "end")
+    {
+      ASSERT_TRUE(reader->Read(&event));
+      latest[event.name()] = event.value();
+    }
+  EXPECT_EQ(latest["a"], 297);
+  EXPECT_EQ(latest["b"], 298);
+  EXPECT_EQ(latest["c"], 299);
+
+  ctx.TryCancel();
+  (void)reader->Finish();
+}
+
+TEST_F(RpcTest, shutdown_ends_open_event_streams)
+{
+  grpc::ClientContext ctx;
+  std::unique_ptr<grpc::ClientReaderInterface<workrave::ModeChangedEvent>> reader =
+    stub->ModeChanged(&ctx, workrave::ModeChangedRequest());
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // Must not wait for the client to cancel first.
+  rpc_server->shutdown();
+
+  workrave::ModeChangedEvent event;
+  EXPECT_FALSE(reader->Read(&event));
+  (void)reader->Finish();
+}
+
+TEST(RpcServerTest, listener_and_in_process_channel_reach_the_same_service)
+{
+  RpcTestServer server_object;
+  TestService impl(server_object);
+  rpc::ServerConfig config;
+  config.listen_address = "127.0.0.1:0";
+  rpc::RpcServer rpc_server(config);
+  rpc_server.register_service(impl);
+  rpc_server.start();
+  ASSERT_NE(rpc_server.bound_port(), 0);
+
+  for (const auto &channel: {grpc::CreateChannel("127.0.0.1:" + std::to_string(rpc_server.bound_port()),
+                                                 grpc::InsecureChannelCredentials()),
+                             rpc_server.in_process_channel()})
+    {
+      auto stub = workrave::TestService::NewStub(channel);
+      grpc::ClientContext ctx;
+      workrave::SetFlagRequest request;
+      request.set_value(!server_object.get_flag());
+      workrave::SetFlagResponse response;
+      ASSERT_TRUE(stub->SetFlag(&ctx, request, &response).ok());
+      EXPECT_EQ(server_object.get_flag(), request.value());
+    }
+}
+
+// Over a real listener: an in-process channel must not be used after
+// shutdown() at all.
+TEST(RpcServerTest, shutdown_rejects_subsequent_calls)
+{
+  RpcTestServer server_object;
+  TestService impl(server_object);
+  rpc::ServerConfig config;
+  config.listen_address = "127.0.0.1:0";
+  rpc::RpcServer rpc_server(config);
+  rpc_server.register_service(impl);
+  rpc_server.start();
+
+  auto stub = workrave::TestService::NewStub(
+    grpc::CreateChannel("127.0.0.1:" + std::to_string(rpc_server.bound_port()), grpc::InsecureChannelCredentials()));
+
+  grpc::ClientContext first_context;
+  workrave::PingRequest request;
+  request.set_message("before shutdown");
+  workrave::PingResponse first_response;
+
+  ASSERT_TRUE(stub->Ping(&first_context, request, &first_response).ok());
+
+  rpc_server.shutdown();
+  EXPECT_THROW((void)rpc_server.in_process_channel(), rpc::RpcException);
+
+  grpc::ClientContext second_context;
+  second_context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(1));
+  workrave::PingResponse second_response;
+  EXPECT_FALSE(stub->Ping(&second_context, request, &second_response).ok());
+}
+
+TEST(RpcServerTest, in_process_channel_needs_a_running_server)
+{
+  rpc::RpcServer rpc_server(rpc::ServerConfig{});
+  EXPECT_THROW((void)rpc_server.in_process_channel(), rpc::RpcException);
+}
+
+TEST(LatencyHistogramTest, buckets_stay_within_an_eighth_of_their_latencies)
+{
+  for (uint64_t usec: {0, 1, 7, 8, 9, 15, 16, 100, 1000, 123456, 10000000})
+    {
+      const std::size_t index = rpc::LatencyHistogram::bucket_index(usec);
+      const uint64_t upper = rpc::LatencyHistogram::bucket_upper_bound(index);
+      EXPECT_GE(upper, usec);
+      EXPECT_LE(upper - usec, usec / 8) << usec;
+      if (index > 0)
+        {
+          EXPECT_LT(rpc::LatencyHistogram::bucket_upper_bound(index - 1), usec) << usec;
+        }
+    }
+  EXPECT_EQ(rpc::LatencyHistogram::bucket_index(uint64_t{1} << 50), rpc::LatencyHistogram::bucket_count - 1);
+}
+
+TEST(LatencyHistogramTest, summary_reports_percentiles_and_failures)
+{
+  rpc::LatencyHistogram histogram;
+  EXPECT_EQ(histogram.summarize().calls, 0);
+
+  for (int i = 1; i <= 100; i++)
+    {
+      histogram.record(std::chrono::microseconds(i * 10), i % 10 != 0);
+    }
+
+  const auto summary = histogram.summarize();
+  EXPECT_EQ(summary.calls, 100);
+  EXPECT_EQ(summary.failed, 10);
+  EXPECT_EQ(summary.mean.count(), 505);
+  EXPECT_EQ(summary.max.count(), 1000);
+  EXPECT_GE(summary.p50.count(), 500);
+  EXPECT_LE(summary.p50.count(), 500 + 500 / 8);
+  EXPECT_GE(summary.p90.count(), 900);
+  EXPECT_LE(summary.p90.count(), 900 + 900 / 8);
+  EXPECT_GE(summary.p99.count(), 990);
+  EXPECT_LE(summary.p99.count(), 1000);
+}
+
+TEST(EventQueueTest, drop_oldest_keeps_the_newest_events)
+{
+  rpc::EventQueue<int> queue({.capacity = 3, .policy = rpc::OverflowPolicy::DropOldest});
+  for (int i = 1; i <= 5; i++)
+    {
+      EXPECT_TRUE(queue.push(i));
+    }
+
+  std::vector<int> popped;
+  int value = 0;
+  while (queue.try_pop(value))
+    {
+      popped.push_back(value);
+    }
+  EXPECT_EQ(popped, (std::vector<int>{3, 4, 5}));
+  EXPECT_EQ(queue.stats().high_water, 3U);
+  EXPECT_EQ(queue.stats().dropped, 2U);
+}
+
+TEST(EventQueueTest, coalesce_replaces_the_pending_event_with_the_same_key)
+{
+  using Item = std::pair<std::string, int>;
+  rpc::EventQueue<Item> queue({.capacity = 2,
+                               .policy = rpc::OverflowPolicy::Coalesce,
+                               .same_key = [](const Item &a, const Item &b) { return a.first == b.first; }});
+  queue.push({"a", 1});
+  queue.push({"b", 1});
+  queue.push({"a", 2});
+
+  // The update to "a" keeps its place in the queue.
+  Item item;
+  ASSERT_TRUE(queue.try_pop(item));
+  EXPECT_EQ(item, Item("a", 2));
+  EXPECT_EQ(queue.stats().coalesced, 1U);
+
+  // A new key in a full queue pushes out the oldest.
+  queue.push({"c", 1});
+  queue.push({"d", 1});
+  ASSERT_TRUE(queue.try_pop(item));
+  EXPECT_EQ(item, Item("c", 1));
+  ASSERT_TRUE(queue.try_pop(item));
+  EXPECT_EQ(item, Item("d", 1));
+  EXPECT_EQ(queue.stats().dropped, 1U);
+}
+
+TEST(EventQueueTest, disconnect_refuses_events_when_full)
+{
+  rpc::EventQueue<int> queue({.capacity = 2, .policy = rpc::OverflowPolicy::Disconnect});
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  EXPECT_FALSE(queue.push(3));
+  EXPECT_EQ(queue.size(), 2U);
+  EXPECT_EQ(queue.stats().rejected, 1U);
+  EXPECT_EQ(queue.stats().dropped, 0U);
+}
+
+TEST(EventQueueTest, keeps_order_across_the_ring_boundary)
+{
+  rpc::EventQueue<int> queue({.capacity = 0});
+  int next_pop = 0;
+  int value = 0;
+  for (int i = 0; i < 100; i++)
+    {
+      queue.push(i);
+      // Every third push is not matched by a pop, so the queue grows
+      // while its head moves around the ring.
+      if (i % 3 != 0)
+        {
+          ASSERT_TRUE(queue.try_pop(value));
+          EXPECT_EQ(value, next_pop++);
+        }
+    }
+  while (queue.try_pop(value))
+    {
+      EXPECT_EQ(value, next_pop++);
+    }
+  EXPECT_EQ(next_pop, 100);
+  EXPECT_EQ(queue.stats().high_water, 34U);
+}
+
+TEST(EventBroadcasterTest, stream_that_does_not_keep_up_is_finished)
+{
+  boost::signals2::signal<void(int32_t)> source;
+  rpc::EventBroadcaster<workrave::LevelChangedEvent> broadcaster({.capacity = 2});
+  auto connect = [&](auto &events) {
+    return source.connect([&events](int32_t level) {
+      workrave::LevelChangedEvent event;
+      event.set_value(level);
+      events.publish(std::move(event));
+    });
+  };
+
+  // Not bound to a call, so the first write never completes and everything
+  // after it stays queued.
+  grpc::ServerWriteReactor<workrave::LevelChangedEvent> *stream = broadcaster.subscribe(connect);
+  for (int32_t level = 0; level < 5; level++)
+    {
+      source(level);
+    }
+
+  EXPECT_EQ(broadcaster.stats().high_water, 2U);
+  EXPECT_EQ(broadcaster.stats().rejected, 2U);
+
+  // What gRPC does once the stream has finished.
+  stream->OnDone();
+  EXPECT_EQ(broadcaster.subscriber_count(), 0U);
+  EXPECT_EQ(source.num_slots(), 0U);
+  EXPECT_EQ(broadcaster.stats().rejected, 2U);
+}
+
+TEST(EventBroadcasterTest, queue_stats_are_reported_by_event_after_the_broadcaster_is_gone)
+{
+  const auto rejected = [] {
+    for (const auto &entry: rpc::event_queue_stats())
+      {
+        if (entry.stream == "workrave.LevelChangedEvent")
+          {
+            return entry.stats.rejected;
+          }
+      }
+    return size_t{0};
+  };
+  const size_t before = rejected();
+
+  {
+    boost::signals2::signal<void(int32_t)> source;
+    rpc::EventBroadcaster<workrave::LevelChangedEvent> broadcaster({.capacity = 1});
+    auto connect = [&](auto &events) {
+      return source.connect([&events](int32_t level) {
+        workrave::LevelChangedEvent event;
+        event.set_value(level);
+        events.publish(std::move(event));
+      });
+    };
+
+    grpc::ServerWriteReactor<workrave::LevelChangedEvent> *stream = broadcaster.subscribe(connect);
+    for (int32_t level = 0; level < 4; level++)
+      {
+        source(level);
+      }
+    EXPECT_EQ(rejected(), before + 2);
+
+    stream->OnDone();
+  }
+
+  EXPECT_EQ(rejected(), before + 2);
+}
+
+TEST(EventBroadcasterTest, keyed_broadcaster_is_pruned_when_its_last_stream_ends)
+{
+  boost::signals2::signal<void(int32_t)> source;
+  rpc::KeyedEventBroadcaster<int, workrave::LevelChangedEvent> broadcasters;
+  auto connect = [&](auto &events) {
+    return source.connect([&events](int32_t level) {
+      workrave::LevelChangedEvent event;
+      event.set_value(level);
+      events.publish(std::move(event));
+    });
+  };
+
+  grpc::ServerWriteReactor<workrave::LevelChangedEvent> *first = broadcasters.subscribe(1, connect);
+  grpc::ServerWriteReactor<workrave::LevelChangedEvent> *second = broadcasters.subscribe(1, connect);
+  grpc::ServerWriteReactor<workrave::LevelChangedEvent> *other = broadcasters.subscribe(2, connect);
+  EXPECT_EQ(broadcasters.size(), 2U);
+
+  first->OnDone();
+  EXPECT_EQ(broadcasters.size(), 2U);
+  second->OnDone();
+  EXPECT_EQ(broadcasters.size(), 1U);
+  other->OnDone();
+  EXPECT_EQ(broadcasters.size(), 0U);
+  EXPECT_EQ(source.num_slots(), 0U);
+
+  // A key that was pruned gets a fresh broadcaster.
+  grpc::ServerWriteReactor<workrave::LevelChangedEvent> *again = broadcasters.subscribe(1, connect);
+  EXPECT_EQ(broadcasters.size(), 1U);
+  again->OnDone();
+  EXPECT_EQ(broadcasters.size(), 0U);
+}
+
+namespace
+{
+  // The same service, but with its calls marshalled onto a "main loop" that
+  // the test thread plays by hand.
+  class RpcExecutorTest : public ::testing::Test
+  {
+  protected:
+    RpcExecutorTest()
+      : executor([this] { wakeups++; })
+      , impl(server_object, executor)
+    {
+      rpc_server = std::make_unique<rpc::RpcServer>(rpc::ServerConfig{});
+      rpc_server->register_service(impl);
+      rpc_server->start();
+
+      auto channel = rpc_server->in_process_channel();
+      stub = workrave::TestService::NewStub(channel);
+    }
+
+    ~RpcExecutorTest() override
+    {
+      executor.close();
+      rpc_server->shutdown();
+    }
+
+    void wait_for_wakeup(int count)
+    {
+      while (wakeups < count)
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    // Drains on every wakeup until the call has completed.
+    template<typename T>
+    T run_loop_until(std::future<T> &result)
+    {
+      while (result.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready)
+        {
+          executor.drain();
+        }
+      return result.get();
+    }
+
+    std::atomic<int> wakeups{0};
+    RpcTestServer server_object;
+    rpc::LoopExecutor executor;
+    TestService impl;
+    std::unique_ptr<rpc::RpcServer> rpc_server;
+    std::unique_ptr<workrave::TestService::Stub> stub;
+  };
+} // namespace
+
+TEST_F(RpcExecutorTest, calls_wait_for_the_loop)
+{
+  auto result = std::async(std::launch::async, [this] {
+    grpc::ClientContext ctx;
+    workrave::SetFlagRequest request;
+    request.set_value(true);
+    workrave::SetFlagResponse response;
+    return stub->SetFlag(&ctx, request, &response).ok();
+  });
+
+  wait_for_wakeup(1);
+  EXPECT_FALSE(server_object.get_flag());
+
+  EXPECT_TRUE(run_loop_until(result));
+  EXPECT_TRUE(server_object.get_flag());
+}
+
+TEST_F(RpcExecutorTest, loop_is_woken_once_per_batch)
+{
+  constexpr int caller_count = 4;
+  std::atomic<int> started{0};
+  std::vector<std::future<int32_t>> results;
+  for (int i = 0; i < caller_count; i++)
+    {
+      results.push_back(std::async(std::launch::async, [this, &started, i] {
+        started++;
+        return executor.run([i] { return i * 2; });
+      }));
+    }
+
+  wait_for_wakeup(1);
+  while (started < caller_count)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+  // However many calls are queued, the loop was only asked to run once.
+  EXPECT_EQ(wakeups, 1);
+
+  for (int i = 0; i < caller_count; i++)
+    {
+      EXPECT_EQ(run_loop_until(results[i]), i * 2);
+    }
+}
+
+TEST_F(RpcExecutorTest, calls_from_the_loop_thread_run_inline)
+{
+  EXPECT_EQ(executor.run([] { return 42; }), 42);
+  EXPECT_EQ(wakeups, 0);
+}
+
+TEST_F(RpcExecutorTest, exceptions_reach_the_caller)
+{
+  auto result = std::async(std::launch::async, [this] {
+    try
+      {
+        executor.run([]() -> int { throw std::runtime_error("boom"); });
+      }
+    catch (const std::runtime_error &e)
+      {
+        return std::string(e.what());
+      }
+    return std::string();
+  });
+
+  EXPECT_EQ(run_loop_until(result), "boom");
+}
+
+TEST_F(RpcExecutorTest, level_changed_takes_the_current_value_on_the_loop)
+{
+  server_object.set_level_for_test(7);
+
+  grpc::ClientContext ctx;
+  std::unique_ptr<grpc::ClientReaderInterface<workrave::LevelChangedEvent>> reader =
+    stub->LevelChanged(&ctx, workrave::LevelChangedRequest());
+  auto result = std::async(std::launch::async, [&reader] {
+    workrave::LevelChangedEvent event;
+    return reader->Read(&event) ? event.value() : -1;
+  });
+
+  // The subscription has returned to gRPC and left get_level() to the loop.
+  wait_for_wakeup(1);
+  EXPECT_EQ(result.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+
+  EXPECT_EQ(run_loop_until(result), 7);
+
+  ctx.TryCancel();
+  (void)reader->Finish();
+}
+
+TEST_F(RpcExecutorTest, latest_only_subscribe_does_not_wait_for_the_loop)
+{
+  boost::signals2::signal<void(int32_t)> source;
+  rpc::EventBroadcaster<workrave::LevelChangedEvent> broadcaster;
+  auto connect = [&](auto &events) {
+    return source.connect([&events](int32_t level) {
+      workrave::LevelChangedEvent event;
+      event.set_value(level);
+      events.publish(std::move(event));
+    });
+  };
+  auto current = [] {
+    workrave::LevelChangedEvent event;
+    event.set_value(7);
+    return event;
+  };
+
+  auto subscribed = std::async(std::launch::async, [&] {
+    return broadcaster.subscribe(connect, rpc::StreamOptions{.latest_only = true}, current, executor);
+  });
+  ASSERT_EQ(subscribed.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  grpc::ServerWriteReactor<workrave::LevelChangedEvent> *stream = subscribed.get();
+  EXPECT_EQ(wakeups, 1);
+
+  executor.drain();
+  EXPECT_EQ(broadcaster.stats().high_water, 1U);
+
+  stream->OnDone();
+  EXPECT_EQ(broadcaster.subscriber_count(), 0U);
+}
+
+TEST_F(RpcExecutorTest, level_changed_stream_may_end_before_its_first_value)
+{
+  {
+    grpc::ClientContext ctx;
+    std::unique_ptr<grpc::ClientReaderInterface<workrave::LevelChangedEvent>> reader =
+      stub->LevelChanged(&ctx, workrave::LevelChangedRequest());
+    wait_for_wakeup(1);
+    ctx.TryCancel();
+    (void)reader->Finish();
+  }
+
+  // Delivers the value to a stream that has gone, or is going.
+  executor.drain();
+}
+
+TEST_F(RpcExecutorTest, closed_executor_rejects_calls)
+{
+  executor.close();
+
+  grpc::ClientContext ctx;
+  workrave::PingRequest request;
+  request.set_message("hello");
+  workrave::PingResponse response;
+
+  grpc::Status status = stub->Ping(&ctx, request, &response);
+  EXPECT_EQ(status.error_code(), grpc::StatusCode::UNAVAILABLE);
+  EXPECT_EQ(status.error_message(), "server is shutting down");
+}
+
 namespace
 {
   // Proves the `keyed_by` mechanism: three live RpcKeyedServer instances
@@ -252,14 +923,11 @@ namespace
       registry.register_instance(WidgetId::Second, second);
       registry.register_instance(WidgetId::Third, third);
 
-      rpc::ServerConfig config;
-      config.listen_address = "127.0.0.1:0";
-      rpc_server = std::make_unique<rpc::RpcServer>(config);
+      rpc_server = std::make_unique<rpc::RpcServer>(rpc::ServerConfig{});
       rpc_server->register_service(impl);
       rpc_server->start();
 
-      auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(rpc_server->bound_port()),
-                                         grpc::InsecureChannelCredentials());
+      auto channel = rpc_server->in_process_channel();
       stub = workrave::WidgetService::NewStub(channel);
     }
 
@@ -337,3 +1005,30 @@ TEST_F(RpcKeyedTest, value_changed_signal_routes_to_subscribed_instance_only)
   ctx.TryCancel();
   (void)reader->Finish();
 }
+
+TEST_F(RpcKeyedTest, interceptor_observes_failed_calls)
+{
+  grpc::StatusCode observed = grpc::StatusCode::OK;
+  auto registration = rpc::register_request_interceptor([&](const rpc::RequestInfo &info) { observed = info.status.error_code(); });
+
+  grpc::ClientContext ctx;
+  workrave::GetValueRequest request;
+  request.set_id(static_cast<workrave::WidgetId>(42));
+  workrave::GetValueResponse response;
+
+  EXPECT_EQ(stub->GetValue(&ctx, request, &response).error_code(), grpc::StatusCode::INVALID_ARGUMENT);
+  EXPECT_EQ(observed, grpc::StatusCode::INVALID_ARGUMENT);
+  EXPECT_GE(rpc::method_latency_histogram("workrave.WidgetService", "GetValue").summarize().failed, 1);
+}
+
+TEST_F(RpcKeyedTest, value_changed_signal_rejects_unknown_instance)
+{
+  grpc::ClientContext ctx;
+  workrave::ValueChangedRequest request;
+  request.set_id(static_cast<workrave::WidgetId>(42));
+  std::unique_ptr<grpc::ClientReaderInterface<workrave::ValueChangedEvent>> reader = stub->ValueChanged(&ctx, request);
+
+  workrave::ValueChangedEvent event;
+  EXPECT_FALSE(reader->Read(&event));
+  EXPECT_EQ(reader->Finish().error_code(), grpc::StatusCode::INVALID_ARGUMENT);
+}
@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcTestServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,24 +15,31 @@
                                                             const ::workrave::PingRequest *request,
                                                             ::workrave::PingResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.TestService", "Ping");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.ping(request->message());
+      auto rpc_result = executor_.run([&] { return impl_.ping(request->message()); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.TestService", "Ping", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.TestService", "Ping", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -38,24 +47,31 @@
                                                             const ::workrave::AddRequest *request,
                                                             ::workrave::AddResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.TestService", "Add");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.add(request->a(), request->b());
+      auto rpc_result = executor_.run([&] { return impl_.add(request->a(), request->b()); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.TestService", "Add", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.TestService", "Add", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -63,21 +79,28 @@
                                                             const ::workrave::SetFlagRequest *request,
                                                             ::workrave::SetFlagResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.TestService", "SetFlag");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_flag(request->value());
+      executor_.run([&] { impl_.set_flag(request->value()); });
 
 
-      ::rpc::intercept_request({"workrave.TestService", "SetFlag", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.TestService", "SetFlag", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -85,6 +108,9 @@
                                                             const ::workrave::GetModeRequest *request,
                                                             ::workrave::GetModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.TestService", "GetMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -92,7 +118,7 @@
       TestMode local_mode{};
 
 
-      auto rpc_result = impl_.get_mode(local_mode);
+      auto rpc_result = executor_.run([&] { return impl_.get_mode(local_mode); });
 
       response->set_result(rpc_result);
 
@@ -100,13 +126,17 @@
 
       response->set_mode(static_cast<::workrave::TestMode>(local_mode));
 
-      ::rpc::intercept_request({"workrave.TestService", "GetMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.TestService", "GetMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -114,54 +144,137 @@
                                                             const ::workrave::GreetRequest *request,
                                                             ::workrave::GreetResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.TestService", "Greet");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.greet(request->name());
+      auto rpc_result = executor_.run([&] { return impl_.greet(request->name()); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.TestService", "Greet", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.TestService", "Greet", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
 
-::grpc::Status TestService::ModeChanged(::grpc::ServerContext *context,
-                                                            const ::workrave::ModeChangedRequest */*request*/,
-                                                            ::grpc::ServerWriter<::workrave::ModeChangedEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::ModeChangedEvent> *TestService::ModeChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::ModeChangedRequest */*request*/)
 {
-
-  ::rpc::EventQueue<::workrave::ModeChangedEvent> queue;
-  auto connection = impl_.signal_mode_changed().connect(
-    [&queue](TestMode value)
+  try
     {
-      ::workrave::ModeChangedEvent event;
 
-      event.set_value(static_cast<::workrave::TestMode>(value));
+      return signal_mode_changed_broadcaster_.subscribe(
+        [this](auto &events)
+        {
+          return impl_.signal_mode_changed().connect(
+            [&events](TestMode value)
+            {
+              ::workrave::ModeChangedEvent event;
 
-      queue.push(event);
-    });
+              event.set_value(static_cast<::workrave::TestMode>(value));
 
-  ::workrave::ModeChangedEvent event;
-  while (queue.wait_and_pop(event, context))
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      return ::rpc::reject_stream<::workrave::ModeChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::ModeChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
+    }
+}
+
+
+::grpc::ServerWriteReactor<::workrave::LevelChangedEvent> *TestService::LevelChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::LevelChangedRequest *request)
+{
+  try
     {
-      if (!writer->Write(event))
+
+      return signal_level_changed_broadcaster_.subscribe(
+        [this](auto &events)
         {
-          break;
-        }
+          return impl_.signal_level_changed().connect(
+            [&events](int32_t value)
+            {
+              ::workrave::LevelChangedEvent event;
+
+              event.set_value(value);
+
+              events.publish(std::move(event));
+            });
+        },
+        ::rpc::StreamOptions{.min_interval = std::chrono::milliseconds(request->min_interval_ms()), .latest_only = true},
+        [this]
+        {
+
+          const int32_t value = impl_.get_level();
+          ::workrave::LevelChangedEvent event;
+          event.set_value(value);
+
+          return event;
+        },
+        executor_);
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      return ::rpc::reject_stream<::workrave::LevelChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::LevelChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
+}
+
+
+::grpc::ServerWriteReactor<::workrave::ItemChangedEvent> *TestService::ItemChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::ItemChangedRequest */*request*/)
+{
+  try
+    {
+
+      return signal_item_changed_broadcaster_.subscribe(
+        [this](auto &events)
+        {
+          return impl_.signal_item_changed().connect(
+            [&events](std::string name, int32_t value)
+            {
+              ::workrave::ItemChangedEvent event;
+
+              event.set_name(name);
+
+              event.set_value(value);
 
-  connection.disconnect();
-  return ::grpc::Status::OK;
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      return ::rpc::reject_stream<::workrave::ItemChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::ItemChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
+    }
 }
 
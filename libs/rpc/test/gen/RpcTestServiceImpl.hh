@@ -7,15 +7,18 @@
 #include "RpcTestServer.hh"
 
 
-#include "rpc/EventQueue.hh"
+#include "rpc/EventBroadcaster.hh"
 
+#include "rpc/Executor.hh"
 
-class TestService final : public ::workrave::TestService::Service
+class TestService final : public ::workrave::TestService::WithCallbackMethod_ModeChanged<::workrave::TestService::WithCallbackMethod_LevelChanged<::workrave::TestService::WithCallbackMethod_ItemChanged<::workrave::TestService::Service>>>
 {
 public:
 
-  explicit TestService(RpcTestServer &impl)
+  explicit TestService(RpcTestServer &impl,
+                       ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -43,13 +46,26 @@ public:
 
 
 
-  ::grpc::Status ModeChanged(::grpc::ServerContext *context,
-                                 const ::workrave::ModeChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::ModeChangedEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::ModeChangedEvent> *ModeChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::ModeChangedRequest *request) override;
+
+  ::grpc::ServerWriteReactor<::workrave::LevelChangedEvent> *LevelChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::LevelChangedRequest *request) override;
+
+  ::grpc::ServerWriteReactor<::workrave::ItemChangedEvent> *ItemChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::ItemChangedRequest *request) override;
 
 
 private:
 
   RpcTestServer &impl_;
+  ::rpc::Executor &executor_;
+
+
+  ::rpc::EventBroadcaster<::workrave::ModeChangedEvent> signal_mode_changed_broadcaster_;
+
+  ::rpc::EventBroadcaster<::workrave::LevelChangedEvent> signal_level_changed_broadcaster_;
+
+  ::rpc::EventBroadcaster<::workrave::ItemChangedEvent> signal_item_changed_broadcaster_{{.capacity = 4, .policy = ::rpc::OverflowPolicy::Coalesce, .same_key = [](const auto &a, const auto &b) { return a->name() == b->name(); }}};
 
 };
\ No newline at end of file
@@ -7,7 +7,7 @@
 use anyhow::{bail, Result};
 use regex::Regex;
 
-use crate::ir::Direction;
+use crate::ir::{Direction, QueuePolicy, StreamQueue};
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum ParamKindTag {
@@ -223,15 +223,20 @@ pub struct SignalTag {
     /// which defaults to a field named "value".
     pub fields: Option<Vec<String>>,
     pub dbus_types: Option<Vec<DbusTypeTag>>,
+    /// From `latest="getter"`: the signal carries state rather than events.
+    /// Names the const method returning the current value, which a new
+    /// subscriber receives first; after that a subscriber only ever gets the
+    /// newest value, at most as often as it asks for.
+    pub latest: Option<String>,
 }
 
-/// `@rpc.signal(name="Name"[, fields="a,b,..."])` on a
+/// `@rpc.signal(name="Name"[, fields="a,b,..."][, latest="getter"])` on a
 /// `boost::signals2::signal<void(Args...)> &` accessor — marks it as a
 /// push event source (a server-streaming RPC), the gRPC analog of a DBus
 /// signal.
 pub fn parse_signal_tag(comment: &str) -> Result<Option<SignalTag>> {
     let re = Regex::new(
-        r#"@rpc\.signal\(\s*name\s*=\s*"([^"]+)"\s*(?:,\s*fields\s*=\s*"([^"]*)"\s*)?(?:,\s*dbus_types\s*=\s*"([^"]*)"\s*)?\)"#,
+        r#"@rpc\.signal\(\s*name\s*=\s*"([^"]+)"\s*(?:,\s*fields\s*=\s*"([^"]*)"\s*)?(?:,\s*dbus_types\s*=\s*"([^"]*)"\s*)?(?:,\s*latest\s*=\s*"([^"]+)"\s*)?\)"#,
     )
     .expect("valid regex");
     let Some(caps) = re.captures(comment) else {
@@ -253,10 +258,56 @@ pub fn parse_signal_tag(comment: &str) -> Result<Option<SignalTag>> {
                 .collect::<Result<Vec<_>>>()
         })
         .transpose()?;
+    let latest = caps.get(4).map(|m| m.as_str().trim().to_string());
     Ok(Some(SignalTag {
         name,
         fields,
         dbus_types,
+        latest,
+    }))
+}
+
+/// `@rpc.queue(policy="drop_oldest|coalesce|disconnect"[, capacity=N][, key="field"])`
+/// next to an `@rpc.signal` tag — what a subscriber's stream does with events
+/// once its client falls `capacity` events behind. `key` names the event
+/// field that `coalesce` matches pending events on.
+pub fn parse_queue_tag(comment: &str) -> Result<Option<StreamQueue>> {
+    let re = Regex::new(
+        r#"@rpc\.queue\(\s*policy\s*=\s*"([^"]+)"\s*(?:,\s*capacity\s*=\s*(\d+)\s*)?(?:,\s*key\s*=\s*"([^"]+)"\s*)?\)"#,
+    )
+    .expect("valid regex");
+    let Some(caps) = re.captures(comment) else {
+        return Ok(None);
+    };
+    let policy = match &caps[1] {
+        "drop_oldest" => QueuePolicy::DropOldest,
+        "coalesce" => QueuePolicy::Coalesce,
+        "disconnect" => QueuePolicy::Disconnect,
+        other => bail!(
+            "unknown @rpc.queue policy \"{other}\" (expected drop_oldest, coalesce or disconnect)"
+        ),
+    };
+    let capacity = caps
+        .get(2)
+        .map(|m| m.as_str().parse::<usize>())
+        .transpose()?;
+    if capacity == Some(0) {
+        bail!("@rpc.queue capacity must be at least 1");
+    }
+    let key = caps.get(3).map(|m| m.as_str().trim().to_string());
+    match (policy, &key) {
+        (QueuePolicy::Coalesce, None) => {
+            bail!("@rpc.queue policy=\"coalesce\" needs key=\"field\"")
+        }
+        (QueuePolicy::DropOldest | QueuePolicy::Disconnect, Some(_)) => {
+            bail!("@rpc.queue key=\"...\" only applies to policy=\"coalesce\"")
+        }
+        _ => {}
+    }
+    Ok(Some(StreamQueue {
+        policy,
+        capacity,
+        key,
     }))
 }
 
@@ -423,6 +474,38 @@ mod tests {
         let tag = parse_signal_tag(c).unwrap().unwrap();
         assert_eq!(tag.name, "OperationModeChanged");
         assert_eq!(tag.fields, None);
+        assert_eq!(tag.latest, None);
+    }
+
+    #[test]
+    fn signal_tag_with_latest() {
+        let c = "// @rpc.signal(name=\"TimersChanged\", latest=\"get_timers\")";
+        let tag = parse_signal_tag(c).unwrap().unwrap();
+        assert_eq!(tag.name, "TimersChanged");
+        assert_eq!(tag.latest, Some("get_timers".to_string()));
+    }
+
+    #[test]
+    fn queue_tag() {
+        let c = "// @rpc.queue(policy=\"coalesce\", capacity=64, key=\"name\")";
+        let tag = parse_queue_tag(c).unwrap().unwrap();
+        assert_eq!(tag.policy, QueuePolicy::Coalesce);
+        assert_eq!(tag.capacity, Some(64));
+        assert_eq!(tag.key, Some("name".to_string()));
+
+        let c = "// @rpc.queue(policy=\"drop_oldest\")";
+        let tag = parse_queue_tag(c).unwrap().unwrap();
+        assert_eq!(tag.policy, QueuePolicy::DropOldest);
+        assert_eq!(tag.capacity, None);
+        assert_eq!(parse_queue_tag("// @rpc.signal(name=\"X\")").unwrap(), None);
+    }
+
+    #[test]
+    fn queue_tag_rejects_inconsistent_options() {
+        assert!(parse_queue_tag("// @rpc.queue(policy=\"newest\")").is_err());
+        assert!(parse_queue_tag("// @rpc.queue(policy=\"coalesce\")").is_err());
+        assert!(parse_queue_tag("// @rpc.queue(policy=\"disconnect\", key=\"id\")").is_err());
+        assert!(parse_queue_tag("// @rpc.queue(policy=\"disconnect\", capacity=0)").is_err());
     }
 
     #[test]
@@ -9,14 +9,14 @@ use clang::{Accessibility, Clang, Entity, EntityKind, Index, Type, TypeKind};
 
 use crate::annotations::{
     has_bitmask_tag, parse_dbus_return_type, parse_dbus_tag, parse_enum_proto_name, parse_enum_tag,
-    parse_enum_value_tag, parse_method_tag, parse_param_tags, parse_service_tag, parse_signal_tag,
-    DbusTypeTag, ParamKindTag,
+    parse_enum_value_tag, parse_method_tag, parse_param_tags, parse_queue_tag, parse_service_tag,
+    parse_signal_tag, DbusTypeTag, ParamKindTag,
 };
 use crate::external_annotations::{effective_comment, ExternalAnnotations};
 use crate::ir::{
     CxxType, DbusType, Direction, EnumDef, EnumValue, Interface, KeyType, MapKey, Method, Param,
-    ParamKind, ProtoType, ReturnValue, SequenceElement, Signal, SignalField, StructDef,
-    StructField, Unit,
+    ParamKind, ProtoType, ReturnValue, SequenceElement, Signal, SignalField, StreamQueue,
+    StructDef, StructField, Unit,
 };
 
 fn dbus_type(value: DbusTypeTag) -> DbusType {
@@ -459,8 +459,10 @@ fn build_interface(
             continue;
         };
 
+        let queue = parse_queue_tag(&comment)
+            .with_context(|| format!("processing {cxx_class}::{method_cxx_name}"))?;
         if let Some(tag) = parse_signal_tag(&comment)? {
-            let signal = build_signal(&child, tag, external, unit)
+            let signal = build_signal(&child, tag, queue, external, unit)
                 .with_context(|| format!("processing {cxx_class}::{method_cxx_name}"))?;
             signals.push(signal);
             continue;
@@ -468,6 +470,9 @@ fn build_interface(
         let Some(rpc_name) = parse_method_tag(&comment) else {
             continue;
         };
+        if queue.is_some() {
+            bail!("{cxx_class}::{method_cxx_name}: @rpc.queue only applies to an @rpc.signal accessor");
+        }
         let method = build_method(&child, rpc_name, &comment, external, unit)
             .with_context(|| format!("processing {cxx_class}::{method_cxx_name}"))?;
         methods.push(method);
@@ -512,6 +517,7 @@ fn signal_argument_types<'tu>(ty: &Type<'tu>) -> Option<Vec<Type<'tu>>> {
 fn build_signal(
     method_entity: &Entity,
     tag: crate::annotations::SignalTag,
+    queue: Option<StreamQueue>,
     external: &ExternalAnnotations,
     unit: &mut Unit,
 ) -> Result<Signal> {
@@ -574,10 +580,44 @@ fn build_signal(
         });
     }
 
+    if tag.latest.is_some() && fields.len() != 1 {
+        bail!(
+            "{rpc_name}: latest=\"...\" needs a signal with exactly one argument (the state \
+             the getter returns), but it has {}",
+            fields.len()
+        );
+    }
+
+    if let Some(queue) = &queue {
+        if tag.latest.is_some() {
+            bail!(
+                "{rpc_name}: @rpc.queue cannot be combined with latest=\"...\", which already keeps \
+                 only the newest value"
+            );
+        }
+        if let Some(key) = &queue.key {
+            let Some(field) = fields.iter().find(|field| &field.proto_field == key) else {
+                bail!("{rpc_name}: @rpc.queue key=\"{key}\" is not a field of the signal");
+            };
+            if matches!(
+                field.proto_type,
+                ProtoType::Message(_) | ProtoType::Repeated(_) | ProtoType::Map(_, _)
+            ) {
+                bail!(
+                    "{rpc_name}: @rpc.queue key=\"{key}\" must be a scalar, string or enum field, \
+                     not {}",
+                    field.proto_type
+                );
+            }
+        }
+    }
+
     Ok(Signal {
         rpc_name,
         cxx_symbol,
         fields,
+        latest: tag.latest,
+        queue,
     })
 }
 
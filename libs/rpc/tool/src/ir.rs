@@ -243,6 +243,31 @@ pub struct Signal {
     /// The real accessor method name, e.g. "signal_operation_mode_changed".
     pub cxx_symbol: String,
     pub fields: Vec<SignalField>,
+    /// `latest="getter"`: the const method returning the current value of a
+    /// state signal (one field only), sent to every new subscriber first.
+    pub latest: Option<String>,
+    /// `@rpc.queue(...)`: how each stream buffers events its client has not
+    /// read yet. None keeps the runtime default (bounded, disconnect).
+    pub queue: Option<StreamQueue>,
+}
+
+/// What a stream does with an event that does not fit in its queue; mirrors
+/// `rpc::OverflowPolicy`.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum QueuePolicy {
+    DropOldest,
+    Coalesce,
+    Disconnect,
+}
+
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct StreamQueue {
+    pub policy: QueuePolicy,
+    /// None keeps the runtime default capacity.
+    pub capacity: Option<usize>,
+    /// Coalesce only: the event field saying what an event is about; a new
+    /// event replaces a pending one with an equal value.
+    pub key: Option<String>,
 }
 
 #[derive(Debug, Clone)]
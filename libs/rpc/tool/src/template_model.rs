@@ -10,8 +10,8 @@ use anyhow::{bail, Context, Result};
 use serde::Serialize;
 
 use crate::ir::{
-    CxxType, DbusType, Direction, Interface, ParamKind, ProtoType, SequenceElement, Signal,
-    StructDef, Unit,
+    CxxType, DbusType, Direction, Interface, ParamKind, ProtoType, QueuePolicy, SequenceElement,
+    Signal, StructDef, Unit,
 };
 
 pub(crate) type TemplateTypeId = String;
@@ -144,6 +144,18 @@ pub(crate) struct SignalModel {
     pub cxx_symbol: String,
     pub request_fields: Vec<WireFieldModel>,
     pub event_fields: Vec<SignalFieldModel>,
+    /// The getter of a state signal; see `Signal::latest`.
+    pub latest: Option<String>,
+    pub queue: Option<QueueModel>,
+}
+
+#[derive(Debug, Serialize)]
+pub(crate) struct QueueModel {
+    /// The `rpc::OverflowPolicy` enumerator.
+    pub policy: &'static str,
+    pub capacity: Option<usize>,
+    /// Proto name of the event field that `Coalesce` compares.
+    pub key: Option<String>,
 }
 
 #[derive(Debug, Serialize)]
@@ -664,7 +676,7 @@ impl<'a> ModelBuilder<'a> {
         signal: &Signal,
         keyed_by: Option<&KeyModel>,
     ) -> Result<SignalModel> {
-        let request_fields = keyed_by
+        let mut request_fields = keyed_by
             .map(|key| {
                 vec![WireFieldModel {
                     proto_name: "id".to_string(),
@@ -673,6 +685,19 @@ impl<'a> ModelBuilder<'a> {
                 }]
             })
             .unwrap_or_default();
+        if signal.latest.is_some() {
+            // The subscriber picks how often it wants the newest value; 0
+            // sends every change.
+            request_fields.push(WireFieldModel {
+                proto_name: "min_interval_ms".to_string(),
+                number: request_fields.len() + 1,
+                type_id: self.register_type(
+                    &plain_cxx_type("uint32_t"),
+                    &ProtoType::UInt32,
+                    &ParamKind::Value,
+                )?,
+            });
+        }
 
         let mut event_fields = Vec::new();
         for (index, field) in signal.fields.iter().enumerate() {
@@ -702,6 +727,16 @@ impl<'a> ModelBuilder<'a> {
             cxx_symbol: signal.cxx_symbol.clone(),
             request_fields,
             event_fields,
+            latest: signal.latest.clone(),
+            queue: signal.queue.as_ref().map(|queue| QueueModel {
+                policy: match queue.policy {
+                    QueuePolicy::DropOldest => "DropOldest",
+                    QueuePolicy::Coalesce => "Coalesce",
+                    QueuePolicy::Disconnect => "Disconnect",
+                },
+                capacity: queue.capacity,
+                key: queue.key.clone(),
+            }),
         })
     }
 
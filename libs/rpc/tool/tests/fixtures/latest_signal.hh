@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+#include <boost/signals2/signal.hpp>
+
+// A state signal: `latest=` names the getter a new subscriber starts from,
+// and the subscriber picks the rate (`min_interval_ms`) it wants updates at.
+// @rpc(service="workrave.test.LevelService")
+class RpcLevelFixture
+{
+public:
+  int32_t get_level() const;
+
+  // @rpc.signal(name="LevelChanged", latest="get_level")
+  boost::signals2::signal<void(int32_t)> &signal_level_changed()
+  {
+    return signal_level_changed_;
+  }
+
+private:
+  boost::signals2::signal<void(int32_t)> signal_level_changed_;
+};
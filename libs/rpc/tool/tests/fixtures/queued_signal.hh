@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <boost/signals2/signal.hpp>
+
+// Per-signal overflow policies for a client that does not keep up.
+// @rpc(service="workrave.test.QueueService")
+class RpcQueueFixture
+{
+public:
+  // Every event matters: the default bounded queue, disconnecting the client.
+  // @rpc.signal(name="Tick")
+  boost::signals2::signal<void(int32_t)> &signal_tick()
+  {
+    return signal_tick_;
+  }
+
+  // @rpc.signal(name="ModeChanged")
+  // @rpc.queue(policy="drop_oldest", capacity=1)
+  boost::signals2::signal<void(int32_t)> &signal_mode_changed()
+  {
+    return signal_mode_changed_;
+  }
+
+  // @rpc.signal(name="ItemChanged", fields="name,value")
+  // @rpc.queue(policy="coalesce", key="name")
+  boost::signals2::signal<void(std::string, int32_t)> &signal_item_changed()
+  {
+    return signal_item_changed_;
+  }
+
+private:
+  boost::signals2::signal<void(int32_t)> signal_tick_;
+  boost::signals2::signal<void(int32_t)> signal_mode_changed_;
+  boost::signals2::signal<void(std::string, int32_t)> signal_item_changed_;
+};
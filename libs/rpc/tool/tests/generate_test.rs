@@ -261,17 +261,17 @@ fn generates_proto_and_adapter_for_simple_fixture() {
     let header_out = fs::read_to_string(&generated.adapter_hh).unwrap();
     assert!(
         header_out
-            .contains("class TestService final : public ::workrave::test::TestService::Service"),
+            .contains("class TestService final : public ::workrave::test::TestService::WithCallbackMethod_ModeChanged<::workrave::test::TestService::Service>"),
         "{header_out}"
     );
     assert!(header_out.contains("RpcTestServer &impl"), "{header_out}");
     assert!(
-        header_out.contains("#include \"rpc/EventQueue.hh\""),
+        header_out.contains("#include \"rpc/EventBroadcaster.hh\""),
         "{header_out}"
     );
     assert!(
         header_out.contains(
-            "::grpc::ServerWriter<::workrave::test::ModeChangedEvent> *writer) override;"
+            "::grpc::ServerWriteReactor<::workrave::test::ModeChangedEvent> *ModeChanged(::grpc::CallbackServerContext *context,"
         ),
         "{header_out}"
     );
@@ -293,6 +293,10 @@ fn generates_proto_and_adapter_for_simple_fixture() {
         source_out.contains("impl_.add(request->a(), request->b())"),
         "{source_out}"
     );
+    assert!(
+        source_out.contains("executor_.run([&] { return impl_.add(request->a(), request->b()); })"),
+        "{source_out}"
+    );
     assert!(
         source_out.contains("impl_.set_flag(request->value())"),
         "{source_out}"
@@ -316,7 +320,7 @@ fn generates_proto_and_adapter_for_simple_fixture() {
         "{source_out}"
     );
     assert!(
-        source_out.contains("impl_.signal_mode_changed().connect(\n    [&queue](TestMode value)"),
+        source_out.contains("impl_.signal_mode_changed().connect(\n            [&events](TestMode value)"),
         "{source_out}"
     );
     assert!(
@@ -324,7 +328,7 @@ fn generates_proto_and_adapter_for_simple_fixture() {
         "{source_out}"
     );
     assert!(
-        source_out.contains("queue.wait_and_pop(event, context)"),
+        source_out.contains("events.publish(std::move(event));"),
         "{source_out}"
     );
 }
@@ -462,10 +466,11 @@ fn generates_keyed_service_with_instance_registry() {
     );
     assert!(
         header_out.contains(
-            "explicit WidgetService(::rpc::InstanceRegistry<WidgetId, RpcKeyedFixture> &registry)"
+            "explicit WidgetService(::rpc::InstanceRegistry<WidgetId, RpcKeyedFixture> &registry,"
         ),
         "{header_out}"
     );
+    assert!(header_out.contains("::rpc::Executor &executor_;"), "{header_out}");
 
     let source_out = fs::read_to_string(&generated.adapter_cc).unwrap();
     assert!(
@@ -495,12 +500,12 @@ fn generates_keyed_service_with_instance_registry() {
     );
     assert!(
         source_out.contains(
-            "auto &impl_ = registry_.resolve(static_cast<WidgetId>(request->id()));\n\n  ::rpc::EventQueue<::workrave::test::ValueChangedEvent> queue;"
+            "auto &impl_ = registry_.resolve(id);\n\n      return signal_value_changed_broadcaster_.subscribe(\n        id,"
         ),
         "{source_out}"
     );
     assert!(
-        source_out.contains("impl_.signal_value_changed().connect(\n    [&queue](int32_t value)"),
+        source_out.contains("impl_.signal_value_changed().connect(\n            [&events](int32_t value)"),
         "{source_out}"
     );
     assert!(
@@ -717,6 +722,163 @@ public:
     );
 }
 
+#[test]
+fn generates_latest_value_signal() {
+    let (_dir, generated) = generate_fixture("latest_signal.hh", "RpcLevel");
+
+    let proto = fs::read_to_string(&generated.proto).unwrap();
+    assert!(
+        proto.contains("message LevelChangedRequest {\n\n  uint32 min_interval_ms = 1;"),
+        "{proto}"
+    );
+    assert!(
+        proto.contains("rpc LevelChanged(LevelChangedRequest) returns (stream LevelChangedEvent);"),
+        "{proto}"
+    );
+
+    let source_out = fs::read_to_string(&generated.adapter_cc).unwrap();
+    assert!(
+        source_out.contains(
+            "::rpc::StreamOptions{.min_interval = std::chrono::milliseconds(request->min_interval_ms()), .latest_only = true}"
+        ),
+        "{source_out}"
+    );
+    // The starting value is read on the executor's thread, without blocking
+    // the subscribing gRPC thread.
+    assert!(source_out.contains("const int32_t value = impl_.get_level();"), "{source_out}");
+    assert!(source_out.contains("return event;\n        },\n        executor_);"), "{source_out}");
+}
+
+#[test]
+fn rejects_latest_on_multi_argument_signal() {
+    let dir = tempfile::tempdir().unwrap();
+    let header = dir.path().join("bad_latest.hh");
+    fs::write(
+        &header,
+        r#"
+#pragma once
+#include <boost/signals2/signal.hpp>
+
+// @rpc(service="workrave.test.BadLatestService")
+class RpcBadLatestFixture
+{
+public:
+  int get_a() const;
+
+  // @rpc.signal(name="Changed", fields="a,b", latest="get_a")
+  boost::signals2::signal<void(int, int)> &signal_changed();
+};
+"#,
+    )
+    .unwrap();
+    let parse_context = dir.path().join("parse-context.txt");
+    fs::write(&parse_context, "standard=c++23\n").unwrap();
+
+    let _guard = clang_test_lock().lock().unwrap_or_else(|e| e.into_inner());
+    let out_dir = dir.path().join("out");
+    let opts = GenerateOptions {
+        header,
+        parse_context,
+        out_proto: out_dir.join("BadLatest.proto"),
+        out_adapter_hh: out_dir.join("BadLatestServiceImpl.hh"),
+        out_adapter_cc: out_dir.join("BadLatestServiceImpl.cc"),
+        out_types_proto: None,
+        proto_types_package: None,
+        grpc_services_namespace: None,
+        adapter_namespace: None,
+        header_include: None,
+        external_annotations: None,
+        out_dbus_hh: None,
+        out_dbus_cc: None,
+        dbus_header_include: None,
+        dbus_backend: DbusBackend::Qt,
+    };
+
+    let err = generate(&opts).expect_err("latest= on a two-argument signal must be rejected");
+    assert!(
+        format!("{err:#}").contains("needs a signal with exactly one argument"),
+        "{err:#}"
+    );
+}
+
+#[test]
+fn generates_queue_policy_per_signal() {
+    let (_dir, generated) = generate_fixture("queued_signal.hh", "RpcQueue");
+
+    let header_out = fs::read_to_string(&generated.adapter_hh).unwrap();
+    assert!(
+        header_out.contains(
+            "::rpc::EventBroadcaster<::workrave::test::TickEvent> signal_tick_broadcaster_;"
+        ),
+        "{header_out}"
+    );
+    assert!(
+        header_out.contains(
+            "signal_mode_changed_broadcaster_{{.capacity = 1, .policy = ::rpc::OverflowPolicy::DropOldest}};"
+        ),
+        "{header_out}"
+    );
+    assert!(
+        header_out.contains(
+            "signal_item_changed_broadcaster_{{.policy = ::rpc::OverflowPolicy::Coalesce, \
+             .same_key = [](const auto &a, const auto &b) { return a->name() == b->name(); }}};"
+        ),
+        "{header_out}"
+    );
+}
+
+#[test]
+fn rejects_queue_key_that_is_not_a_field() {
+    let dir = tempfile::tempdir().unwrap();
+    let header = dir.path().join("bad_queue.hh");
+    fs::write(
+        &header,
+        r#"
+#pragma once
+#include <string>
+#include <boost/signals2/signal.hpp>
+
+// @rpc(service="workrave.test.BadQueueService")
+class RpcBadQueueFixture
+{
+public:
+  // @rpc.signal(name="Changed", fields="name,value")
+  // @rpc.queue(policy="coalesce", key="id")
+  boost::signals2::signal<void(std::string, int)> &signal_changed();
+};
+"#,
+    )
+    .unwrap();
+    let parse_context = dir.path().join("parse-context.txt");
+    fs::write(&parse_context, "standard=c++23\n").unwrap();
+
+    let _guard = clang_test_lock().lock().unwrap_or_else(|e| e.into_inner());
+    let out_dir = dir.path().join("out");
+    let opts = GenerateOptions {
+        header,
+        parse_context,
+        out_proto: out_dir.join("BadQueue.proto"),
+        out_adapter_hh: out_dir.join("BadQueueServiceImpl.hh"),
+        out_adapter_cc: out_dir.join("BadQueueServiceImpl.cc"),
+        out_types_proto: None,
+        proto_types_package: None,
+        grpc_services_namespace: None,
+        adapter_namespace: None,
+        header_include: None,
+        external_annotations: None,
+        out_dbus_hh: None,
+        out_dbus_cc: None,
+        dbus_header_include: None,
+        dbus_backend: DbusBackend::Qt,
+    };
+
+    let err = generate(&opts).expect_err("a coalesce key must name a signal field");
+    assert!(
+        format!("{err:#}").contains("@rpc.queue key=\"id\" is not a field of the signal"),
+        "{err:#}"
+    );
+}
+
 /// A plain struct/class value type (`TimerData`/`MenuItem`) used as an
 /// in-parameter, a return value, an out-parameter, and a signal field, plus
 /// `std::vector<T>`/`std::list<T>` sequences of both scalar and struct
@@ -817,7 +979,7 @@ fn generates_struct_and_sequence_marshalling() {
     // Signal field of struct type: the lambda receives the real struct by
     // value and writes it field-by-field into the event.
     assert!(
-        source_out.contains("[&queue](TimerData value)"),
+        source_out.contains("[&events](TimerData value)"),
         "{source_out}"
     );
     assert!(
@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcDbusScalarServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,24 +15,31 @@
                                                             const ::workrave::test::PingRequest *request,
                                                             ::workrave::test::PingResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DBusFixtureService", "Ping");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.ping(request->message());
+      auto rpc_result = executor_.run([&] { return impl_.ping(request->message()); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.test.DBusFixtureService", "Ping", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DBusFixtureService", "Ping", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -38,24 +47,31 @@
                                                             const ::workrave::test::GetModeRequest *request,
                                                             ::workrave::test::GetModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DBusFixtureService", "GetMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.get_mode();
+      auto rpc_result = executor_.run([&] { return impl_.get_mode(); });
 
       response->set_result(static_cast<::workrave::test::TestMode>(rpc_result));
 
 
 
-      ::rpc::intercept_request({"workrave.test.DBusFixtureService", "GetMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DBusFixtureService", "GetMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -63,51 +79,59 @@
                                                             const ::workrave::test::SetModeRequest *request,
                                                             ::workrave::test::SetModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DBusFixtureService", "SetMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_mode(static_cast<TestMode>(request->mode()));
+      executor_.run([&] { impl_.set_mode(static_cast<TestMode>(request->mode())); });
 
 
-      ::rpc::intercept_request({"workrave.test.DBusFixtureService", "SetMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DBusFixtureService", "SetMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
 
-::grpc::Status DBusFixtureService::ModeChanged(::grpc::ServerContext *context,
-                                                            const ::workrave::test::ModeChangedRequest */*request*/,
-                                                            ::grpc::ServerWriter<::workrave::test::ModeChangedEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::test::ModeChangedEvent> *DBusFixtureService::ModeChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::test::ModeChangedRequest */*request*/)
 {
-
-  ::rpc::EventQueue<::workrave::test::ModeChangedEvent> queue;
-  auto connection = impl_.signal_mode_changed().connect(
-    [&queue](TestMode value)
+  try
     {
-      ::workrave::test::ModeChangedEvent event;
 
-      event.set_value(static_cast<::workrave::test::TestMode>(value));
+      return signal_mode_changed_broadcaster_.subscribe(
+        [this](auto &events)
+        {
+          return impl_.signal_mode_changed().connect(
+            [&events](TestMode value)
+            {
+              ::workrave::test::ModeChangedEvent event;
 
-      queue.push(event);
-    });
+              event.set_value(static_cast<::workrave::test::TestMode>(value));
 
-  ::workrave::test::ModeChangedEvent event;
-  while (queue.wait_and_pop(event, context))
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
     {
-      if (!writer->Write(event))
-        {
-          break;
-        }
+      return ::rpc::reject_stream<::workrave::test::ModeChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::test::ModeChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
-
-  connection.disconnect();
-  return ::grpc::Status::OK;
 }
 
@@ -7,15 +7,18 @@
 #include "dbus_scalar.hh"
 
 
-#include "rpc/EventQueue.hh"
+#include "rpc/EventBroadcaster.hh"
 
+#include "rpc/Executor.hh"
 
-class DBusFixtureService final : public ::workrave::test::DBusFixtureService::Service
+class DBusFixtureService final : public ::workrave::test::DBusFixtureService::WithCallbackMethod_ModeChanged<::workrave::test::DBusFixtureService::Service>
 {
 public:
 
-  explicit DBusFixtureService(RpcDBusFixture &impl)
+  explicit DBusFixtureService(RpcDBusFixture &impl,
+                              ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -35,13 +38,16 @@ public:
 
 
 
-  ::grpc::Status ModeChanged(::grpc::ServerContext *context,
-                                 const ::workrave::test::ModeChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::test::ModeChangedEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::test::ModeChangedEvent> *ModeChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::test::ModeChangedRequest *request) override;
 
 
 private:
 
   RpcDBusFixture &impl_;
+  ::rpc::Executor &executor_;
+
+
+  ::rpc::EventBroadcaster<::workrave::test::ModeChangedEvent> signal_mode_changed_broadcaster_;
 
 };
\ No newline at end of file
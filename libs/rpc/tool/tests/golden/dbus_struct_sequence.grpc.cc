@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcDbusStructSeqServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,6 +15,9 @@
                                                             const ::workrave::test::SetPointRequest *request,
                                                             ::workrave::test::SetPointResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DBusFixture2Service", "SetPoint");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -24,16 +29,20 @@
       local_p.y = request->p().y();
 
 
-      impl_.set_point(local_p);
+      executor_.run([&] { impl_.set_point(local_p); });
 
 
-      ::rpc::intercept_request({"workrave.test.DBusFixture2Service", "SetPoint", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DBusFixture2Service", "SetPoint", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -41,12 +50,15 @@
                                                             const ::workrave::test::GetPointRequest *request,
                                                             ::workrave::test::GetPointResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DBusFixture2Service", "GetPoint");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.get_point();
+      auto rpc_result = executor_.run([&] { return impl_.get_point(); });
 
       auto *rpc_msg_0 = response->mutable_result();
 
@@ -54,13 +66,17 @@
 
 
 
-      ::rpc::intercept_request({"workrave.test.DBusFixture2Service", "GetPoint", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DBusFixture2Service", "GetPoint", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -68,6 +84,9 @@
                                                             const ::workrave::test::SetTagsRequest *request,
                                                             ::workrave::test::SetTagsResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DBusFixture2Service", "SetTags");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -77,16 +96,20 @@
       for (const auto &rpc_wire_0 : request->tags()) { int32_t rpc_item_0{}; rpc_item_0 = rpc_wire_0; local_tags.push_back(rpc_item_0); }
 
 
-      impl_.set_tags(local_tags);
+      executor_.run([&] { impl_.set_tags(local_tags); });
 
 
-      ::rpc::intercept_request({"workrave.test.DBusFixture2Service", "SetTags", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DBusFixture2Service", "SetTags", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -94,24 +117,31 @@
                                                             const ::workrave::test::GetPointsRequest *request,
                                                             ::workrave::test::GetPointsResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DBusFixture2Service", "GetPoints");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.get_points();
+      auto rpc_result = executor_.run([&] { return impl_.get_points(); });
 
       for (const auto &rpc_item_0 : rpc_result) { auto *rpc_elem_0 = response->add_result(); rpc_elem_0->set_x(rpc_item_0.x); rpc_elem_0->set_y(rpc_item_0.y); }
 
 
 
-      ::rpc::intercept_request({"workrave.test.DBusFixture2Service", "GetPoints", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DBusFixture2Service", "GetPoints", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
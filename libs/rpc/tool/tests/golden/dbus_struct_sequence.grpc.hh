@@ -7,13 +7,16 @@
 #include "dbus_struct_sequence.hh"
 
 
+#include "rpc/Executor.hh"
 
 class DBusFixture2Service final : public ::workrave::test::DBusFixture2Service::Service
 {
 public:
 
-  explicit DBusFixture2Service(RpcDBusFixture2 &impl)
+  explicit DBusFixture2Service(RpcDBusFixture2 &impl,
+                               ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -41,5 +44,6 @@ public:
 private:
 
   RpcDBusFixture2 &impl_;
+  ::rpc::Executor &executor_;
 
 };
\ No newline at end of file
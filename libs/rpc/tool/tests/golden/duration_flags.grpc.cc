@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcDurationFlagsServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 #include "rpc/Duration.hh"
@@ -15,21 +17,28 @@
                                                             const ::workrave::test::SetTimeoutRequest *request,
                                                             ::workrave::test::SetTimeoutResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DurationFlagsService", "SetTimeout");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_timeout(std::chrono::duration_cast<std::chrono::minutes>(::rpc::parse_duration(request->duration())));
+      executor_.run([&] { impl_.set_timeout(std::chrono::duration_cast<std::chrono::minutes>(::rpc::parse_duration(request->duration()))); });
 
 
-      ::rpc::intercept_request({"workrave.test.DurationFlagsService", "SetTimeout", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DurationFlagsService", "SetTimeout", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -37,6 +46,9 @@
                                                             const ::workrave::test::SetPermissionsRequest *request,
                                                             ::workrave::test::SetPermissionsResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.DurationFlagsService", "SetPermissions");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -46,16 +58,20 @@
       for (int i = 0; i < request->perms_size(); ++i) { local_perms |= static_cast<testutil::Perm>(request->perms(i)); }
 
 
-      impl_.set_permissions(local_perms);
+      executor_.run([&] { impl_.set_permissions(local_perms); });
 
 
-      ::rpc::intercept_request({"workrave.test.DurationFlagsService", "SetPermissions", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.DurationFlagsService", "SetPermissions", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
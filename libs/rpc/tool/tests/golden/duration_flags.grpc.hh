@@ -7,13 +7,16 @@
 #include "duration_flags.hh"
 
 
+#include "rpc/Executor.hh"
 
 class DurationFlagsService final : public ::workrave::test::DurationFlagsService::Service
 {
 public:
 
-  explicit DurationFlagsService(RpcDurationFlagsFixture &impl)
+  explicit DurationFlagsService(RpcDurationFlagsFixture &impl,
+                                ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -33,5 +36,6 @@ public:
 private:
 
   RpcDurationFlagsFixture &impl_;
+  ::rpc::Executor &executor_;
 
 };
\ No newline at end of file
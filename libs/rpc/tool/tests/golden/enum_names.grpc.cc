@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcEnumNamesServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,21 +15,28 @@
                                                             const ::workrave::test::SetOperationModeRequest *request,
                                                             ::workrave::test::SetOperationModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.EnumNamesService", "SetOperationMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_operation_mode(static_cast<OperationMode>(request->mode()));
+      executor_.run([&] { impl_.set_operation_mode(static_cast<OperationMode>(request->mode())); });
 
 
-      ::rpc::intercept_request({"workrave.test.EnumNamesService", "SetOperationMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.EnumNamesService", "SetOperationMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -7,13 +7,16 @@
 #include "enum_names.hh"
 
 
+#include "rpc/Executor.hh"
 
 class EnumNamesService final : public ::workrave::test::EnumNamesService::Service
 {
 public:
 
-  explicit EnumNamesService(RpcEnumNamesFixture &impl)
+  explicit EnumNamesService(RpcEnumNamesFixture &impl,
+                            ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -29,5 +32,6 @@ public:
 private:
 
   RpcEnumNamesFixture &impl_;
+  ::rpc::Executor &executor_;
 
 };
\ No newline at end of file
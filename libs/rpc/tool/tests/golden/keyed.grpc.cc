@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcKeyedServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,6 +15,9 @@
                                                             const ::workrave::test::GetValueRequest *request,
                                                             ::workrave::test::GetValueResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.WidgetService", "GetValue");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -20,19 +25,23 @@
 
 
 
-      auto rpc_result = impl_.get_value();
+      auto rpc_result = executor_.run([&] { return impl_.get_value(); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.test.WidgetService", "GetValue", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.WidgetService", "GetValue", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -40,6 +49,9 @@
                                                             const ::workrave::test::SetValueRequest *request,
                                                             ::workrave::test::SetValueResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.WidgetService", "SetValue");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -47,48 +59,55 @@
 
 
 
-      impl_.set_value(request->v());
+      executor_.run([&] { impl_.set_value(request->v()); });
 
 
-      ::rpc::intercept_request({"workrave.test.WidgetService", "SetValue", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.WidgetService", "SetValue", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
 
-::grpc::Status WidgetService::ValueChanged(::grpc::ServerContext *context,
-                                                            const ::workrave::test::ValueChangedRequest *request,
-                                                            ::grpc::ServerWriter<::workrave::test::ValueChangedEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::test::ValueChangedEvent> *WidgetService::ValueChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::test::ValueChangedRequest *request)
 {
-
-  auto &impl_ = registry_.resolve(static_cast<WidgetId>(request->id()));
-
-  ::rpc::EventQueue<::workrave::test::ValueChangedEvent> queue;
-  auto connection = impl_.signal_value_changed().connect(
-    [&queue](int32_t value)
+  try
     {
-      ::workrave::test::ValueChangedEvent event;
 
-      event.set_value(value);
+      const auto id = static_cast<WidgetId>(request->id());
+      auto &impl_ = registry_.resolve(id);
 
-      queue.push(event);
-    });
+      return signal_value_changed_broadcaster_.subscribe(
+        id,
+        [&impl_](auto &events)
+        {
+          return impl_.signal_value_changed().connect(
+            [&events](int32_t value)
+            {
+              ::workrave::test::ValueChangedEvent event;
 
-  ::workrave::test::ValueChangedEvent event;
-  while (queue.wait_and_pop(event, context))
+              event.set_value(value);
+
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
     {
-      if (!writer->Write(event))
-        {
-          break;
-        }
+      return ::rpc::reject_stream<::workrave::test::ValueChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::test::ValueChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
-
-  connection.disconnect();
-  return ::grpc::Status::OK;
 }
 
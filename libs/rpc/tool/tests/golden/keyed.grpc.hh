@@ -9,10 +9,11 @@
 #include "rpc/InstanceRegistry.hh"
 
 
-#include "rpc/EventQueue.hh"
+#include "rpc/EventBroadcaster.hh"
 
+#include "rpc/Executor.hh"
 
-class WidgetService final : public ::workrave::test::WidgetService::Service
+class WidgetService final : public ::workrave::test::WidgetService::WithCallbackMethod_ValueChanged<::workrave::test::WidgetService::Service>
 {
 public:
 
@@ -20,8 +21,10 @@ public:
   // registry that instances register themselves into (see rpc::InstanceRegistry),
   // and each RPC resolves its target from the request's `id` field — the gRPC
   // analog of DBus's per-object-path routing.
-  explicit WidgetService(::rpc::InstanceRegistry<WidgetId, RpcKeyedFixture> &registry)
+  explicit WidgetService(::rpc::InstanceRegistry<WidgetId, RpcKeyedFixture> &registry,
+                         ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : registry_(registry)
+    , executor_(executor)
   {
   }
 
@@ -37,13 +40,16 @@ public:
 
 
 
-  ::grpc::Status ValueChanged(::grpc::ServerContext *context,
-                                 const ::workrave::test::ValueChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::test::ValueChangedEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::test::ValueChangedEvent> *ValueChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::test::ValueChangedRequest *request) override;
 
 
 private:
 
   ::rpc::InstanceRegistry<WidgetId, RpcKeyedFixture> &registry_;
+  ::rpc::Executor &executor_;
+
+
+  ::rpc::KeyedEventBroadcaster<WidgetId, ::workrave::test::ValueChangedEvent> signal_value_changed_broadcaster_;
 
 };
\ No newline at end of file
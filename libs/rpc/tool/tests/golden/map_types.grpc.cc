@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcMapTypesServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,6 +15,9 @@
                                                             const ::workrave::test::SetCountersRequest *request,
                                                             ::workrave::test::SetCountersResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.MapTypesService", "SetCounters");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -22,16 +27,20 @@
       for (const auto &rpc_kv_0 : request->counters()) { int32_t rpc_val_0{}; rpc_val_0 = rpc_kv_0.second; local_counters.emplace(rpc_kv_0.first, rpc_val_0); }
 
 
-      impl_.set_counters(local_counters);
+      executor_.run([&] { impl_.set_counters(local_counters); });
 
 
-      ::rpc::intercept_request({"workrave.test.MapTypesService", "SetCounters", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.MapTypesService", "SetCounters", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -39,6 +48,9 @@
                                                             const ::workrave::test::GetMenuByActionRequest *request,
                                                             ::workrave::test::GetMenuByActionResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.MapTypesService", "GetMenuByAction");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -46,18 +58,22 @@
       std::map<std::string, MenuItem> local_out{};
 
 
-      impl_.get_menu_by_action(local_out);
+      executor_.run([&] { impl_.get_menu_by_action(local_out); });
 
 
       for (const auto &rpc_kv_0 : local_out) { auto &rpc_map_val_0 = (*response->mutable_out())[rpc_kv_0.first]; rpc_map_val_0.set_text(rpc_kv_0.second.text); rpc_map_val_0.set_command(rpc_kv_0.second.command); }
 
-      ::rpc::intercept_request({"workrave.test.MapTypesService", "GetMenuByAction", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.MapTypesService", "GetMenuByAction", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
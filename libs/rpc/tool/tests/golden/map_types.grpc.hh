@@ -7,13 +7,16 @@
 #include "map_types.hh"
 
 
+#include "rpc/Executor.hh"
 
 class MapTypesService final : public ::workrave::test::MapTypesService::Service
 {
 public:
 
-  explicit MapTypesService(RpcMapTypesFixture &impl)
+  explicit MapTypesService(RpcMapTypesFixture &impl,
+                           ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -33,5 +36,6 @@ public:
 private:
 
   RpcMapTypesFixture &impl_;
+  ::rpc::Executor &executor_;
 
 };
\ No newline at end of file
@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcNestedServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,6 +15,9 @@
                                                             const ::workrave::test::SetTimerDataRequest *request,
                                                             ::workrave::test::SetTimerDataResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.NestedService", "SetTimerData");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -26,16 +31,20 @@
       local_data.bar_primary_val = request->data().bar_primary_val();
 
 
-      impl_.set_timer_data(local_data);
+      executor_.run([&] { impl_.set_timer_data(local_data); });
 
 
-      ::rpc::intercept_request({"workrave.test.NestedService", "SetTimerData", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.NestedService", "SetTimerData", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -43,6 +52,9 @@
                                                             const ::workrave::test::GetMenuRequest *request,
                                                             ::workrave::test::GetMenuResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.NestedService", "GetMenu");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -50,18 +62,22 @@
       std::list<RpcNestedFixture::MenuItem> local_out{};
 
 
-      impl_.get_menu(local_out);
+      executor_.run([&] { impl_.get_menu(local_out); });
 
 
       for (const auto &rpc_item_0 : local_out) { auto *rpc_elem_0 = response->add_out(); rpc_elem_0->set_text(rpc_item_0.text); rpc_elem_0->set_command(rpc_item_0.command); rpc_elem_0->set_flags(rpc_item_0.flags); }
 
-      ::rpc::intercept_request({"workrave.test.NestedService", "GetMenu", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.NestedService", "GetMenu", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
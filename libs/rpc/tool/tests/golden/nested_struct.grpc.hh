@@ -7,13 +7,16 @@
 #include "nested_struct.hh"
 
 
+#include "rpc/Executor.hh"
 
 class NestedService final : public ::workrave::test::NestedService::Service
 {
 public:
 
-  explicit NestedService(RpcNestedFixture &impl)
+  explicit NestedService(RpcNestedFixture &impl,
+                         ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -33,5 +36,6 @@ public:
 private:
 
   RpcNestedFixture &impl_;
+  ::rpc::Executor &executor_;
 
 };
\ No newline at end of file
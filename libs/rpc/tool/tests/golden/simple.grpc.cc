@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcTestServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,24 +15,31 @@
                                                             const ::workrave::test::PingRequest *request,
                                                             ::workrave::test::PingResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.TestService", "Ping");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.ping(request->message());
+      auto rpc_result = executor_.run([&] { return impl_.ping(request->message()); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.test.TestService", "Ping", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.TestService", "Ping", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -38,24 +47,31 @@
                                                             const ::workrave::test::AddRequest *request,
                                                             ::workrave::test::AddResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.TestService", "Add");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.add(request->a(), request->b());
+      auto rpc_result = executor_.run([&] { return impl_.add(request->a(), request->b()); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.test.TestService", "Add", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.TestService", "Add", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -63,21 +79,28 @@
                                                             const ::workrave::test::SetFlagRequest *request,
                                                             ::workrave::test::SetFlagResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.TestService", "SetFlag");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      impl_.set_flag(request->value());
+      executor_.run([&] { impl_.set_flag(request->value()); });
 
 
-      ::rpc::intercept_request({"workrave.test.TestService", "SetFlag", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.TestService", "SetFlag", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -85,6 +108,9 @@
                                                             const ::workrave::test::GetModeRequest *request,
                                                             ::workrave::test::GetModeResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.TestService", "GetMode");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -92,7 +118,7 @@
       TestMode local_mode{};
 
 
-      auto rpc_result = impl_.get_mode(local_mode);
+      auto rpc_result = executor_.run([&] { return impl_.get_mode(local_mode); });
 
       response->set_result(rpc_result);
 
@@ -100,13 +126,17 @@
 
       response->set_mode(static_cast<::workrave::test::TestMode>(local_mode));
 
-      ::rpc::intercept_request({"workrave.test.TestService", "GetMode", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.TestService", "GetMode", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -114,54 +144,62 @@
                                                             const ::workrave::test::GreetRequest *request,
                                                             ::workrave::test::GreetResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.TestService", "Greet");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.greet(request->name());
+      auto rpc_result = executor_.run([&] { return impl_.greet(request->name()); });
 
       response->set_result(rpc_result);
 
 
 
-      ::rpc::intercept_request({"workrave.test.TestService", "Greet", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.TestService", "Greet", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
 
-::grpc::Status TestService::ModeChanged(::grpc::ServerContext *context,
-                                                            const ::workrave::test::ModeChangedRequest */*request*/,
-                                                            ::grpc::ServerWriter<::workrave::test::ModeChangedEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::test::ModeChangedEvent> *TestService::ModeChanged(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::test::ModeChangedRequest */*request*/)
 {
-
-  ::rpc::EventQueue<::workrave::test::ModeChangedEvent> queue;
-  auto connection = impl_.signal_mode_changed().connect(
-    [&queue](TestMode value)
+  try
     {
-      ::workrave::test::ModeChangedEvent event;
 
-      event.set_value(static_cast<::workrave::test::TestMode>(value));
+      return signal_mode_changed_broadcaster_.subscribe(
+        [this](auto &events)
+        {
+          return impl_.signal_mode_changed().connect(
+            [&events](TestMode value)
+            {
+              ::workrave::test::ModeChangedEvent event;
 
-      queue.push(event);
-    });
+              event.set_value(static_cast<::workrave::test::TestMode>(value));
 
-  ::workrave::test::ModeChangedEvent event;
-  while (queue.wait_and_pop(event, context))
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
     {
-      if (!writer->Write(event))
-        {
-          break;
-        }
+      return ::rpc::reject_stream<::workrave::test::ModeChangedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::test::ModeChangedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
-
-  connection.disconnect();
-  return ::grpc::Status::OK;
 }
 
@@ -7,15 +7,18 @@
 #include "simple.hh"
 
 
-#include "rpc/EventQueue.hh"
+#include "rpc/EventBroadcaster.hh"
 
+#include "rpc/Executor.hh"
 
-class TestService final : public ::workrave::test::TestService::Service
+class TestService final : public ::workrave::test::TestService::WithCallbackMethod_ModeChanged<::workrave::test::TestService::Service>
 {
 public:
 
-  explicit TestService(RpcTestServer &impl)
+  explicit TestService(RpcTestServer &impl,
+                       ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -43,13 +46,16 @@ public:
 
 
 
-  ::grpc::Status ModeChanged(::grpc::ServerContext *context,
-                                 const ::workrave::test::ModeChangedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::test::ModeChangedEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::test::ModeChangedEvent> *ModeChanged(::grpc::CallbackServerContext *context,
+                                 const ::workrave::test::ModeChangedRequest *request) override;
 
 
 private:
 
   RpcTestServer &impl_;
+  ::rpc::Executor &executor_;
+
+
+  ::rpc::EventBroadcaster<::workrave::test::ModeChangedEvent> signal_mode_changed_broadcaster_;
 
 };
\ No newline at end of file
@@ -3,8 +3,10 @@
 // instead of hand-editing this file; it will be overwritten on the next build.
 #include "RpcStructSeqServiceImpl.hh"
 
+#include <chrono>
 #include <exception>
 
+#include "rpc/LatencyHistogram.hh"
 #include "rpc/RequestInterceptor.hh"
 
 
@@ -13,6 +15,9 @@
                                                             const ::workrave::test::SetTimerDataRequest *request,
                                                             ::workrave::test::SetTimerDataResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.StructSeqService", "SetTimerData");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -26,16 +31,20 @@
       local_data.bar_primary_val = request->data().bar_primary_val();
 
 
-      impl_.set_timer_data(local_data);
+      executor_.run([&] { impl_.set_timer_data(local_data); });
 
 
-      ::rpc::intercept_request({"workrave.test.StructSeqService", "SetTimerData", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.StructSeqService", "SetTimerData", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -43,12 +52,15 @@
                                                             const ::workrave::test::GetTimerDataRequest *request,
                                                             ::workrave::test::GetTimerDataResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.StructSeqService", "GetTimerData");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
 
 
-      auto rpc_result = impl_.get_timer_data();
+      auto rpc_result = executor_.run([&] { return impl_.get_timer_data(); });
 
       auto *rpc_msg_0 = response->mutable_result();
 
@@ -56,13 +68,17 @@
 
 
 
-      ::rpc::intercept_request({"workrave.test.StructSeqService", "GetTimerData", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.StructSeqService", "GetTimerData", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -70,6 +86,9 @@
                                                             const ::workrave::test::GetMenuRequest *request,
                                                             ::workrave::test::GetMenuResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.StructSeqService", "GetMenu");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -77,18 +96,22 @@
       std::list<MenuItem> local_out{};
 
 
-      impl_.get_menu(local_out);
+      executor_.run([&] { impl_.get_menu(local_out); });
 
 
       for (const auto &rpc_item_0 : local_out) { auto *rpc_elem_0 = response->add_out(); rpc_elem_0->set_text(rpc_item_0.text); rpc_elem_0->set_command(rpc_item_0.command); rpc_elem_0->set_flags(rpc_item_0.flags); }
 
-      ::rpc::intercept_request({"workrave.test.StructSeqService", "GetMenu", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.StructSeqService", "GetMenu", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
@@ -96,6 +119,9 @@
                                                             const ::workrave::test::SetTagsRequest *request,
                                                             ::workrave::test::SetTagsResponse *response)
 {
+  static ::rpc::LatencyHistogram &rpc_latency = ::rpc::method_latency_histogram("workrave.test.StructSeqService", "SetTags");
+  const auto rpc_start = std::chrono::steady_clock::now();
+  ::grpc::Status rpc_status;
   try
     {
 
@@ -105,48 +131,53 @@
       for (const auto &rpc_wire_0 : request->tags()) { int32_t rpc_item_0{}; rpc_item_0 = rpc_wire_0; local_tags.push_back(rpc_item_0); }
 
 
-      impl_.set_tags(local_tags);
+      executor_.run([&] { impl_.set_tags(local_tags); });
 
 
-      ::rpc::intercept_request({"workrave.test.StructSeqService", "SetTags", *request});
+    }
+  catch (const ::rpc::ExecutorClosed &e)
+    {
+      rpc_status = ::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what());
     }
   catch (const std::exception &e)
     {
-      return ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
+      rpc_status = ::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what());
     }
-  return ::grpc::Status::OK;
+  ::rpc::intercept_request(rpc_latency, {"workrave.test.StructSeqService", "SetTags", *request, *response, rpc_status, rpc_start});
+  return rpc_status;
 }
 
 
 
-::grpc::Status StructSeqService::TimerUpdated(::grpc::ServerContext *context,
-                                                            const ::workrave::test::TimerUpdatedRequest */*request*/,
-                                                            ::grpc::ServerWriter<::workrave::test::TimerUpdatedEvent> *writer)
+::grpc::ServerWriteReactor<::workrave::test::TimerUpdatedEvent> *StructSeqService::TimerUpdated(::grpc::CallbackServerContext * /*context*/,
+                                                            const ::workrave::test::TimerUpdatedRequest */*request*/)
 {
-
-  ::rpc::EventQueue<::workrave::test::TimerUpdatedEvent> queue;
-  auto connection = impl_.signal_timer_updated().connect(
-    [&queue](TimerData value)
+  try
     {
-      ::workrave::test::TimerUpdatedEvent event;
 
-      auto *rpc_msg_0 = event.mutable_value();
+      return signal_timer_updated_broadcaster_.subscribe(
+        [this](auto &events)
+        {
+          return impl_.signal_timer_updated().connect(
+            [&events](TimerData value)
+            {
+              ::workrave::test::TimerUpdatedEvent event;
 
-      rpc_msg_0->set_bar_text(value.bar_text); rpc_msg_0->set_slot(value.slot); rpc_msg_0->set_bar_primary_val(value.bar_primary_val);
+              auto *rpc_msg_0 = event.mutable_value();
 
-      queue.push(event);
-    });
+              rpc_msg_0->set_bar_text(value.bar_text); rpc_msg_0->set_slot(value.slot); rpc_msg_0->set_bar_primary_val(value.bar_primary_val);
 
-  ::workrave::test::TimerUpdatedEvent event;
-  while (queue.wait_and_pop(event, context))
+              events.publish(std::move(event));
+            });
+        });
+    }
+  catch (const ::rpc::ExecutorClosed &e)
     {
-      if (!writer->Write(event))
-        {
-          break;
-        }
+      return ::rpc::reject_stream<::workrave::test::TimerUpdatedEvent>(::grpc::Status(::grpc::StatusCode::UNAVAILABLE, e.what()));
+    }
+  catch (const std::exception &e)
+    {
+      return ::rpc::reject_stream<::workrave::test::TimerUpdatedEvent>(::grpc::Status(::grpc::StatusCode::INVALID_ARGUMENT, e.what()));
     }
-
-  connection.disconnect();
-  return ::grpc::Status::OK;
 }
 
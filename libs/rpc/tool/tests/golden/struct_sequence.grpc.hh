@@ -7,15 +7,18 @@
 #include "struct_sequence.hh"
 
 
-#include "rpc/EventQueue.hh"
+#include "rpc/EventBroadcaster.hh"
 
+#include "rpc/Executor.hh"
 
-class StructSeqService final : public ::workrave::test::StructSeqService::Service
+class StructSeqService final : public ::workrave::test::StructSeqService::WithCallbackMethod_TimerUpdated<::workrave::test::StructSeqService::Service>
 {
 public:
 
-  explicit StructSeqService(RpcStructSeqFixture &impl)
+  explicit StructSeqService(RpcStructSeqFixture &impl,
+                            ::rpc::Executor &executor = ::rpc::Executor::inline_executor())
     : impl_(impl)
+    , executor_(executor)
   {
   }
 
@@ -39,13 +42,16 @@ public:
 
 
 
-  ::grpc::Status TimerUpdated(::grpc::ServerContext *context,
-                                 const ::workrave::test::TimerUpdatedRequest *request,
-                                 ::grpc::ServerWriter<::workrave::test::TimerUpdatedEvent> *writer) override;
+  ::grpc::ServerWriteReactor<::workrave::test::TimerUpdatedEvent> *TimerUpdated(::grpc::CallbackServerContext *context,
+                                 const ::workrave::test::TimerUpdatedRequest *request) override;
 
 
 private:
 
   RpcStructSeqFixture &impl_;
+  ::rpc::Executor &executor_;
+
+
+  ::rpc::EventBroadcaster<::workrave::test::TimerUpdatedEvent> signal_timer_updated_broadcaster_;
 
 };
\ No newline at end of file
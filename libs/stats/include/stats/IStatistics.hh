@@ -99,6 +99,25 @@ namespace workrave::stats
     //! A local calendar date, as statistics are kept per calendar day.
     using Date = std::chrono::year_month_day;
 
+    //! The statistics of a range of days, as one column per value.
+    /*!
+     *  Every column runs parallel to dates: column[i] belongs to dates[i].
+     */
+    struct RangeStats
+    {
+      //! The dates in the range that have statistics, oldest first.
+      std::vector<Date> dates;
+
+      //! How often the user was prompted for, took, skipped or postponed each break.
+      std::array<workrave::utils::array<BreakStatValue, std::vector<int64_t>>, BREAK_ID_SIZEOF> break_stats{};
+
+      //! How long each break has been overdue.
+      std::array<std::vector<std::chrono::seconds>, BREAK_ID_SIZEOF> total_overdue{};
+
+      //! How long the user has been active.
+      std::vector<std::chrono::seconds> active_time;
+    };
+
   public:
     virtual ~IStatistics() = default;
 
@@ -114,6 +133,9 @@ namespace workrave::stats
     //! this to avoid wearing out storage.
     virtual void save() = 0;
 
+    //! Writes break counter changes that the store is still holding back.
+    virtual void flush() = 0;
+
     //! The day in progress, which is being counted right now.
     virtual DailyStats *get_current_day() const = 0;
 
@@ -146,6 +168,10 @@ namespace workrave::stats
 
     //! The total active time over the inclusive date range.
     virtual std::chrono::seconds get_total_active_time(const Date &from, const Date &to) const = 0;
+
+    //! The statistics of every date in the inclusive range, today included, in one go.
+    //! Meant for the days of a week or a month; get_total_active_time() is faster over longer ranges.
+    virtual RangeStats get_range(const Date &from, const Date &to) const = 0;
   };
 
   //! Creates the statistics. is_active reports whether the user is active right now.
@@ -0,0 +1,149 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include "BreakCounterWriter.hh"
+
+#include <spdlog/spdlog.h>
+
+namespace workrave::stats
+{
+  BreakCounterWriter::BreakCounterWriter(Commit commit, std::chrono::milliseconds flush_window)
+    : commit(std::move(commit))
+    , flush_window(flush_window)
+  {
+    thread = std::thread([this]() { run(); });
+  }
+
+  BreakCounterWriter::~BreakCounterWriter()
+  {
+    {
+      std::scoped_lock lock(mutex);
+      stopping = true;
+    }
+    cv.notify_one();
+    thread.join();
+
+    // Drain on the way out, so that a clean shutdown loses nothing.
+    commit_pending();
+  }
+
+  void
+  BreakCounterWriter::set(workrave::BreakId break_id, int counter, int64_t value)
+  {
+    std::scoped_lock lock(mutex);
+
+    const bool was_empty = pending.empty();
+    const auto [it, inserted] = pending.insert_or_assign(Key{break_id, counter}, value);
+    if (!inserted)
+      {
+        merged_count++;
+      }
+
+    if (was_empty)
+      {
+        first_pending_time = std::chrono::steady_clock::now();
+        cv.notify_one();
+      }
+  }
+
+  void
+  BreakCounterWriter::flush()
+  {
+    commit_pending();
+  }
+
+  int64_t
+  BreakCounterWriter::get_merged_count() const
+  {
+    std::scoped_lock lock(mutex);
+    return merged_count;
+  }
+
+  int64_t
+  BreakCounterWriter::get_commit_count() const
+  {
+    std::scoped_lock lock(mutex);
+    return commit_count;
+  }
+
+  //! Waits for the first queued update, then for its flush window to pass.
+  void
+  BreakCounterWriter::run()
+  {
+    std::unique_lock lock(mutex);
+    while (true)
+      {
+        cv.wait(lock, [this]() { return stopping || !pending.empty(); });
+        if (stopping)
+          {
+            break;
+          }
+
+        // Wake up early only to stop, or when a flush() has beaten us to it.
+        const auto deadline = first_pending_time + flush_window;
+        cv.wait_until(lock, deadline, [this]() { return stopping || pending.empty(); });
+        if (stopping)
+          {
+            break;
+          }
+
+        lock.unlock();
+        commit_pending();
+        lock.lock();
+      }
+  }
+
+  void
+  BreakCounterWriter::commit_pending()
+  {
+    std::scoped_lock commit_lock(commit_mutex);
+
+    std::vector<Update> batch;
+    {
+      std::scoped_lock lock(mutex);
+      if (pending.empty())
+        {
+          return;
+        }
+
+      batch.reserve(pending.size());
+      for (const auto &[key, value]: pending)
+        {
+          batch.push_back(Update{key.first, key.second, value});
+        }
+      pending.clear();
+      commit_count++;
+    }
+
+    if (!commit(batch))
+      {
+        spdlog::warn("failed to write {} break counters, retrying later", batch.size());
+
+        // Put back what has not been superseded in the meantime, to be retried
+        // with the next batch.
+        std::scoped_lock lock(mutex);
+        if (pending.empty())
+          {
+            first_pending_time = std::chrono::steady_clock::now();
+          }
+        for (const Update &update: batch)
+          {
+            pending.try_emplace(Key{update.break_id, update.counter}, update.value);
+          }
+      }
+  }
+} // namespace workrave::stats
@@ -0,0 +1,107 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef WORKRAVE_LIBS_STATS_BREAKCOUNTERWRITER_HH
+#define WORKRAVE_LIBS_STATS_BREAKCOUNTERWRITER_HH
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/CoreTypes.hh"
+
+namespace workrave::stats
+{
+  //! Group-commits break counter updates of the day in progress.
+  /*!
+   *  Every prompt, postpone or skip sets a break counter, and written one by
+   *  one each of those is a transaction of its own, which is slow on network
+   *  home directories. This keeps only the latest value of each counter and
+   *  hands them to the commit function together, from a background thread,
+   *  at most one flush window after the first of them arrived. That window is
+   *  also the most that can be lost if Workrave dies without a chance to drain.
+   *
+   *  Batches are committed in the order they were taken, never concurrently,
+   *  so an older value can never overwrite a newer one.
+   */
+  class BreakCounterWriter
+  {
+  public:
+    //! A single counter, at its latest value.
+    struct Update
+    {
+      workrave::BreakId break_id;
+      int counter;
+      int64_t value;
+    };
+
+    //! Writes a batch of updates, in one transaction. Called from either thread.
+    using Commit = std::function<bool(const std::vector<Update> &)>;
+
+    BreakCounterWriter(Commit commit, std::chrono::milliseconds flush_window);
+    ~BreakCounterWriter();
+
+    BreakCounterWriter(const BreakCounterWriter &) = delete;
+    BreakCounterWriter &operator=(const BreakCounterWriter &) = delete;
+    BreakCounterWriter(BreakCounterWriter &&) = delete;
+    BreakCounterWriter &operator=(BreakCounterWriter &&) = delete;
+
+    //! Queues a counter update, replacing a queued update of the same counter.
+    void set(workrave::BreakId break_id, int counter, int64_t value);
+
+    //! Commits whatever is queued right away, on the calling thread.
+    void flush();
+
+    //! How many updates replaced a queued update instead of becoming a write of their own.
+    [[nodiscard]] int64_t get_merged_count() const;
+
+    //! How many batches were committed.
+    [[nodiscard]] int64_t get_commit_count() const;
+
+  private:
+    void run();
+    void commit_pending();
+
+  private:
+    using Key = std::pair<workrave::BreakId, int>;
+
+    Commit commit;
+    std::chrono::milliseconds flush_window;
+
+    //! Held while a batch is taken and written, so that batches land in order.
+    std::mutex commit_mutex;
+
+    //! Guards everything below.
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    std::map<Key, int64_t> pending;
+    std::chrono::steady_clock::time_point first_pending_time;
+    int64_t merged_count{0};
+    int64_t commit_count{0};
+    bool stopping{false};
+
+    std::thread thread;
+  };
+} // namespace workrave::stats
+
+#endif // WORKRAVE_LIBS_STATS_BREAKCOUNTERWRITER_HH
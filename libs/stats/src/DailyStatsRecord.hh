@@ -18,10 +18,16 @@
 #ifndef WORKRAVE_LIBS_STATS_DAILYSTATSRECORD_HH
 #define WORKRAVE_LIBS_STATS_DAILYSTATSRECORD_HH
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstdint>
+#include <limits>
+#include <utility>
 #include <vector>
 
+#include "core/CoreTypes.hh"
+#include "stats/IStatistics.hh"
 #include "stats/LocalTime.hh"
 
 namespace workrave::stats
@@ -30,25 +36,261 @@ namespace workrave::stats
   using Date = std::chrono::year_month_day;
 
   //! The statistics of a single day.
+  /*!
+   *  The counters Workrave keeps are laid out densely, so that a record can be
+   *  filled, copied and saved without touching the heap. Counters outside that
+   *  layout can only come from disk, written by another version of Workrave;
+   *  they are carried along in extra_counters so that they survive a save.
+   */
   struct DailyStatsRecord
   {
+    //! The counters of each break: one per BreakStatValue, followed by how long the break was overdue.
+    static constexpr size_t BREAK_COUNTERS = static_cast<size_t>(STATS_BREAKVALUE_SIZEOF) + 1;
+
+    //! The miscellaneous counters, as Workrave has always written them. Only the
+    //! first, the active time, is still kept up to date.
+    static constexpr size_t MISC_COUNTERS = 6;
+
+    //! The break id under which extra_counters holds miscellaneous counters.
+    static constexpr size_t MISC = std::numeric_limits<size_t>::max();
+
+    //! A counter outside the dense layout.
+    struct ExtraCounter
+    {
+      size_t break_id;
+      size_t counter;
+      int64_t value;
+
+      bool operator==(const ExtraCounter &other) const = default;
+    };
+
     //! When this day started.
     LocalTime start;
 
     //! When the user was last active on this day.
     LocalTime stop;
 
-    //! Per break statistics, indexed by break id and then by counter. TODO/STATS: std::map? std::array?
-    std::vector<std::vector<int64_t>> break_stats;
+    //! Per break statistics, indexed by break id and then by counter.
+    std::array<std::array<int64_t, BREAK_COUNTERS>, BREAK_ID_SIZEOF> break_stats{};
 
     //! Miscellaneous statistics, indexed by counter.
-    std::vector<int64_t> misc_stats;
+    std::array<int64_t, MISC_COUNTERS> misc_stats{};
+
+    //! Counters outside the arrays above, ordered by break id and counter. Empty unless read from disk.
+    std::vector<ExtraCounter> extra_counters;
 
     //! The calendar day these statistics belong to.
     [[nodiscard]] Date date() const
     {
       return date_of(start);
     }
+
+    [[nodiscard]] int64_t get_break(size_t break_id, size_t counter) const
+    {
+      if (break_id < BREAK_ID_SIZEOF && counter < BREAK_COUNTERS)
+        {
+          return break_stats[break_id][counter];
+        }
+      return get_extra(break_id, counter);
+    }
+
+    void set_break(size_t break_id, size_t counter, int64_t value)
+    {
+      if (break_id < BREAK_ID_SIZEOF && counter < BREAK_COUNTERS)
+        {
+          break_stats[break_id][counter] = value;
+          return;
+        }
+      set_extra(break_id, counter, value);
+    }
+
+    [[nodiscard]] int64_t get_misc(size_t counter) const
+    {
+      return counter < MISC_COUNTERS ? misc_stats[counter] : get_extra(MISC, counter);
+    }
+
+    void set_misc(size_t counter, int64_t value)
+    {
+      if (counter < MISC_COUNTERS)
+        {
+          misc_stats[counter] = value;
+          return;
+        }
+      set_extra(MISC, counter, value);
+    }
+
+    //! The number of breaks up to the last one with a counter that is not zero, including unknown ones.
+    [[nodiscard]] size_t break_count() const
+    {
+      size_t count = 0;
+      for (size_t break_id = 0; break_id < BREAK_ID_SIZEOF; break_id++)
+        {
+          if (last_nonzero(break_stats[break_id]) > 0)
+            {
+              count = break_id + 1;
+            }
+        }
+      for (const ExtraCounter &extra: extra_counters)
+        {
+          if (extra.break_id != MISC && extra.value != 0)
+            {
+              count = std::max(count, extra.break_id + 1);
+            }
+        }
+      return count;
+    }
+
+    //! The number of counters of a break up to the last one that is not zero, including unknown ones.
+    /*!
+     *  A counter that reads as zero need not be stored, so this is how many
+     *  counters of the break are written out.
+     */
+    [[nodiscard]] size_t counter_count(size_t break_id) const
+    {
+      size_t count = break_id < BREAK_ID_SIZEOF ? last_nonzero(break_stats[break_id]) : 0;
+      return std::max(count, extra_count(break_id));
+    }
+
+    //! The number of miscellaneous counters up to the last one that is not zero, including unknown ones.
+    [[nodiscard]] size_t misc_count() const
+    {
+      return std::max(last_nonzero(misc_stats), extra_count(MISC));
+    }
+
+  private:
+    //! One past the last counter that is not zero.
+    template<size_t N>
+    [[nodiscard]] static size_t last_nonzero(const std::array<int64_t, N> &counters)
+    {
+      size_t count = N;
+      while (count > 0 && counters[count - 1] == 0)
+        {
+          count--;
+        }
+      return count;
+    }
+
+    //! One past the last unknown counter of a break that is not zero.
+    [[nodiscard]] size_t extra_count(size_t break_id) const
+    {
+      size_t count = 0;
+      for (const ExtraCounter &extra: extra_counters)
+        {
+          if (extra.break_id == break_id && extra.value != 0)
+            {
+              count = std::max(count, extra.counter + 1);
+            }
+        }
+      return count;
+    }
+
+    [[nodiscard]] int64_t get_extra(size_t break_id, size_t counter) const
+    {
+      const auto it = find_extra(break_id, counter);
+      return (it != extra_counters.end() && it->break_id == break_id && it->counter == counter) ? it->value : 0;
+    }
+
+    void set_extra(size_t break_id, size_t counter, int64_t value)
+    {
+      const auto it = find_extra(break_id, counter);
+      if (it != extra_counters.end() && it->break_id == break_id && it->counter == counter)
+        {
+          it->value = value;
+          return;
+        }
+      extra_counters.insert(it, ExtraCounter{break_id, counter, value});
+    }
+
+    [[nodiscard]] std::vector<ExtraCounter>::const_iterator find_extra(size_t break_id, size_t counter) const
+    {
+      return std::lower_bound(extra_counters.begin(),
+                              extra_counters.end(),
+                              std::pair{break_id, counter},
+                              [](const ExtraCounter &extra, const std::pair<size_t, size_t> &key) {
+                                return std::pair{extra.break_id, extra.counter} < key;
+                              });
+    }
+
+    [[nodiscard]] std::vector<ExtraCounter>::iterator find_extra(size_t break_id, size_t counter)
+    {
+      const auto it = std::as_const(*this).find_extra(break_id, counter);
+      return extra_counters.begin() + (it - extra_counters.cbegin());
+    }
+  };
+
+  //! The statistics of a range of days, as one dense column per counter.
+  /*!
+   *  Every column runs parallel to dates: column[i] belongs to dates[i]. A
+   *  counter that a day does not have reads as zero on that day.
+   */
+  struct DailyStatsColumns
+  {
+    //! The days in the range that have statistics, oldest first.
+    std::vector<Date> dates;
+
+    //! Per break columns, indexed by break id and then by counter.
+    std::vector<std::vector<std::vector<int64_t>>> break_stats;
+
+    //! Miscellaneous columns, indexed by counter.
+    std::vector<std::vector<int64_t>> misc_stats;
+
+    //! Adds a day after the last one, with all of its counters at zero. Returns its index.
+    size_t add_date(const Date &date)
+    {
+      dates.push_back(date);
+      for (auto &counters: break_stats)
+        {
+          for (auto &column: counters)
+            {
+              column.push_back(0);
+            }
+        }
+      for (auto &column: misc_stats)
+        {
+          column.push_back(0);
+        }
+      return dates.size() - 1;
+    }
+
+    void set_break(size_t index, size_t break_id, size_t counter, int64_t value)
+    {
+      if (break_id >= break_stats.size())
+        {
+          break_stats.resize(break_id + 1);
+        }
+      auto &counters = break_stats[break_id];
+      if (counter >= counters.size())
+        {
+          counters.resize(counter + 1, std::vector<int64_t>(dates.size(), 0));
+        }
+      counters[counter][index] = value;
+    }
+
+    void set_misc(size_t index, size_t counter, int64_t value)
+    {
+      if (counter >= misc_stats.size())
+        {
+          misc_stats.resize(counter + 1, std::vector<int64_t>(dates.size(), 0));
+        }
+      misc_stats[counter][index] = value;
+    }
+
+    //! Adds a whole day after the last one.
+    void add_record(const DailyStatsRecord &record)
+    {
+      const size_t index = add_date(record.date());
+      for (size_t break_id = 0; break_id < record.break_count(); break_id++)
+        {
+          for (size_t counter = 0; counter < record.counter_count(break_id); counter++)
+            {
+              set_break(index, break_id, counter, record.get_break(break_id, counter));
+            }
+        }
+      for (size_t counter = 0; counter < record.misc_count(); counter++)
+        {
+          set_misc(index, counter, record.get_misc(counter));
+        }
+    }
   };
 } // namespace workrave::stats
 
@@ -17,9 +17,13 @@
 
 #include "FileStatisticsStore.hh"
 
+#include <algorithm>
+#include <charconv>
+#include <ctime>
 #include <fstream>
-#include <sstream>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <utility>
 
 #include <spdlog/spdlog.h>
@@ -35,158 +39,280 @@ namespace
   const int MAX_BREAKS = 64;
   const int MAX_COUNTERS = 256;
 
+  //! The text files are read in chunks of this size, however large they are.
+  const size_t CHUNK_SIZE = 64 * 1024;
+
+  //! No valid record comes close to this; longer lines are skipped.
+  const size_t MAX_LINE_LENGTH = 64 * 1024;
+
 } // namespace
 
 namespace workrave::stats
 {
-  FileStatisticsStore::FileStatisticsStore(std::filesystem::path state_directory)
-    : state_directory(std::move(state_directory))
+  namespace
   {
-  }
+    //! Splits a file into lines, reading it one chunk at a time.
+    class LineReader
+    {
+    public:
+      explicit LineReader(const std::filesystem::path &path)
+        : file(path, std::ios::binary)
+        , chunk(CHUNK_SIZE)
+      {
+      }
 
-  std::filesystem::path FileStatisticsStore::today_path() const
-  {
-    return state_directory / "todaystats";
-  }
+      //! Returns the next line, without its newline. It is valid until the next call.
+      bool next(std::string_view &line)
+      {
+        long_line.clear();
 
-  std::filesystem::path FileStatisticsStore::history_path() const
-  {
-    return state_directory / "historystats";
-  }
+        while (true)
+          {
+            const char *begin = chunk.data() + pos;
+            const char *end = chunk.data() + size;
+            const char *newline = std::find(begin, end, '\n');
 
-  std::optional<DailyStatsRecord> FileStatisticsStore::load_today()
-  {
-    std::vector<DailyStatsRecord> records = load(today_path(), false);
-    if (records.empty())
-      {
-        return std::nullopt;
+            if (newline != end)
+              {
+                pos = newline - chunk.data() + 1;
+
+                // The common case: the whole line is in the current chunk.
+                if (long_line.empty() && !skipping)
+                  {
+                    line = std::string_view(begin, newline - begin);
+                    return true;
+                  }
+
+                append(begin, newline);
+                if (skipping)
+                  {
+                    skipping = false;
+                    continue;
+                  }
+
+                line = long_line;
+                return true;
+              }
+
+            // The line continues in the next chunk.
+            append(begin, end);
+            pos = 0;
+
+            file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+            size = static_cast<size_t>(file.gcount());
+            if (size == 0)
+              {
+                // A last line without a newline.
+                line = long_line;
+                return !long_line.empty() && !skipping;
+              }
+          }
       }
-    return records.front();
-  }
 
-  std::vector<DailyStatsRecord> FileStatisticsStore::load_history()
-  {
-    return load(history_path(), true);
-  }
+    private:
+      void append(const char *begin, const char *end)
+      {
+        if (skipping)
+          {
+            return;
+          }
 
-  //! Verifies the "WorkRaveStats <version>" header and consumes it.
-  bool FileStatisticsStore::read_header(std::istream &file)
-  {
-    if (!file.good())
+        if (long_line.size() + (end - begin) > MAX_LINE_LENGTH)
+          {
+            spdlog::warn("ignoring overlong line in statistics");
+            long_line.clear();
+            skipping = true;
+            return;
+          }
+
+        long_line.append(begin, end);
+      }
+
+    private:
+      std::ifstream file;
+      std::vector<char> chunk;
+      size_t pos{0};
+      size_t size{0};
+
+      //! A line that spans chunks, copied together.
+      std::string long_line;
+      bool skipping{false};
+    };
+
+    //! The whitespace separated numbers of a record.
+    /*!
+     *  Extracts them the way an istream would, a failed extraction yielding 0
+     *  and failing every extraction after it, but without the cost of one.
+     */
+    class Fields
+    {
+    public:
+      explicit Fields(std::string_view text)
+        : text(text)
       {
-        return false;
       }
 
-    std::string tag;
-    file >> tag;
-    if (tag != WORKRAVESTATS)
+      template<typename T>
+      Fields &operator>>(T &value)
       {
-        return false;
+        value = 0;
+        if (failed)
+          {
+            return *this;
+          }
+
+        const size_t start = text.find_first_not_of(" \t\r");
+        if (start == std::string_view::npos)
+          {
+            failed = true;
+            return *this;
+          }
+        text.remove_prefix(start);
+
+        const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc{})
+          {
+            value = 0;
+            failed = true;
+            return *this;
+          }
+        text.remove_prefix(end - text.data());
+
+        return *this;
       }
 
-    int version = 0;
-    file >> version;
+    private:
+      std::string_view text;
+      bool failed{false};
+    };
 
-    return (version == STATSVERSION) || (version == 3);
-  }
+    //! Checks the "WorkRaveStats <version>" header.
+    bool is_header(std::string_view line)
+    {
+      const std::string_view tag{WORKRAVESTATS};
+      if (line.substr(0, tag.size()) != tag)
+        {
+          return false;
+        }
 
-  //! Parses a 'D' record, the start and stop time that opens each day.
-  DailyStatsRecord FileStatisticsStore::parse_day(std::istream &args)
-  {
-    std::tm start{};
-    std::tm stop{};
+      int version = 0;
+      Fields(line.substr(tag.size())) >> version;
 
-    args >> start.tm_mday >> start.tm_mon >> start.tm_year >> start.tm_hour >> start.tm_min >> stop.tm_mday >> stop.tm_mon
-      >> stop.tm_year >> stop.tm_hour >> stop.tm_min;
+      return (version == STATSVERSION) || (version == 3);
+    }
 
-    DailyStatsRecord record;
-    record.start = to_local_time(start);
-    record.stop = to_local_time(stop);
+    //! Parses a 'D' record, the start and stop time that opens each day.
+    DailyStatsRecord parse_day(Fields &args)
+    {
+      std::tm start{};
+      std::tm stop{};
 
-    return record;
-  }
+      args >> start.tm_mday >> start.tm_mon >> start.tm_year >> start.tm_hour >> start.tm_min >> stop.tm_mday >> stop.tm_mon
+        >> stop.tm_year >> stop.tm_hour >> stop.tm_min;
 
-  //! Parses a 'B' record, the counters of a single break.
-  void FileStatisticsStore::parse_break(std::istream &args, DailyStatsRecord &record)
-  {
-    int break_id = 0;
-    int size = 0;
-    args >> break_id >> size;
+      DailyStatsRecord record;
+      record.start = to_local_time(start);
+      record.stop = to_local_time(stop);
 
-    if (break_id < 0 || break_id >= MAX_BREAKS || size < 0 || size > MAX_COUNTERS)
-      {
-        spdlog::warn("ignoring malformed break statistics");
-        return;
-      }
+      return record;
+    }
 
-    if (static_cast<size_t>(break_id) >= record.break_stats.size())
-      {
-        record.break_stats.resize(break_id + 1);
-      }
+    //! Parses a 'B' record, the counters of a single break.
+    void parse_break(Fields &args, DailyStatsRecord &record)
+    {
+      int break_id = 0;
+      int size = 0;
+      args >> break_id >> size;
+
+      if (break_id < 0 || break_id >= MAX_BREAKS || size < 0 || size > MAX_COUNTERS)
+        {
+          spdlog::warn("ignoring malformed break statistics");
+          return;
+        }
 
-    std::vector<int64_t> &break_stats = record.break_stats[break_id];
-    break_stats.assign(size, 0);
+      for (int i = 0; i < size; i++)
+        {
+          int64_t value = 0;
+          args >> value;
+          record.set_break(break_id, i, value);
+        }
+    }
 
-    for (int i = 0; i < size; i++)
-      {
-        args >> break_stats[i];
-      }
-  }
+    //! Parses an 'm' record, or the broken 'M' record that preceded it.
+    void parse_misc(Fields &args, DailyStatsRecord &record, bool valid)
+    {
+      int size = 0;
+      args >> size;
 
-  //! Parses an 'm' record, or the broken 'M' record that preceded it.
-  void FileStatisticsStore::parse_misc(std::istream &args, DailyStatsRecord &record, bool valid)
-  {
-    int size = 0;
-    args >> size;
+      if (size < 0 || size > MAX_COUNTERS)
+        {
+          spdlog::warn("ignoring malformed statistics");
+          return;
+        }
 
-    if (size < 0 || size > MAX_COUNTERS)
-      {
-        spdlog::warn("ignoring malformed statistics");
-        return;
-      }
+      for (int i = 0; i < size; i++)
+        {
+          int64_t value = 0;
+          args >> value;
 
-    if (static_cast<size_t>(size) > record.misc_stats.size())
-      {
-        record.misc_stats.resize(size, 0);
-      }
+          // Ignore older 'M' stats, they are broken....
+          record.set_misc(i, valid ? value : 0);
+        }
+    }
 
-    for (int i = 0; i < size; i++)
-      {
-        int64_t value = 0;
-        args >> value;
+    //! Parses a legacy 'G' record, holding only the total active time.
+    void parse_total_active(Fields &args, DailyStatsRecord &record)
+    {
+      int64_t total_active = 0;
+      args >> total_active;
 
-        // Ignore older 'M' stats, they are broken....
-        record.misc_stats[i] = valid ? value : 0;
-      }
+      record.set_misc(STATS_VALUE_TOTAL_ACTIVE_TIME, total_active);
+    }
+  } // namespace
+
+  FileStatisticsStore::FileStatisticsStore(std::filesystem::path state_directory)
+    : state_directory(std::move(state_directory))
+  {
   }
 
-  //! Parses a legacy 'G' record, holding only the total active time.
-  void FileStatisticsStore::parse_total_active(std::istream &args, DailyStatsRecord &record)
+  std::filesystem::path FileStatisticsStore::today_path() const
   {
-    int64_t total_active = 0;
-    args >> total_active;
+    return state_directory / "todaystats";
+  }
+
+  std::filesystem::path FileStatisticsStore::history_path() const
+  {
+    return state_directory / "historystats";
+  }
 
-    if (record.misc_stats.size() <= STATS_VALUE_TOTAL_ACTIVE_TIME)
+  std::optional<DailyStatsRecord> FileStatisticsStore::load_today()
+  {
+    std::vector<DailyStatsRecord> records = load(today_path(), false);
+    if (records.empty())
       {
-        record.misc_stats.resize(STATS_VALUE_TOTAL_ACTIVE_TIME + 1, 0);
+        return std::nullopt;
       }
-    record.misc_stats[STATS_VALUE_TOTAL_ACTIVE_TIME] = total_active;
+    return records.front();
   }
 
-  //! Loads days from the specified file.
-  std::vector<DailyStatsRecord> FileStatisticsStore::load(const std::filesystem::path &path, bool history) const
+  std::vector<DailyStatsRecord> FileStatisticsStore::load_history()
   {
-    std::vector<DailyStatsRecord> records;
+    return load(history_path(), true);
+  }
 
-    std::ifstream file(path.string());
+  //! Reads days from the specified file, handing them over one at a time.
+  bool FileStatisticsStore::read(const std::filesystem::path &path, bool history, const DayCallback &callback) const
+  {
+    LineReader reader(path);
 
-    if (!read_header(file))
+    std::string_view line;
+    if (!reader.next(line) || !is_header(line))
       {
-        return records;
+        return true;
       }
 
-    std::string line;
-    while (std::getline(file, line))
+    std::optional<DailyStatsRecord> record;
+    while (reader.next(line))
       {
         if (line.length() <= 1)
           {
@@ -194,40 +320,64 @@ namespace workrave::stats
           }
 
         const char cmd = line[0];
-        std::istringstream args(line.substr(1));
+        Fields args(line.substr(1));
 
         if (cmd == 'D')
           {
-            if (!history && !records.empty())
+            if (record.has_value())
               {
-                // Corrupt today stats.
-                break;
+                if (!history)
+                  {
+                    // Corrupt today stats.
+                    break;
+                  }
+
+                if (!callback(std::move(record.value())))
+                  {
+                    return false;
+                  }
               }
 
-            records.push_back(parse_day(args));
+            record = parse_day(args);
           }
-        else if (!records.empty())
+        else if (record.has_value())
           {
-            DailyStatsRecord &record = records.back();
-
             if (cmd == 'B')
               {
-                parse_break(args, record);
+                parse_break(args, record.value());
               }
             else if (cmd == 'M' || cmd == 'm')
               {
-                parse_misc(args, record, cmd == 'm');
+                parse_misc(args, record.value(), cmd == 'm');
               }
             else if (cmd == 'G')
               {
-                parse_total_active(args, record);
+                parse_total_active(args, record.value());
               }
           }
       }
 
+    return !record.has_value() || callback(std::move(record.value()));
+  }
+
+  //! Loads all days from the specified file.
+  std::vector<DailyStatsRecord> FileStatisticsStore::load(const std::filesystem::path &path, bool history) const
+  {
+    std::vector<DailyStatsRecord> records;
+
+    (void)read(path, history, [&records](DailyStatsRecord &&record) {
+      records.push_back(std::move(record));
+      return true;
+    });
+
     return records;
   }
 
+  bool FileStatisticsStore::read_history(const DayCallback &callback) const
+  {
+    return read(history_path(), true, callback);
+  }
+
   //! Writes the fields of a local time as the 'D' record stores them.
   void FileStatisticsStore::write_time(std::ostream &file, LocalTime time)
   {
@@ -247,22 +397,28 @@ namespace workrave::stats
     write_time(file, record.stop);
     file << std::endl;
 
-    for (size_t i = 0; i < record.break_stats.size(); i++)
+    const size_t breaks = record.break_count();
+    for (size_t i = 0; i < breaks; i++)
       {
-        const std::vector<int64_t> &break_stats = record.break_stats[i];
+        const size_t counters = record.counter_count(i);
+        if (counters == 0)
+          {
+            continue;
+          }
 
-        file << "B " << i << " " << break_stats.size() << " ";
-        for (int64_t value: break_stats)
+        file << "B " << i << " " << counters << " ";
+        for (size_t counter = 0; counter < counters; counter++)
           {
-            file << value << " ";
+            file << record.get_break(i, counter) << " ";
           }
         file << std::endl;
       }
 
-    file << "m " << record.misc_stats.size() << " ";
-    for (int64_t value: record.misc_stats)
+    const size_t counters = record.misc_count();
+    file << "m " << counters << " ";
+    for (size_t counter = 0; counter < counters; counter++)
       {
-        file << value << " ";
+        file << record.get_misc(counter) << " ";
       }
     file << std::endl;
   }
@@ -420,15 +576,30 @@ namespace workrave::stats
 
     for (const auto &[date, record]: load_all())
       {
-        if (date >= from && date <= to && static_cast<size_t>(counter) < record.misc_stats.size())
+        if (date >= from && date <= to && counter >= 0)
           {
-            total += record.misc_stats[counter];
+            total += record.get_misc(counter);
           }
       }
 
     return total;
   }
 
+  DailyStatsColumns FileStatisticsStore::load_range(const Date &from, const Date &to)
+  {
+    DailyStatsColumns columns;
+
+    for (const auto &[date, record]: load_all())
+      {
+        if (date >= from && date <= to)
+          {
+            columns.add_record(record);
+          }
+      }
+
+    return columns;
+  }
+
   bool FileStatisticsStore::delete_all()
   {
     bool ok = true;
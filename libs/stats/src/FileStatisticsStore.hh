@@ -19,6 +19,7 @@
 #define WORKRAVE_LIBS_STATS_FILESTATISTICSSTORE_HH
 
 #include <filesystem>
+#include <functional>
 #include <iosfwd>
 #include <map>
 #include <optional>
@@ -37,10 +38,17 @@ namespace workrave::stats
   class FileStatisticsStore
   {
   public:
+    //! Receives the days of a file one at a time, in file order. Returning false stops the read.
+    using DayCallback = std::function<bool(DailyStatsRecord &&record)>;
+
     explicit FileStatisticsStore(std::filesystem::path state_directory);
 
     [[nodiscard]] std::optional<DailyStatsRecord> load_today();
     [[nodiscard]] std::vector<DailyStatsRecord> load_history();
+
+    //! Streams the history, holding no more than a single day in memory. False if the callback stopped it.
+    bool read_history(const DayCallback &callback) const;
+
     void save_today(const DailyStatsRecord &record);
     void append_history(const DailyStatsRecord &record);
     bool delete_all();
@@ -52,6 +60,7 @@ namespace workrave::stats
     [[nodiscard]] std::optional<Date> get_first_date();
     [[nodiscard]] std::optional<Date> get_last_date();
     [[nodiscard]] int64_t get_total_misc(int counter, const Date &from, const Date &to);
+    [[nodiscard]] DailyStatsColumns load_range(const Date &from, const Date &to);
 
   private:
     [[nodiscard]] std::map<Date, DailyStatsRecord> load_all();
@@ -59,13 +68,9 @@ namespace workrave::stats
     [[nodiscard]] std::filesystem::path today_path() const;
     [[nodiscard]] std::filesystem::path history_path() const;
 
+    bool read(const std::filesystem::path &path, bool history, const DayCallback &callback) const;
     [[nodiscard]] std::vector<DailyStatsRecord> load(const std::filesystem::path &path, bool history) const;
 
-    static bool read_header(std::istream &file);
-    static DailyStatsRecord parse_day(std::istream &args);
-    static void parse_break(std::istream &args, DailyStatsRecord &record);
-    static void parse_misc(std::istream &args, DailyStatsRecord &record, bool valid);
-    static void parse_total_active(std::istream &args, DailyStatsRecord &record);
     static void write_time(std::ostream &file, LocalTime time);
     static void write_day(std::ostream &file, const DailyStatsRecord &record);
 
@@ -46,9 +46,13 @@ namespace workrave::stats
     //! Stores the statistics of the day currently in progress.
     virtual void save_today(const DailyStatsRecord &record) = 0;
 
-    //! Sets a single break counter of the day in progress to an absolute value, immediately and durably.
+    //! Sets a single break counter of the day in progress to an absolute value.
+    //! The store may defer writing it for a short while, but reads always see it.
     virtual void set_break_counter(workrave::BreakId break_id, int counter, int64_t value) = 0;
 
+    //! Writes break counter updates that are still deferred right away.
+    virtual void flush() = 0;
+
     //! Archives a completed day.
     virtual void append_history(const DailyStatsRecord &record) = 0;
 
@@ -75,6 +79,9 @@ namespace workrave::stats
 
     //! The sum of one of the miscellaneous counters over the inclusive date range.
     [[nodiscard]] virtual int64_t get_total_misc(int counter, const Date &from, const Date &to) = 0;
+
+    //! The counters of every day in the inclusive date range, today included, in one go.
+    [[nodiscard]] virtual DailyStatsColumns load_range(const Date &from, const Date &to) = 0;
   };
 
   class StatisticsStoreFactory
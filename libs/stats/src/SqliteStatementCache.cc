@@ -0,0 +1,101 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include "SqliteStatementCache.hh"
+
+#include <spdlog/spdlog.h>
+
+namespace workrave::stats
+{
+  SqliteStatementCache::~SqliteStatementCache()
+  {
+    for (auto &[sql, entry]: entries)
+      {
+        sqlite3_finalize(entry.stmt);
+      }
+  }
+
+  sqlite3_stmt *
+  SqliteStatementCache::acquire(sqlite3 *db, const char *sql)
+  {
+    auto it = entries.find(std::string_view{sql});
+    if (it != entries.end() && !it->second.in_use)
+      {
+        it->second.in_use = true;
+        return it->second.stmt;
+      }
+
+    sqlite3_stmt *stmt = nullptr;
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK)
+      {
+        spdlog::error("failed to prepare statistics query: {}", sqlite3_errmsg(db));
+        sqlite3_finalize(stmt);
+        return nullptr;
+      }
+    prepare_count++;
+
+    // Already lent out: the copy is the caller's alone, and is finalized on release.
+    if (it == entries.end())
+      {
+        entries.emplace(sql, Entry{stmt, true});
+      }
+    return stmt;
+  }
+
+  void
+  SqliteStatementCache::release(sqlite3_stmt *stmt)
+  {
+    if (stmt == nullptr)
+      {
+        return;
+      }
+
+    auto it = entries.find(std::string_view{sqlite3_sql(stmt)});
+    if (it == entries.end() || it->second.stmt != stmt)
+      {
+        sqlite3_finalize(stmt);
+        if (it != entries.end() && it->second.stmt == nullptr)
+          {
+            // Cleared while lent out.
+            entries.erase(it);
+          }
+        return;
+      }
+
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    it->second.in_use = false;
+  }
+
+  void
+  SqliteStatementCache::clear()
+  {
+    for (auto it = entries.begin(); it != entries.end();)
+      {
+        if (it->second.in_use)
+          {
+            // Dropped from the cache, and so finalized, when it comes back.
+            it->second.stmt = nullptr;
+            ++it;
+            continue;
+          }
+
+        sqlite3_finalize(it->second.stmt);
+        it = entries.erase(it);
+      }
+  }
+} // namespace workrave::stats
@@ -0,0 +1,76 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef WORKRAVE_LIBS_STATS_SQLITESTATEMENTCACHE_HH
+#define WORKRAVE_LIBS_STATS_SQLITESTATEMENTCACHE_HH
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
+#include <sqlite3.h>
+
+namespace workrave::stats
+{
+  //! The prepared statements of a single database connection, keyed by their SQL text.
+  /*!
+   *  Preparing a statement costs far more than running one of the small
+   *  queries the statistics store uses, so each is prepared once and then
+   *  reset and reused. A statement is lent out to one user at a time: asking
+   *  for one that is still lent out prepares a fresh, uncached copy instead.
+   */
+  class SqliteStatementCache
+  {
+  public:
+    SqliteStatementCache() = default;
+    ~SqliteStatementCache();
+
+    SqliteStatementCache(const SqliteStatementCache &) = delete;
+    SqliteStatementCache &operator=(const SqliteStatementCache &) = delete;
+    SqliteStatementCache(SqliteStatementCache &&) = delete;
+    SqliteStatementCache &operator=(SqliteStatementCache &&) = delete;
+
+    //! Lends out the statement for the given SQL, preparing it if needed. Returns nullptr on error.
+    [[nodiscard]] sqlite3_stmt *acquire(sqlite3 *db, const char *sql);
+
+    //! Takes a statement back, resetting it and clearing its bindings for the next user.
+    void release(sqlite3_stmt *stmt);
+
+    //! Finalizes every cached statement, e.g. after the schema changed.
+    void clear();
+
+    //! How many statements were prepared, as opposed to reused.
+    [[nodiscard]] int64_t get_prepare_count() const
+    {
+      return prepare_count;
+    }
+
+  private:
+    struct Entry
+    {
+      sqlite3_stmt *stmt{nullptr};
+      bool in_use{false};
+    };
+
+    std::map<std::string, Entry, std::less<>> entries;
+    int64_t prepare_count{0};
+  };
+} // namespace workrave::stats
+
+#endif // WORKRAVE_LIBS_STATS_SQLITESTATEMENTCACHE_HH
@@ -17,17 +17,24 @@
 
 #include "SqliteStatisticsStore.hh"
 
+#include <charconv>
+#include <initializer_list>
 #include <iomanip>
 #include <sstream>
+#include <string_view>
 #include <utility>
 
 #include <spdlog/spdlog.h>
 
 #include "FileStatisticsStore.hh"
+#include "SqliteStatementCache.hh"
 
 namespace
 {
-  const int SCHEMA_VERSION = 1;
+  //! 1: days and their counters.
+  //! 2: adds the stats_misc_week and stats_misc_month rollups.
+  //! 3: keeps the rollups up to date with triggers, also for days written by an older Workrave.
+  const int SCHEMA_VERSION = 3;
 
   const char *const PROPERTY_SCHEMA_VERSION = "schema_version";
   const char *const PROPERTY_TODAY = "today";
@@ -38,6 +45,9 @@ namespace
   const char *const PROPERTY_IMPORTED_HISTORY_MTIME = "imported_historystats_mtime";
   const char *const PROPERTY_IMPORTED_TODAY_MTIME = "imported_todaystats_mtime";
 
+  //! The number of days imported from historystats per transaction.
+  const size_t IMPORT_BATCH_SIZE = 256;
+
   //! The mtime of a file, in raw file_clock ticks, or nullopt if it does not
   //! exist. file_clock's epoch is not guaranteed to align with any other
   //! clock, so ticks can legitimately be negative: they may only be compared
@@ -54,6 +64,103 @@ namespace
     return time.time_since_epoch().count();
   }
 
+  //! Joins pieces of SQL into a single statement.
+  std::string
+  join_sql(std::initializer_list<std::string_view> pieces)
+  {
+    std::string sql;
+    for (std::string_view piece: pieces)
+      {
+        sql += piece;
+      }
+    return sql;
+  }
+
+  //! The rollup keys of a day in SQL: the Monday that starts its ISO week, and its 'YYYY-MM' month.
+  std::string
+  week_of(std::string_view day)
+  {
+    return join_sql({"date(", day, ", '-' || ((CAST(strftime('%w', ", day, ") AS INTEGER) + 6) % 7) || ' days')"});
+  }
+
+  std::string
+  month_of(std::string_view day)
+  {
+    return join_sql({"substr(", day, ", 1, 7)"});
+  }
+
+  //! Adds a row of stats_misc, OLD or NEW in a trigger, to both rollups, or
+  //! takes it out again with a sign of '-'.
+  std::string
+  add_to_rollups(std::string_view row, std::string_view sign)
+  {
+    const std::string day = join_sql({row, ".day"});
+    return join_sql({"INSERT INTO stats_misc_week (week, counter, value) VALUES (",
+                     week_of(day),
+                     ", ",
+                     row,
+                     ".counter, ",
+                     sign,
+                     row,
+                     ".value)"
+                     " ON CONFLICT (week, counter) DO UPDATE SET value = value + excluded.value;"
+                     "INSERT INTO stats_misc_month (month, counter, value) VALUES (",
+                     month_of(day),
+                     ", ",
+                     row,
+                     ".counter, ",
+                     sign,
+                     row,
+                     ".value)"
+                     " ON CONFLICT (month, counter) DO UPDATE SET value = value + excluded.value;"});
+  }
+
+  //! Keeps the rollups in step with every change to stats_misc. Being part of
+  //! the database, they also count the days that an older Workrave, which
+  //! knows nothing of the rollups, writes after a downgrade.
+  const std::string ROLLUP_TRIGGERS_SQL = join_sql({"CREATE TRIGGER IF NOT EXISTS stats_misc_insert AFTER INSERT ON stats_misc BEGIN ",
+                                                    add_to_rollups("NEW", ""),
+                                                    "END;"
+                                                    "CREATE TRIGGER IF NOT EXISTS stats_misc_delete AFTER DELETE ON stats_misc BEGIN ",
+                                                    add_to_rollups("OLD", "-"),
+                                                    "END;"
+                                                    "CREATE TRIGGER IF NOT EXISTS stats_misc_update AFTER UPDATE ON stats_misc BEGIN ",
+                                                    add_to_rollups("OLD", "-"),
+                                                    add_to_rollups("NEW", ""),
+                                                    "END;"});
+
+  //! Recomputes both rollups from scratch.
+  const std::string REBUILD_ROLLUPS_SQL = join_sql({"DELETE FROM stats_misc_week;"
+                                                    "DELETE FROM stats_misc_month;"
+                                                    "INSERT INTO stats_misc_week (week, counter, value)"
+                                                    " SELECT ",
+                                                    week_of("day"),
+                                                    ", counter, SUM(value) FROM stats_misc GROUP BY 1, 2;"
+                                                    "INSERT INTO stats_misc_month (month, counter, value)"
+                                                    " SELECT ",
+                                                    month_of("day"),
+                                                    ", counter, SUM(value) FROM stats_misc GROUP BY 1, 2;"});
+
+  //! Reads back an integer property. Anything that is not entirely a number is nullopt.
+  std::optional<int64_t>
+  to_integer(const std::optional<std::string> &text)
+  {
+    if (!text.has_value())
+      {
+        return std::nullopt;
+      }
+
+    int64_t value = 0;
+    const char *first = text->data();
+    const char *last = first + text->size();
+    const auto [end, ec] = std::from_chars(first, last, value);
+    if (ec != std::errc{} || end != last)
+      {
+        return std::nullopt;
+      }
+    return value;
+  }
+
   //! Formats a calendar date as 'YYYY-MM-DD', which sorts chronologically.
   std::string
   to_day(const workrave::stats::Date &date)
@@ -89,22 +196,19 @@ namespace
     return std::chrono::year{year} / month / mday;
   }
 
-  //! Minimal owner of a prepared statement.
+  //! Borrows a prepared statement from the cache for as long as it is in scope.
   class Statement
   {
   public:
-    Statement(sqlite3 *db, const char *sql)
+    Statement(workrave::stats::SqliteStatementCache &cache, sqlite3 *db, const char *sql)
+      : cache(cache)
+      , stmt(cache.acquire(db, sql))
     {
-      if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK)
-        {
-          spdlog::error("failed to prepare statistics query: {}", sqlite3_errmsg(db));
-          stmt = nullptr;
-        }
     }
 
     ~Statement()
     {
-      sqlite3_finalize(stmt);
+      cache.release(stmt);
     }
 
     Statement(const Statement &) = delete;
@@ -146,6 +250,11 @@ namespace
       return sqlite3_column_int64(stmt, index);
     }
 
+    [[nodiscard]] bool column_is_null(int index) const
+    {
+      return sqlite3_column_type(stmt, index) == SQLITE_NULL;
+    }
+
     [[nodiscard]] std::string column_text(int index) const
     {
       const auto *text = sqlite3_column_text(stmt, index);
@@ -153,6 +262,7 @@ namespace
     }
 
   private:
+    workrave::stats::SqliteStatementCache &cache;
     sqlite3_stmt *stmt{nullptr};
   };
 
@@ -202,13 +312,17 @@ namespace
 
 namespace workrave::stats
 {
-  SqliteStatisticsStore::SqliteStatisticsStore(std::filesystem::path state_directory)
+  SqliteStatisticsStore::SqliteStatisticsStore(std::filesystem::path state_directory, std::chrono::milliseconds flush_window)
     : state_directory(std::move(state_directory))
+    , flush_window(flush_window)
   {
   }
 
   SqliteStatisticsStore::~SqliteStatisticsStore()
   {
+    // Drains whatever is still queued while the database is still open.
+    writer.reset();
+    statements.clear();
     sqlite3_close(db);
   }
 
@@ -242,14 +356,49 @@ namespace workrave::stats
     execute("PRAGMA journal_mode = WAL");
     execute("PRAGMA synchronous = NORMAL");
 
-    if (!create_schema())
+    const bool schema_ok = create_schema();
+
+    // The statements prepared so far may predate the schema change.
+    statements.clear();
+
+    if (!schema_ok)
       {
         sqlite3_close(db);
         db = nullptr;
         return false;
       }
 
-    return import_text_statistics();
+    if (!import_text_statistics())
+      {
+        return false;
+      }
+
+    writer = std::make_unique<BreakCounterWriter>(
+      [this](const std::vector<BreakCounterWriter::Update> &updates) { return write_break_counters(updates); },
+      flush_window);
+    return true;
+  }
+
+  void
+  SqliteStatisticsStore::flush()
+  {
+    if (writer)
+      {
+        writer->flush();
+      }
+  }
+
+  int64_t
+  SqliteStatisticsStore::get_merged_write_count() const
+  {
+    return writer ? writer->get_merged_count() : 0;
+  }
+
+  int64_t
+  SqliteStatisticsStore::get_prepare_count() const
+  {
+    std::scoped_lock lock(mutex);
+    return statements.get_prepare_count();
   }
 
   bool
@@ -288,18 +437,48 @@ namespace workrave::stats
                             "  day     TEXT    NOT NULL REFERENCES stats_day(day) ON DELETE CASCADE,"
                             "  counter INTEGER NOT NULL,"
                             "  value   INTEGER NOT NULL,"
-                            "  PRIMARY KEY (day, counter)) WITHOUT ROWID;");
-    if (!ok)
+                            "  PRIMARY KEY (day, counter)) WITHOUT ROWID;"
+                            // The sums of stats_misc per ISO week, named by its Monday as
+                            // 'YYYY-MM-DD', and per 'YYYY-MM' month, kept up to date by
+                            // triggers, so that totals over long ranges need not visit
+                            // every day.
+                            "CREATE TABLE IF NOT EXISTS stats_misc_week ("
+                            "  week    TEXT    NOT NULL,"
+                            "  counter INTEGER NOT NULL,"
+                            "  value   INTEGER NOT NULL,"
+                            "  PRIMARY KEY (week, counter)) WITHOUT ROWID;"
+                            "CREATE TABLE IF NOT EXISTS stats_misc_month ("
+                            "  month   TEXT    NOT NULL,"
+                            "  counter INTEGER NOT NULL,"
+                            "  value   INTEGER NOT NULL,"
+                            "  PRIMARY KEY (month, counter)) WITHOUT ROWID;");
+    if (!ok || !execute(ROLLUP_TRIGGERS_SQL.c_str()))
       {
         return false;
       }
 
-    if (!get_property(PROPERTY_SCHEMA_VERSION).has_value())
+    // A version that cannot be read is treated like one from before the
+    // rollups, which rebuilds them and writes the version out again.
+    const int64_t version = to_integer(get_property(PROPERTY_SCHEMA_VERSION)).value_or(0);
+    if (version >= SCHEMA_VERSION)
       {
-        return set_property(PROPERTY_SCHEMA_VERSION, std::to_string(SCHEMA_VERSION));
+        return true;
       }
 
-    return true;
+    // A new database, or one written before the triggers kept the rollups,
+    // which an older Workrave may have added days to since.
+    Transaction transaction(db);
+    if (!transaction)
+      {
+        return false;
+      }
+
+    if (!execute(REBUILD_ROLLUPS_SQL.c_str()) || !set_property(PROPERTY_SCHEMA_VERSION, std::to_string(SCHEMA_VERSION)))
+      {
+        return false;
+      }
+
+    return transaction.commit();
   }
 
   //! Imports the statistics of a Workrave that still used the text format.
@@ -336,8 +515,8 @@ namespace workrave::stats
         {
           return false;
         }
-      const std::optional<std::string> stored = get_property(property);
-      return !stored.has_value() || std::stoll(stored.value()) != current.value();
+      const std::optional<int64_t> stored = to_integer(get_property(property));
+      return !stored.has_value() || stored.value() != current.value();
     };
 
     if (!changed(PROPERTY_IMPORTED_HISTORY_MTIME, history_mtime) && !changed(PROPERTY_IMPORTED_TODAY_MTIME, today_mtime))
@@ -346,34 +525,65 @@ namespace workrave::stats
       }
 
     FileStatisticsStore text_store(state_directory);
-    const std::vector<DailyStatsRecord> history = text_store.load_history();
-    const std::optional<DailyStatsRecord> today = text_store.load_today();
+    size_t imported = 0;
 
-    {
-      Transaction transaction(db);
-      if (!transaction)
-        {
-          return false;
-        }
+    // The history is streamed in, a batch of days per transaction, so that
+    // neither memory nor the journal grows with the size of the file. Should
+    // the import fail halfway, the mtimes are not recorded and the next
+    // open() picks up where this one left off, skipping the days already in.
+    std::unique_ptr<Transaction> batch;
+    size_t batch_size = 0;
 
-      for (const DailyStatsRecord &record: history)
+    const bool history_read = text_store.read_history([&](DailyStatsRecord &&record) {
+      if (!batch)
         {
-          if (has_day(record.date()))
+          batch = std::make_unique<Transaction>(db);
+          if (!*batch)
             {
-              continue;
+              return false;
             }
+        }
+
+      if (!has_day(record.date()))
+        {
           if (!store_day(record))
             {
               return false;
             }
+          imported++;
+        }
+
+      if (++batch_size == IMPORT_BATCH_SIZE)
+        {
+          const bool committed = batch->commit();
+          batch.reset();
+          batch_size = 0;
+          return committed;
+        }
+      return true;
+    });
+
+    if (!history_read || (batch && !batch->commit()))
+      {
+        return false;
+      }
+    batch.reset();
+
+    {
+      Transaction transaction(db);
+      if (!transaction)
+        {
+          return false;
         }
 
+      const std::optional<DailyStatsRecord> today = text_store.load_today();
       if (today.has_value() && !has_day(today->date()))
         {
           if (!store_day(today.value()) || !set_property(PROPERTY_TODAY, to_day(today->date())))
             {
               return false;
             }
+          imported++;
         }
 
       const bool history_recorded = !history_mtime.has_value() || set_property(PROPERTY_IMPORTED_HISTORY_MTIME,
@@ -387,9 +597,9 @@ namespace workrave::stats
         }
     }
 
-    if (!history.empty() || today.has_value())
+    if (imported > 0)
       {
-        spdlog::info("imported {} days of statistics", history.size() + (today.has_value() ? 1 : 0));
+        spdlog::info("imported {} days of statistics", imported);
       }
 
     return true;
@@ -398,7 +608,7 @@ namespace workrave::stats
   std::optional<std::string>
   SqliteStatisticsStore::get_property(const std::string &key)
   {
-    Statement statement(db, "SELECT value FROM schema_info WHERE key = ?");
+    Statement statement(statements, db, "SELECT value FROM schema_info WHERE key = ?");
     if (!statement)
       {
         return std::nullopt;
@@ -416,7 +626,7 @@ namespace workrave::stats
   bool
   SqliteStatisticsStore::set_property(const std::string &key, const std::string &value)
   {
-    Statement statement(db, "INSERT INTO schema_info (key, value) VALUES (?, ?) ON CONFLICT (key) DO UPDATE SET value = ?2");
+    Statement statement(statements, db, "INSERT INTO schema_info (key, value) VALUES (?, ?) ON CONFLICT (key) DO UPDATE SET value = ?2");
     if (!statement)
       {
         return false;
@@ -431,7 +641,7 @@ namespace workrave::stats
   bool
   SqliteStatisticsStore::has_day(const Date &date)
   {
-    Statement statement(db, "SELECT 1 FROM stats_day WHERE day = ?");
+    Statement statement(statements, db, "SELECT 1 FROM stats_day WHERE day = ?");
     if (!statement)
       {
         return false;
@@ -448,7 +658,7 @@ namespace workrave::stats
     const std::string day = to_day(record.date());
 
     {
-      Statement statement(db,
+      Statement statement(statements, db,
                           "INSERT INTO stats_day (day, start_time, stop_day, stop_time)"
                           " VALUES (?, ?, ?, ?)"
                           " ON CONFLICT (day) DO UPDATE SET"
@@ -470,10 +680,11 @@ namespace workrave::stats
     }
 
     // Replace rather than update, so that counters that are no longer reported
-    // do not linger.
+    // do not linger. A counter that is zero is not written: it reads back as
+    // zero anyway.
     for (const char *sql: {"DELETE FROM stats_break WHERE day = ?", "DELETE FROM stats_misc WHERE day = ?"})
       {
-        Statement statement(db, sql);
+        Statement statement(statements, db, sql);
         if (!statement)
           {
             return false;
@@ -486,21 +697,27 @@ namespace workrave::stats
       }
 
     {
-      Statement statement(db, "INSERT INTO stats_break (day, break_id, counter, value) VALUES (?, ?, ?, ?)");
+      Statement statement(statements, db, "INSERT INTO stats_break (day, break_id, counter, value) VALUES (?, ?, ?, ?)");
       if (!statement)
         {
           return false;
         }
 
-      for (size_t break_id = 0; break_id < record.break_stats.size(); break_id++)
+      const size_t breaks = record.break_count();
+      for (size_t break_id = 0; break_id < breaks; break_id++)
         {
-          const std::vector<int64_t> &break_stats = record.break_stats[break_id];
-          for (size_t counter = 0; counter < break_stats.size(); counter++)
+          const size_t counters = record.counter_count(break_id);
+          for (size_t counter = 0; counter < counters; counter++)
             {
+              if (record.get_break(break_id, counter) == 0)
+                {
+                  continue;
+                }
+
               statement.bind(1, day);
               statement.bind(2, static_cast<int64_t>(break_id));
               statement.bind(3, static_cast<int64_t>(counter));
-              statement.bind(4, break_stats[counter]);
+              statement.bind(4, record.get_break(break_id, counter));
               if (!statement.run())
                 {
                   return false;
@@ -510,17 +727,23 @@ namespace workrave::stats
     }
 
     {
-      Statement statement(db, "INSERT INTO stats_misc (day, counter, value) VALUES (?, ?, ?)");
+      Statement statement(statements, db, "INSERT INTO stats_misc (day, counter, value) VALUES (?, ?, ?)");
       if (!statement)
         {
           return false;
         }
 
-      for (size_t counter = 0; counter < record.misc_stats.size(); counter++)
+      const size_t counters = record.misc_count();
+      for (size_t counter = 0; counter < counters; counter++)
         {
+          if (record.get_misc(counter) == 0)
+            {
+              continue;
+            }
+
           statement.bind(1, day);
           statement.bind(2, static_cast<int64_t>(counter));
-          statement.bind(3, record.misc_stats[counter]);
+          statement.bind(3, record.get_misc(counter));
           if (!statement.run())
             {
               return false;
@@ -538,7 +761,7 @@ namespace workrave::stats
     DailyStatsRecord record;
 
     {
-      Statement statement(db, "SELECT start_time, stop_day, stop_time FROM stats_day WHERE day = ?");
+      Statement statement(statements, db, "SELECT start_time, stop_day, stop_time FROM stats_day WHERE day = ?");
       if (!statement)
         {
           return std::nullopt;
@@ -555,7 +778,7 @@ namespace workrave::stats
     }
 
     {
-      Statement statement(db, "SELECT break_id, counter, value FROM stats_break WHERE day = ? ORDER BY break_id, counter");
+      Statement statement(statements, db, "SELECT break_id, counter, value FROM stats_break WHERE day = ? ORDER BY break_id, counter");
       if (!statement)
         {
           return std::nullopt;
@@ -564,23 +787,17 @@ namespace workrave::stats
       statement.bind(1, day);
       while (statement.step())
         {
-          const auto break_id = static_cast<size_t>(statement.column_int(0));
-          const auto counter = static_cast<size_t>(statement.column_int(1));
-
-          if (break_id >= record.break_stats.size())
-            {
-              record.break_stats.resize(break_id + 1);
-            }
-          if (counter >= record.break_stats[break_id].size())
+          const int64_t break_id = statement.column_int(0);
+          const int64_t counter = statement.column_int(1);
+          if (break_id >= 0 && counter >= 0)
             {
-              record.break_stats[break_id].resize(counter + 1, 0);
+              record.set_break(static_cast<size_t>(break_id), static_cast<size_t>(counter), statement.column_int(2));
             }
-          record.break_stats[break_id][counter] = statement.column_int(2);
         }
     }
 
     {
-      Statement statement(db, "SELECT counter, value FROM stats_misc WHERE day = ? ORDER BY counter");
+      Statement statement(statements, db, "SELECT counter, value FROM stats_misc WHERE day = ? ORDER BY counter");
       if (!statement)
         {
           return std::nullopt;
@@ -589,12 +806,11 @@ namespace workrave::stats
       statement.bind(1, day);
       while (statement.step())
         {
-          const auto counter = static_cast<size_t>(statement.column_int(0));
-          if (counter >= record.misc_stats.size())
+          const int64_t counter = statement.column_int(0);
+          if (counter >= 0)
             {
-              record.misc_stats.resize(counter + 1, 0);
+              record.set_misc(static_cast<size_t>(counter), statement.column_int(1));
             }
-          record.misc_stats[counter] = statement.column_int(1);
         }
     }
 
@@ -604,6 +820,9 @@ namespace workrave::stats
   std::optional<DailyStatsRecord>
   SqliteStatisticsStore::load_today()
   {
+    flush();
+    std::scoped_lock lock(mutex);
+
     const std::optional<std::string> today = get_property(PROPERTY_TODAY);
     if (!today.has_value())
       {
@@ -619,7 +838,7 @@ namespace workrave::stats
   {
     std::vector<std::string> days;
 
-    Statement statement(db, "SELECT day FROM stats_day ORDER BY day");
+    Statement statement(statements, db, "SELECT day FROM stats_day ORDER BY day");
     if (!statement)
       {
         return days;
@@ -636,6 +855,7 @@ namespace workrave::stats
   std::vector<DailyStatsRecord>
   SqliteStatisticsStore::load_history()
   {
+    std::scoped_lock lock(mutex);
     std::vector<DailyStatsRecord> records;
 
     const std::optional<std::string> today = get_property(PROPERTY_TODAY);
@@ -660,6 +880,9 @@ namespace workrave::stats
   void
   SqliteStatisticsStore::save_today(const DailyStatsRecord &record)
   {
+    flush();
+    std::scoped_lock lock(mutex);
+
     Transaction transaction(db);
     if (!transaction)
       {
@@ -675,33 +898,71 @@ namespace workrave::stats
   void
   SqliteStatisticsStore::set_break_counter(BreakId break_id, int counter, int64_t value)
   {
+    if (writer)
+      {
+        writer->set(break_id, counter, value);
+      }
+    else
+      {
+        write_break_counters({BreakCounterWriter::Update{break_id, counter, value}});
+      }
+  }
+
+  //! Writes a batch of break counters of the day in progress, in one transaction.
+  /*!
+   *  The day is looked up when the batch is written rather than when each
+   *  counter was set. That is safe because everything that moves to another
+   *  day drains the writer first.
+   */
+  bool
+  SqliteStatisticsStore::write_break_counters(const std::vector<BreakCounterWriter::Update> &updates)
+  {
+    std::scoped_lock lock(mutex);
+
     const std::optional<std::string> today = get_property(PROPERTY_TODAY);
     if (!today.has_value())
       {
-        return;
+        // Without a day in progress there is nothing to update.
+        return true;
       }
 
-    Statement statement(db,
+    Transaction transaction(db);
+    if (!transaction)
+      {
+        return false;
+      }
+
+    Statement statement(statements, db,
                         "INSERT INTO stats_break (day, break_id, counter, value) VALUES (?, ?, ?, ?)"
                         " ON CONFLICT (day, break_id, counter) DO UPDATE SET value = ?4");
     if (!statement)
       {
-        return;
+        return false;
       }
 
-    statement.bind(1, today.value());
-    statement.bind(2, static_cast<int64_t>(break_id));
-    statement.bind(3, static_cast<int64_t>(counter));
-    statement.bind(4, value);
-    if (!statement.run())
+    for (const BreakCounterWriter::Update &update: updates)
       {
-        spdlog::error("failed to update break counter of {}: {}", today.value(), sqlite3_errmsg(db));
+        statement.bind(1, today.value());
+        statement.bind(2, static_cast<int64_t>(update.break_id));
+        statement.bind(3, static_cast<int64_t>(update.counter));
+        statement.bind(4, update.value);
+        if (!statement.run())
+          {
+            spdlog::error("failed to update break counter of {}: {}", today.value(), sqlite3_errmsg(db));
+            return false;
+          }
       }
+
+    return transaction.commit();
   }
 
   void
   SqliteStatisticsStore::append_history(const DailyStatsRecord &record)
   {
+    // Counters still queued belong to the day that is being archived.
+    flush();
+    std::scoped_lock lock(mutex);
+
     Transaction transaction(db);
     if (!transaction)
       {
@@ -719,15 +980,19 @@ namespace workrave::stats
   std::optional<DailyStatsRecord>
   SqliteStatisticsStore::load_date(const Date &date)
   {
+    flush();
+    std::scoped_lock lock(mutex);
+
     return load_day(to_day(date));
   }
 
   std::vector<Date>
   SqliteStatisticsStore::get_dates(const Date &from, const Date &to)
   {
+    std::scoped_lock lock(mutex);
     std::vector<Date> dates;
 
-    Statement statement(db, "SELECT day FROM stats_day WHERE day BETWEEN ? AND ? ORDER BY day");
+    Statement statement(statements, db, "SELECT day FROM stats_day WHERE day BETWEEN ? AND ? ORDER BY day");
     if (!statement)
       {
         return dates;
@@ -747,7 +1012,9 @@ namespace workrave::stats
   std::optional<Date>
   SqliteStatisticsStore::query_date(const char *sql, const std::optional<std::string> &day)
   {
-    Statement statement(db, sql);
+    std::scoped_lock lock(mutex);
+
+    Statement statement(statements, db, sql);
     if (!statement)
       {
         return std::nullopt;
@@ -790,26 +1057,177 @@ namespace workrave::stats
     return query_date("SELECT day FROM stats_day ORDER BY day DESC LIMIT 1", std::nullopt);
   }
 
+  //! Sums one of the miscellaneous counters over the inclusive date range.
+  /*!
+   *  Whole months in the range come from stats_misc_month and whole ISO weeks
+   *  from stats_misc_week, so only the ragged days at either end, and the odd
+   *  week around a month boundary, are summed day by day. Consecutive pieces
+   *  of the same kind are summed by a single query.
+   */
   int64_t
   SqliteStatisticsStore::get_total_misc(int counter, const Date &from, const Date &to)
   {
-    Statement statement(db, "SELECT SUM(value) FROM stats_misc WHERE counter = ? AND day BETWEEN ? AND ?");
+    using namespace std::chrono;
+
+    std::scoped_lock lock(mutex);
+
+    enum class Period
+    {
+      Day,
+      Week,
+      Month
+    };
+
+    struct Span
+    {
+      Period period;
+      sys_days first;
+      sys_days last;
+    };
+
+    std::vector<Span> spans;
+    auto add = [&spans](Period period, sys_days first, sys_days last) {
+      if (!spans.empty() && spans.back().period == period)
+        {
+          spans.back().last = last;
+        }
+      else
+        {
+          spans.push_back(Span{period, first, last});
+        }
+    };
+
+    const sys_days end{to};
+    sys_days day{from};
+    while (day <= end)
+      {
+        const year_month_day date{day};
+        const sys_days month_end{date.year() / date.month() / last};
+        const sys_days week_end = day + days{6};
+
+        if (date.day() == std::chrono::day{1} && month_end <= end)
+          {
+            add(Period::Month, day, day);
+            day = month_end + days{1};
+          }
+        else if (weekday{day} == Monday && week_end <= end && year_month_day{week_end}.month() == date.month())
+          {
+            add(Period::Week, day, day);
+            day = week_end + days{1};
+          }
+        else
+          {
+            add(Period::Day, day, day);
+            day += days{1};
+          }
+      }
+
+    int64_t total = 0;
+    for (const Span &span: spans)
+      {
+        const char *sql = nullptr;
+        std::string first = to_day(year_month_day{span.first});
+        std::string last = to_day(year_month_day{span.last});
+
+        switch (span.period)
+          {
+          case Period::Day:
+            sql = "SELECT SUM(value) FROM stats_misc WHERE counter = ? AND day BETWEEN ? AND ?";
+            break;
+          case Period::Week:
+            sql = "SELECT SUM(value) FROM stats_misc_week WHERE counter = ? AND week BETWEEN ? AND ?";
+            break;
+          case Period::Month:
+            sql = "SELECT SUM(value) FROM stats_misc_month WHERE counter = ? AND month BETWEEN ? AND ?";
+            first.resize(7);
+            last.resize(7);
+            break;
+          }
+
+        Statement statement(statements, db, sql);
+        if (!statement)
+          {
+            return 0;
+          }
+
+        statement.bind(1, counter);
+        statement.bind(2, first);
+        statement.bind(3, last);
+
+        // SUM() over no rows is NULL, which reads back as zero.
+        if (statement.step())
+          {
+            total += statement.column_int(0);
+          }
+      }
+
+    return total;
+  }
+
+  //! Loads a range of days in a single statement.
+  /*!
+   *  Each day comes back as a stats_day row, which has no counter and so sorts
+   *  first, followed by its break counters and then its miscellaneous
+   *  counters, which carry a break id of -1.
+   */
+  DailyStatsColumns
+  SqliteStatisticsStore::load_range(const Date &from, const Date &to)
+  {
+    flush();
+    std::scoped_lock lock(mutex);
+
+    DailyStatsColumns columns;
+
+    Statement statement(statements, db,
+                        "SELECT day, NULL, NULL, NULL FROM stats_day WHERE day BETWEEN ?1 AND ?2"
+                        " UNION ALL"
+                        " SELECT day, break_id, counter, value FROM stats_break WHERE day BETWEEN ?1 AND ?2"
+                        " UNION ALL"
+                        " SELECT day, -1, counter, value FROM stats_misc WHERE day BETWEEN ?1 AND ?2"
+                        " ORDER BY 1, 2 NULLS FIRST");
     if (!statement)
       {
-        return 0;
+        return columns;
       }
 
-    statement.bind(1, counter);
-    statement.bind(2, to_day(from));
-    statement.bind(3, to_day(to));
+    statement.bind(1, to_day(from));
+    statement.bind(2, to_day(to));
+
+    size_t index = 0;
+    while (statement.step())
+      {
+        if (statement.column_is_null(1))
+          {
+            index = columns.add_date(to_date(statement.column_text(0)));
+            continue;
+          }
+
+        if (columns.dates.empty())
+          {
+            continue;
+          }
+
+        const int64_t break_id = statement.column_int(1);
+        const auto counter = static_cast<size_t>(statement.column_int(2));
+        if (break_id < 0)
+          {
+            columns.set_misc(index, counter, statement.column_int(3));
+          }
+        else
+          {
+            columns.set_break(index, static_cast<size_t>(break_id), counter, statement.column_int(3));
+          }
+      }
 
-    // SUM() over no rows is NULL, which reads back as zero.
-    return statement.step() ? statement.column_int(0) : 0;
+    return columns;
   }
 
   bool
   SqliteStatisticsStore::delete_all()
   {
+    flush();
+    std::scoped_lock lock(mutex);
+
     Transaction transaction(db);
     if (!transaction)
       {
@@ -817,11 +1235,20 @@ namespace workrave::stats
       }
 
     // stats_break and stats_misc follow through the foreign key.
-    if (!execute("DELETE FROM stats_day") || !execute("DELETE FROM schema_info WHERE key = 'today'"))
+    if (!execute("DELETE FROM stats_day") || !execute("DELETE FROM stats_misc_week") || !execute("DELETE FROM stats_misc_month")
+        || !execute("DELETE FROM schema_info WHERE key = 'today'"))
       {
         return false;
       }
 
-    return transaction.commit();
+    if (!transaction.commit())
+      {
+        return false;
+      }
+
+    // Start over with fresh statements, as the tables they were prepared
+    // against have just been emptied.
+    statements.clear();
+    return true;
   }
 } // namespace workrave::stats
@@ -18,14 +18,19 @@
 #ifndef WORKRAVE_LIBS_STATS_SQLITESTATISTICSSTORE_HH
 #define WORKRAVE_LIBS_STATS_SQLITESTATISTICSSTORE_HH
 
+#include <chrono>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
 
 #include <sqlite3.h>
 
+#include "BreakCounterWriter.hh"
 #include "IStatisticsStore.hh"
+#include "SqliteStatementCache.hh"
 
 namespace workrave::stats
 {
@@ -35,14 +40,26 @@ namespace workrave::stats
    *  stats_break and stats_misc so that counters can be added, or arrive from a
    *  newer version of Workrave, without a schema change.
    *
+   *  stats_misc_week and stats_misc_month roll stats_misc up per ISO week and
+   *  per month, so that totals over long ranges stay cheap.
+   *
    *  The day in progress is the day named by the "today" key in schema_info;
    *  every other day is history. That mirrors the todaystats/historystats split
    *  of the text format that preceded this store.
+   *
+   *  Break counters set through set_break_counter() are group-committed by a
+   *  BreakCounterWriter, at most one flush window after they were set. Anything
+   *  that reads or replaces the day in progress drains it first, and so does
+   *  the destructor.
    */
   class SqliteStatisticsStore : public IStatisticsStore
   {
   public:
-    explicit SqliteStatisticsStore(std::filesystem::path state_directory);
+    //! The longest a break counter update waits before it is written.
+    static constexpr std::chrono::milliseconds DEFAULT_FLUSH_WINDOW{2000};
+
+    explicit SqliteStatisticsStore(std::filesystem::path state_directory,
+                                   std::chrono::milliseconds flush_window = DEFAULT_FLUSH_WINDOW);
     ~SqliteStatisticsStore() override;
 
     SqliteStatisticsStore(const SqliteStatisticsStore &) = delete;
@@ -66,8 +83,19 @@ namespace workrave::stats
     [[nodiscard]] std::optional<Date> get_first_date() override;
     [[nodiscard]] std::optional<Date> get_last_date() override;
     [[nodiscard]] int64_t get_total_misc(int counter, const Date &from, const Date &to) override;
+    [[nodiscard]] DailyStatsColumns load_range(const Date &from, const Date &to) override;
+
+    void flush() override;
+
+    //! How many break counter updates were merged into a later one rather than written.
+    [[nodiscard]] int64_t get_merged_write_count() const;
+
+    //! How many statements were prepared, rather than taken from the statement cache.
+    [[nodiscard]] int64_t get_prepare_count() const;
 
   private:
+    bool write_break_counters(const std::vector<BreakCounterWriter::Update> &updates);
+
     [[nodiscard]] std::optional<Date> query_date(const char *sql, const std::optional<std::string> &day);
     [[nodiscard]] std::filesystem::path database_path() const;
 
@@ -85,7 +113,14 @@ namespace workrave::stats
 
   private:
     std::filesystem::path state_directory;
+    std::chrono::milliseconds flush_window;
+
+    //! Guards db and statements, which the writer uses from its own thread.
+    mutable std::mutex mutex;
     sqlite3 *db{nullptr};
+    SqliteStatementCache statements;
+
+    std::unique_ptr<BreakCounterWriter> writer;
   };
 } // namespace workrave::stats
 
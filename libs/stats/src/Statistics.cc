@@ -47,6 +47,9 @@ namespace
   //! Where total_active_time sits within misc_stats in the store, matching where
   //! STATS_VALUE_TOTAL_ACTIVE_TIME used to sit before it became its own field.
   constexpr size_t ACTIVE_TIME_STORAGE_INDEX = 0;
+
+  static_assert(OVERDUE_STORAGE_INDEX < workrave::stats::DailyStatsRecord::BREAK_COUNTERS);
+  static_assert(ACTIVE_TIME_STORAGE_INDEX < workrave::stats::DailyStatsRecord::MISC_COUNTERS);
 } // namespace
 
 using namespace workrave::stats;
@@ -113,6 +116,15 @@ Statistics::save()
   save_day(current_day);
 }
 
+void
+Statistics::flush()
+{
+  if (store)
+    {
+      store->flush();
+    }
+}
+
 bool
 Statistics::delete_all_history()
 {
@@ -184,12 +196,9 @@ Statistics::to_record(const DailyStats *stats)
   record.start = stats->start.value_or(now);
   record.stop = stats->stop.value_or(now);
 
-  record.break_stats.resize(BREAK_ID_SIZEOF);
-  for (int i = 0; i < BREAK_ID_SIZEOF; i++)
+  for (size_t i = 0; i < BREAK_ID_SIZEOF; i++)
     {
-      std::vector<int64_t> &counters = record.break_stats[i];
-      counters.resize(OVERDUE_STORAGE_INDEX + 1);
-
+      auto &counters = record.break_stats[i];
       for (auto type: workrave::utils::enum_range<BreakStatValue>())
         {
           counters[static_cast<size_t>(type)] = stats->break_stats[i][type].to_storage();
@@ -197,7 +206,6 @@ Statistics::to_record(const DailyStats *stats)
       counters[OVERDUE_STORAGE_INDEX] = stats->total_overdue[i].to_storage();
     }
 
-  record.misc_stats.resize(ACTIVE_TIME_STORAGE_INDEX + 1);
   record.misc_stats[ACTIVE_TIME_STORAGE_INDEX] = stats->total_active_time.to_storage();
 
   return record;
@@ -207,7 +215,7 @@ Statistics::to_record(const DailyStats *stats)
 /*!
  *  Counters the store knows about but this version of Workrave does not are
  *  discarded, and counters this version expects but the store does not have
- *  keep their initial value.
+ *  read as zero.
  */
 Statistics::DailyStats
 Statistics::from_record(const DailyStatsRecord &record)
@@ -217,27 +225,17 @@ Statistics::from_record(const DailyStatsRecord &record)
   stats.start = record.start;
   stats.stop = record.stop;
 
-  const size_t breaks = std::min<size_t>(record.break_stats.size(), BREAK_ID_SIZEOF);
-  for (size_t i = 0; i < breaks; i++)
+  for (size_t i = 0; i < BREAK_ID_SIZEOF; i++)
     {
-      const std::vector<int64_t> &counters = record.break_stats[i];
-
-      const size_t known = std::min<size_t>(counters.size(), static_cast<size_t>(workrave::stats::STATS_BREAKVALUE_SIZEOF));
-      for (size_t j = 0; j < known; j++)
-        {
-          stats.break_stats[i][j].from_storage(counters[j]);
-        }
-
-      if (counters.size() > OVERDUE_STORAGE_INDEX)
+      const auto &counters = record.break_stats[i];
+      for (auto type: workrave::utils::enum_range<BreakStatValue>())
         {
-          stats.total_overdue[i].from_storage(counters[OVERDUE_STORAGE_INDEX]);
+          stats.break_stats[i][type].from_storage(counters[static_cast<size_t>(type)]);
         }
+      stats.total_overdue[i].from_storage(counters[OVERDUE_STORAGE_INDEX]);
     }
 
-  if (record.misc_stats.size() > ACTIVE_TIME_STORAGE_INDEX)
-    {
-      stats.total_active_time.from_storage(record.misc_stats[ACTIVE_TIME_STORAGE_INDEX]);
-    }
+  stats.total_active_time.from_storage(record.misc_stats[ACTIVE_TIME_STORAGE_INDEX]);
 
   return stats;
 }
@@ -392,7 +390,7 @@ Statistics::get_total_active_time(const Date &from, const Date &to) const
       if (today >= from && today <= to)
         {
           std::optional<DailyStatsRecord> stored = store->load_date(today);
-          if (stored.has_value() && stored->misc_stats.size() > ACTIVE_TIME_STORAGE_INDEX)
+          if (stored.has_value())
             {
               total -= stored->misc_stats[ACTIVE_TIME_STORAGE_INDEX];
             }
@@ -402,4 +400,96 @@ Statistics::get_total_active_time(const Date &from, const Date &to) const
 
   return std::chrono::seconds{total};
 }
+
+//! Converts the columns of the statistics store into what the user interface
+//! expects, the same way from_record() does for a single day.
+IStatistics::RangeStats
+Statistics::get_range(const Date &from, const Date &to) const
+{
+  RangeStats range;
+
+  DailyStatsColumns columns;
+  if (store != nullptr)
+    {
+      columns = store->load_range(from, to);
+    }
+
+  range.dates = std::move(columns.dates);
+  const size_t days = range.dates.size();
+
+  for (size_t i = 0; i < BREAK_ID_SIZEOF; i++)
+    {
+      std::vector<std::vector<int64_t>> *counters = i < columns.break_stats.size() ? &columns.break_stats[i] : nullptr;
+
+      for (auto type: workrave::utils::enum_range<BreakStatValue>())
+        {
+          const auto index = static_cast<size_t>(type);
+          if (counters != nullptr && index < counters->size())
+            {
+              range.break_stats[i][type] = std::move((*counters)[index]);
+            }
+          else
+            {
+              range.break_stats[i][type].assign(days, 0);
+            }
+        }
+
+      range.total_overdue[i].resize(days);
+      for (size_t day = 0; day < days; day++)
+        {
+          if (counters != nullptr && OVERDUE_STORAGE_INDEX < counters->size())
+            {
+              range.total_overdue[i][day] = std::chrono::seconds{(*counters)[OVERDUE_STORAGE_INDEX][day]};
+            }
+        }
+    }
+
+  range.active_time.resize(days);
+  if (ACTIVE_TIME_STORAGE_INDEX < columns.misc_stats.size())
+    {
+      for (size_t day = 0; day < days; day++)
+        {
+          range.active_time[day] = std::chrono::seconds{columns.misc_stats[ACTIVE_TIME_STORAGE_INDEX][day]};
+        }
+    }
+
+  // The day in progress is only written to the store now and then, so its
+  // values are taken straight from memory.
+  if (current_day != nullptr && current_day->start.has_value())
+    {
+      const Date today = date_of(*current_day->start);
+      if (today >= from && today <= to)
+        {
+          const auto it = std::lower_bound(range.dates.begin(), range.dates.end(), today);
+          const auto day = static_cast<size_t>(it - range.dates.begin());
+          if (it == range.dates.end() || *it != today)
+            {
+              range.dates.insert(it, today);
+              for (size_t i = 0; i < BREAK_ID_SIZEOF; i++)
+                {
+                  for (auto type: workrave::utils::enum_range<BreakStatValue>())
+                    {
+                      auto &column = range.break_stats[i][type];
+                      column.insert(column.begin() + static_cast<std::ptrdiff_t>(day), 0);
+                    }
+                  auto &overdue = range.total_overdue[i];
+                  overdue.insert(overdue.begin() + static_cast<std::ptrdiff_t>(day), std::chrono::seconds{0});
+                }
+              range.active_time.insert(range.active_time.begin() + static_cast<std::ptrdiff_t>(day), std::chrono::seconds{0});
+            }
+
+          for (size_t i = 0; i < BREAK_ID_SIZEOF; i++)
+            {
+              for (auto type: workrave::utils::enum_range<BreakStatValue>())
+                {
+                  range.break_stats[i][type][day] = current_day->break_stats[i][type].get();
+                }
+              range.total_overdue[i][day] = current_day->total_overdue[i].get();
+            }
+          range.active_time[day] = current_day->total_active_time.get();
+        }
+    }
+
+  return range;
+}
 // namespace workrave::stats
@@ -46,6 +46,7 @@ namespace workrave::stats
 
     void update() override;
     void save() override;
+    void flush() override;
     void start_new_day() override;
     bool delete_all_history() override;
 
@@ -60,6 +61,7 @@ namespace workrave::stats
     std::optional<Date> get_first_date() const override;
     std::optional<Date> get_last_date() const override;
     std::chrono::seconds get_total_active_time(const Date &from, const Date &to) const override;
+    RangeStats get_range(const Date &from, const Date &to) const override;
 
   private:
     bool load_current_day();
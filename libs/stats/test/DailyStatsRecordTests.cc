@@ -0,0 +1,92 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <gtest/gtest.h>
+
+#include "StatisticsStoreTestFixture.hh"
+
+using namespace workrave::stats;
+using namespace workrave::stats::test;
+
+namespace
+{
+  class DailyStatsRecordTest : public StatisticsStoreTest
+  {
+  };
+
+  //! The counters Workrave keeps are read from and written to the dense layout.
+  TEST_F(DailyStatsRecordTest, known_counters_are_dense)
+  {
+    DailyStatsRecord record;
+    record.set_break(workrave::BREAK_ID_REST_BREAK, 2, 42);
+    record.set_misc(0, 7);
+
+    EXPECT_EQ(record.break_stats[workrave::BREAK_ID_REST_BREAK][2], 42);
+    EXPECT_EQ(record.misc_stats[0], 7);
+    EXPECT_TRUE(record.extra_counters.empty());
+    EXPECT_EQ(record.break_count(), static_cast<size_t>(workrave::BREAK_ID_REST_BREAK) + 1);
+    EXPECT_EQ(record.counter_count(workrave::BREAK_ID_MICRO_BREAK), 0U);
+    EXPECT_EQ(record.counter_count(workrave::BREAK_ID_REST_BREAK), 3U);
+    EXPECT_EQ(record.misc_count(), 1U);
+  }
+
+  //! Counters of another version of Workrave are kept aside, in order.
+  TEST_F(DailyStatsRecordTest, unknown_counters_are_kept)
+  {
+    DailyStatsRecord record;
+    record.set_break(5, 1, 51);
+    record.set_break(workrave::BREAK_ID_MICRO_BREAK, DailyStatsRecord::BREAK_COUNTERS + 2, 3);
+    record.set_misc(DailyStatsRecord::MISC_COUNTERS, 60);
+    record.set_break(5, 0, 50);
+    record.set_break(5, 1, 52);
+
+    ASSERT_EQ(record.extra_counters.size(), 4U);
+    EXPECT_EQ(record.extra_counters[0].break_id, static_cast<size_t>(workrave::BREAK_ID_MICRO_BREAK));
+    EXPECT_EQ(record.extra_counters[1].value, 50);
+    EXPECT_EQ(record.extra_counters[2].value, 52);
+    EXPECT_EQ(record.extra_counters[3].break_id, DailyStatsRecord::MISC);
+
+    EXPECT_EQ(record.break_count(), 6U);
+    EXPECT_EQ(record.counter_count(5), 2U);
+    EXPECT_EQ(record.counter_count(4), 0U);
+    EXPECT_EQ(record.counter_count(workrave::BREAK_ID_MICRO_BREAK), DailyStatsRecord::BREAK_COUNTERS + 3);
+    EXPECT_EQ(record.misc_count(), DailyStatsRecord::MISC_COUNTERS + 1);
+    EXPECT_EQ(record.get_break(5, 1), 52);
+    EXPECT_EQ(record.get_break(5, 7), 0);
+    EXPECT_EQ(record.get_misc(DailyStatsRecord::MISC_COUNTERS), 60);
+  }
+
+  //! Counters that went back to zero are no longer counted, known or not.
+  TEST_F(DailyStatsRecordTest, zero_counters_are_not_counted)
+  {
+    DailyStatsRecord record = make_record();
+    record.break_stats[workrave::BREAK_ID_DAILY_LIMIT] = {};
+    record.misc_stats = {100, 0, 300, 0, 0, 0};
+    for (size_t counter = 0; counter < 7; counter++)
+      {
+        record.set_break(3, counter, 0);
+      }
+
+    EXPECT_EQ(record.break_count(), static_cast<size_t>(workrave::BREAK_ID_DAILY_LIMIT));
+    EXPECT_EQ(record.counter_count(3), 0U);
+    EXPECT_EQ(record.misc_count(), 3U);
+  }
+} // namespace
@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 #include "StatisticsStoreTestFixture.hh"
 
@@ -55,12 +56,12 @@ namespace
     EXPECT_EQ(record->start, to_local_time(reference_date(12), hours{9} + minutes{15}));
     EXPECT_EQ(record->stop, to_local_time(reference_date(12), hours{17} + minutes{42}));
 
-    ASSERT_EQ(record->break_stats.size(), 4U);
-    ASSERT_EQ(record->break_stats[0].size(), 7U);
+    ASSERT_EQ(record->break_count(), 4U);
+    ASSERT_EQ(record->counter_count(0), 7U);
     EXPECT_EQ(record->break_stats[0][0], 1);
-    EXPECT_EQ(record->break_stats[3][6], 28);
+    EXPECT_EQ(record->get_break(3, 6), 28);
 
-    ASSERT_EQ(record->misc_stats.size(), 6U);
+    ASSERT_EQ(record->misc_count(), 6U);
     EXPECT_EQ(record->misc_stats[0], 100);
     EXPECT_EQ(record->misc_stats[5], 600);
   }
@@ -105,6 +106,7 @@ namespace
     auto record = store->load_today();
     ASSERT_TRUE(record.has_value());
     EXPECT_EQ(record->break_stats, original.break_stats);
+    EXPECT_EQ(record->extra_counters, original.extra_counters);
     EXPECT_EQ(record->misc_stats, original.misc_stats);
     EXPECT_EQ(record->start, original.start);
     EXPECT_EQ(record->stop, original.stop);
@@ -143,7 +145,6 @@ namespace
 
     auto record = file_store()->load_today();
     ASSERT_TRUE(record.has_value());
-    ASSERT_EQ(record->misc_stats.size(), 3U);
     EXPECT_EQ(record->misc_stats[0], 0);
     EXPECT_EQ(record->misc_stats[2], 0);
   }
@@ -172,7 +173,8 @@ namespace
 
     auto record = file_store()->load_today();
     ASSERT_TRUE(record.has_value());
-    EXPECT_TRUE(record->break_stats.empty());
+    EXPECT_EQ(record->break_count(), 0U);
+    EXPECT_TRUE(record->extra_counters.empty());
   }
 
   TEST_F(FileStoreTest, load_history_returns_days_in_file_order)
@@ -192,11 +194,61 @@ namespace
     EXPECT_EQ(history[1].misc_stats[0], 22);
   }
 
+  //! Days are handed over one by one, and the reader stops when asked to.
+  TEST_F(FileStoreTest, read_history_can_stop_early)
+  {
+    write("historystats", make_long_history(3));
+
+    std::vector<Date> dates;
+    EXPECT_FALSE(file_store()->read_history([&dates](DailyStatsRecord &&record) {
+      dates.push_back(record.date());
+      return dates.size() < 2;
+    }));
+
+    ASSERT_EQ(dates.size(), 2U);
+    EXPECT_EQ(dates[1], reference_date(13));
+  }
+
+  //! Lines cross the boundaries of the chunks the file is read in.
+  TEST_F(FileStoreTest, load_history_spanning_many_chunks)
+  {
+    const int count = 2000;
+    write("historystats", make_long_history(count));
+
+    auto history = file_store()->load_history();
+    ASSERT_EQ(history.size(), static_cast<size_t>(count));
+    for (int i = 0; i < count; i++)
+      {
+        ASSERT_TRUE(history[i].extra_counters.empty());
+        EXPECT_EQ(history[i].misc_stats[0], i);
+        EXPECT_EQ(history[i].break_stats[1][6], 14);
+      }
+  }
+
+  //! Files edited on Windows, or cut short, must still load.
+  TEST_F(FileStoreTest, load_handles_crlf_and_missing_final_newline)
+  {
+    write("todaystats",
+          "WorkRaveStats 4\r\n"
+          "D 12 6 125 9 15 12 6 125 17 42\r\n"
+          "m 2 100 200");
+
+    auto record = file_store()->load_today();
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->date(), reference_date(12));
+    EXPECT_EQ(record->misc_stats[1], 200);
+  }
+
   TEST_F(FileStoreTest, date_queries)
   {
     check_date_queries(file_store());
   }
 
+  TEST_F(FileStoreTest, load_range)
+  {
+    check_load_range(file_store());
+  }
+
   TEST_F(FileStoreTest, delete_all)
   {
     auto store = file_store();
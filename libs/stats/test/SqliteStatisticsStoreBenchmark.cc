@@ -0,0 +1,143 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Times the statement-heavy calls of SqliteStatisticsStore, next to the
+// same queries prepared and finalized on every call. Not part of the test
+// suite; run by hand:
+//
+//   workrave-stats-benchmark [iterations]
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include <sqlite3.h>
+
+#include "SqliteStatisticsStore.hh"
+#include "StatisticsStoreTestFixture.hh"
+
+using namespace workrave::stats;
+using namespace workrave::stats::test;
+
+namespace
+{
+  template<typename Func>
+  void
+  measure(const std::string &name, int iterations, Func func)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+      {
+        func(i);
+      }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto per_call = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / iterations;
+    std::cout << name << ": " << per_call << " ns/call" << std::endl;
+  }
+
+  //! What load_date() did before statements were cached.
+  void
+  load_date_uncached(sqlite3 *db)
+  {
+    for (const char *sql: {"SELECT start_time, stop_day, stop_time FROM stats_day WHERE day = ?",
+                           "SELECT break_id, counter, value FROM stats_break WHERE day = ? ORDER BY break_id, counter",
+                           "SELECT counter, value FROM stats_misc WHERE day = ? ORDER BY counter"})
+      {
+        sqlite3_stmt *stmt = nullptr;
+        sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr);
+        sqlite3_bind_text(stmt, 1, "2025-07-12", -1, SQLITE_STATIC);
+        while (sqlite3_step(stmt) == SQLITE_ROW)
+          {
+          }
+        sqlite3_finalize(stmt);
+      }
+  }
+
+  //! What a single break counter write did before statements were cached.
+  void
+  set_break_counter_uncached(sqlite3 *db, int value)
+  {
+    sqlite3_exec(db, "BEGIN", nullptr, nullptr, nullptr);
+    sqlite3_stmt *stmt = nullptr;
+    sqlite3_prepare_v2(db,
+                       "INSERT INTO stats_break (day, break_id, counter, value) VALUES (?, ?, ?, ?)"
+                       " ON CONFLICT (day, break_id, counter) DO UPDATE SET value = ?4",
+                       -1,
+                       &stmt,
+                       nullptr);
+    sqlite3_bind_text(stmt, 1, "2025-07-13", -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, workrave::BREAK_ID_REST_BREAK);
+    sqlite3_bind_int(stmt, 3, 0);
+    sqlite3_bind_int64(stmt, 4, value);
+    sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+    sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr);
+  }
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 10000;
+  if (iterations <= 0)
+    {
+      std::cerr << "usage: " << argv[0] << " [iterations]" << std::endl;
+      return 1;
+    }
+
+  const std::filesystem::path directory = std::filesystem::temp_directory_path() / "workrave-stats-benchmark";
+  std::filesystem::remove_all(directory);
+
+  {
+    SqliteStatisticsStore store(directory);
+    if (!store.open())
+      {
+        std::cerr << "failed to open the statistics store in " << directory.string() << std::endl;
+        return 1;
+      }
+    store.append_history(make_record(12));
+    store.save_today(make_record(13));
+
+    measure("load_date (cached)", iterations, [&](int) { (void)store.load_date(reference_date(12)); });
+    measure("set_break_counter (cached)", iterations, [&](int i) {
+      store.set_break_counter(workrave::BREAK_ID_REST_BREAK, 0, i);
+      store.flush();
+    });
+    std::cout << "statements prepared: " << store.get_prepare_count() << std::endl;
+  }
+
+  sqlite3 *db = nullptr;
+  if (sqlite3_open_v2((directory / "statistics.db").string().c_str(), &db, SQLITE_OPEN_READWRITE, nullptr) != SQLITE_OK)
+    {
+      std::cerr << "failed to reopen the statistics database" << std::endl;
+      return 1;
+    }
+  sqlite3_exec(db, "PRAGMA synchronous = NORMAL", nullptr, nullptr, nullptr);
+
+  measure("load_date (prepared per call)", iterations, [&](int) { load_date_uncached(db); });
+  measure("set_break_counter (prepared per call)", iterations, [&](int i) { set_break_counter_uncached(db, i); });
+
+  sqlite3_close(db);
+  std::filesystem::remove_all(directory);
+  return 0;
+}
@@ -21,7 +21,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
 #include <string>
+#include <thread>
 
 #include "StatisticsStoreTestFixture.hh"
 
@@ -33,24 +36,53 @@ namespace
   class SqliteStoreTest : public StatisticsStoreTest
   {
   protected:
-    //! Counts the rows of a table, straight from the database.
-    [[nodiscard]] int count_rows(const std::string &table) const
+    //! Runs a query that selects a single number, straight from the database.
+    [[nodiscard]] int64_t query_int(const std::string &sql) const
     {
       sqlite3 *db = nullptr;
       EXPECT_EQ(sqlite3_open_v2((directory / "statistics.db").string().c_str(), &db, SQLITE_OPEN_READONLY, nullptr), SQLITE_OK);
 
       sqlite3_stmt *stmt = nullptr;
-      EXPECT_EQ(sqlite3_prepare_v2(db, ("SELECT COUNT(*) FROM " + table).c_str(), -1, &stmt, nullptr), SQLITE_OK);
+      EXPECT_EQ(sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr), SQLITE_OK);
 
-      int count = -1;
+      int64_t result = -1;
       if (sqlite3_step(stmt) == SQLITE_ROW)
         {
-          count = sqlite3_column_int(stmt, 0);
+          result = sqlite3_column_int64(stmt, 0);
         }
 
       sqlite3_finalize(stmt);
       sqlite3_close(db);
-      return count;
+      return result;
+    }
+
+    //! Counts the rows of a table, straight from the database.
+    [[nodiscard]] int count_rows(const std::string &table) const
+    {
+      return static_cast<int>(query_int("SELECT COUNT(*) FROM " + table));
+    }
+
+    //! Runs statements straight on the database, behind the store's back.
+    void execute(const std::string &sql) const
+    {
+      sqlite3 *db = nullptr;
+      EXPECT_EQ(sqlite3_open_v2((directory / "statistics.db").string().c_str(), &db, SQLITE_OPEN_READWRITE, nullptr), SQLITE_OK);
+      EXPECT_EQ(sqlite3_exec(db, sql.c_str(), nullptr, nullptr, nullptr), SQLITE_OK);
+      sqlite3_close(db);
+    }
+
+    //! Archives the reference day on every date in the inclusive range.
+    static void append_days(const std::shared_ptr<SqliteStatisticsStore> &store, const Date &from, const Date &to)
+    {
+      using namespace std::chrono;
+
+      for (sys_days day{from}; day <= sys_days{to}; day += days{1})
+        {
+          DailyStatsRecord record = make_record();
+          record.start = to_local_time(year_month_day{day}, hours{9});
+          record.stop = to_local_time(year_month_day{day}, hours{17});
+          store->append_history(record);
+        }
     }
   };
 
@@ -112,14 +144,21 @@ namespace
     store->save_today(make_record());
 
     DailyStatsRecord shorter = make_record();
-    shorter.misc_stats.resize(2);
-    shorter.break_stats.resize(1);
+    shorter.extra_counters.clear();
+    shorter.break_stats[1] = {};
+    shorter.break_stats[2] = {};
+    shorter.misc_stats = {100, 200, 0, 0, 0, 0};
     store->save_today(shorter);
 
     auto today = store->load_today();
     ASSERT_TRUE(today.has_value());
-    EXPECT_EQ(today->misc_stats.size(), 2U);
-    EXPECT_EQ(today->break_stats.size(), 1U);
+    EXPECT_EQ(today->misc_count(), 2U);
+    EXPECT_EQ(today->break_count(), 1U);
+    EXPECT_TRUE(today->extra_counters.empty());
+
+    // Counters that are zero are not written at all.
+    EXPECT_EQ(count_rows("stats_break"), 7);
+    EXPECT_EQ(count_rows("stats_misc"), 2);
   }
 
   //! The day in progress is not part of the history.
@@ -175,18 +214,18 @@ namespace
   TEST_F(SqliteStoreTest, unknown_counters_survive)
   {
     DailyStatsRecord record = make_record();
-    record.misc_stats.push_back(4242);
-    record.break_stats.emplace_back(std::vector<int64_t>{1, 2, 3});
+    record.set_misc(6, 4242);
+    record.set_break(4, 2, 3);
 
     auto store = sqlite_store();
     store->save_today(record);
 
     auto today = sqlite_store()->load_today();
     ASSERT_TRUE(today.has_value());
-    ASSERT_EQ(today->misc_stats.size(), 7U);
-    EXPECT_EQ(today->misc_stats[6], 4242);
-    ASSERT_EQ(today->break_stats.size(), 5U);
-    EXPECT_EQ(today->break_stats[4][2], 3);
+    ASSERT_EQ(today->misc_count(), 7U);
+    EXPECT_EQ(today->get_misc(6), 4242);
+    ASSERT_EQ(today->break_count(), 5U);
+    EXPECT_EQ(today->get_break(4, 2), 3);
   }
 
   TEST_F(SqliteStoreTest, date_queries)
@@ -194,6 +233,11 @@ namespace
     check_date_queries(sqlite_store());
   }
 
+  TEST_F(SqliteStoreTest, load_range)
+  {
+    check_load_range(sqlite_store());
+  }
+
   TEST_F(SqliteStoreTest, break_counter_updates)
   {
     check_break_counter_updates(sqlite_store());
@@ -204,6 +248,107 @@ namespace
     check_break_counter_update_without_today(sqlite_store());
   }
 
+  //! Repeated updates of a counter within one flush window become a single write.
+  TEST_F(SqliteStoreTest, break_counter_updates_are_merged)
+  {
+    {
+      auto store = std::make_shared<SqliteStatisticsStore>(directory, std::chrono::hours{1});
+      ASSERT_TRUE(store->open());
+      store->save_today(make_record());
+
+      store->set_break_counter(workrave::BREAK_ID_REST_BREAK, 0, 1);
+      store->set_break_counter(workrave::BREAK_ID_REST_BREAK, 0, 2);
+      store->set_break_counter(workrave::BREAK_ID_REST_BREAK, 0, 3);
+      store->set_break_counter(workrave::BREAK_ID_MICRO_BREAK, 0, 4);
+
+      EXPECT_EQ(store->get_merged_write_count(), 2);
+
+      // Not written yet: the window is far from over.
+      EXPECT_EQ(query_int("SELECT value FROM stats_break WHERE break_id = 1 AND counter = 0"), 8);
+    }
+
+    // Closing the store drains what was still queued.
+    EXPECT_EQ(query_int("SELECT value FROM stats_break WHERE break_id = 1 AND counter = 0"), 3);
+    EXPECT_EQ(query_int("SELECT value FROM stats_break WHERE break_id = 0 AND counter = 0"), 4);
+  }
+
+  //! Without anything forcing it out, a queued update is written once its flush window has passed.
+  TEST_F(SqliteStoreTest, break_counter_written_within_flush_window)
+  {
+    auto store = std::make_shared<SqliteStatisticsStore>(directory, std::chrono::milliseconds{20});
+    ASSERT_TRUE(store->open());
+    store->save_today(make_record());
+
+    store->set_break_counter(workrave::BREAK_ID_REST_BREAK, 0, 42);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (query_int("SELECT value FROM stats_break WHERE break_id = 1 AND counter = 0") != 42
+           && std::chrono::steady_clock::now() < deadline)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+      }
+
+    EXPECT_EQ(query_int("SELECT value FROM stats_break WHERE break_id = 1 AND counter = 0"), 42);
+  }
+
+  //! Counters still queued at a day rollover are drained into the day being
+  //! archived, and never leak into the new day.
+  TEST_F(SqliteStoreTest, break_counters_drain_on_day_rollover)
+  {
+    auto store = std::make_shared<SqliteStatisticsStore>(directory, std::chrono::hours{1});
+    ASSERT_TRUE(store->open());
+    store->save_today(make_record(12));
+
+    store->set_break_counter(workrave::BREAK_ID_REST_BREAK, 0, 42);
+
+    // What Statistics::start_new_day() does. append_history() first drains the
+    // queued 42 into the 12th, and then overwrites it with the 8 of the archived
+    // record. The 13th starts from its own record.
+    store->append_history(make_record(12));
+    store->save_today(make_record(13));
+
+    EXPECT_EQ(query_int("SELECT value FROM stats_break WHERE day = '2025-07-12' AND break_id = 1 AND counter = 0"), 8);
+    EXPECT_EQ(query_int("SELECT value FROM stats_break WHERE day = '2025-07-13' AND break_id = 1 AND counter = 0"), 8);
+  }
+
+  //! Statements are prepared once, and reused by every later call.
+  TEST_F(SqliteStoreTest, statements_are_prepared_once)
+  {
+    auto store = sqlite_store();
+    store->append_history(make_record(12));
+    store->save_today(make_record(13));
+
+    EXPECT_TRUE(store->load_date(reference_date(12)).has_value());
+    store->set_break_counter(workrave::BREAK_ID_REST_BREAK, 0, 1);
+    store->flush();
+    const int64_t prepared = store->get_prepare_count();
+
+    for (int i = 0; i < 10; i++)
+      {
+        EXPECT_TRUE(store->load_date(reference_date(12)).has_value());
+        store->set_break_counter(workrave::BREAK_ID_REST_BREAK, 0, i);
+        store->flush();
+      }
+
+    EXPECT_EQ(store->get_prepare_count(), prepared);
+    EXPECT_EQ(query_int("SELECT value FROM stats_break WHERE day = '2025-07-13' AND break_id = 1 AND counter = 0"), 9);
+  }
+
+  //! Statements prepared before delete_all() must still work after it.
+  TEST_F(SqliteStoreTest, statements_survive_delete_all)
+  {
+    auto store = sqlite_store();
+    store->save_today(make_record(13));
+    EXPECT_TRUE(store->load_today().has_value());
+
+    EXPECT_TRUE(store->delete_all());
+
+    store->save_today(make_record(14));
+    auto record = store->load_today();
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->misc_stats[0], 100);
+  }
+
   TEST_F(SqliteStoreTest, delete_all)
   {
     auto store = sqlite_store();
@@ -234,6 +379,117 @@ namespace
     EXPECT_EQ(count_rows("stats_misc"), 0);
   }
 
+  //! Totals that span whole weeks and months, read from the rollups, must
+  //! match summing every day.
+  TEST_F(SqliteStoreTest, totals_over_weeks_and_months)
+  {
+    using namespace std::chrono;
+
+    auto store = sqlite_store();
+    append_days(store, year{2025} / 5 / 20, year{2025} / 9 / 10);
+
+    EXPECT_GT(count_rows("stats_misc_week"), 0);
+    EXPECT_GT(count_rows("stats_misc_month"), 0);
+
+    // Every day holds 100 in counter 0, so a total is 100 per day in the range with statistics.
+    auto expected = [](const Date &from, const Date &to) {
+      const sys_days first = std::max(sys_days{from}, sys_days{year{2025} / 5 / 20});
+      const sys_days last = std::min(sys_days{to}, sys_days{year{2025} / 9 / 10});
+      return first > last ? 0 : 100 * ((last - first).count() + 1);
+    };
+
+    const std::vector<std::pair<Date, Date>> ranges = {
+      {year{2025} / 6 / 1, year{2025} / 6 / 30},
+      {year{2025} / 7 / 7, year{2025} / 7 / 13},
+      {year{2025} / 5 / 1, year{2025} / 12 / 31},
+      {year{2025} / 5 / 28, year{2025} / 8 / 3},
+      {year{2025} / 6 / 29, year{2025} / 7 / 2},
+      {year{2025} / 7 / 12, year{2025} / 7 / 12},
+      {year{2025} / 10 / 1, year{2025} / 10 / 31},
+    };
+
+    for (const auto &[from, to]: ranges)
+      {
+        EXPECT_EQ(store->get_total_misc(0, from, to), expected(from, to)) << from << " - " << to;
+        EXPECT_EQ(store->get_total_misc(1, from, to), 2 * expected(from, to)) << from << " - " << to;
+      }
+  }
+
+  //! Storing a day again must replace its share of the rollups, not add to it.
+  TEST_F(SqliteStoreTest, rollups_follow_replaced_days)
+  {
+    using namespace std::chrono;
+
+    auto store = sqlite_store();
+
+    DailyStatsRecord record = make_record();
+    store->save_today(record);
+    record.misc_stats[0] = 999;
+    store->save_today(record);
+
+    EXPECT_EQ(store->get_total_misc(0, year{2025} / 7 / 1, year{2025} / 7 / 31), 999);
+    EXPECT_EQ(store->get_total_misc(0, year{2025} / 7 / 7, year{2025} / 7 / 13), 999);
+
+    // Counters that are no longer reported leave the rollups too.
+    record.misc_stats = {999, 0, 0, 0, 0, 0};
+    store->save_today(record);
+    EXPECT_EQ(store->get_total_misc(1, year{2025} / 7 / 1, year{2025} / 7 / 31), 0);
+
+    EXPECT_TRUE(store->delete_all());
+    EXPECT_EQ(count_rows("stats_misc_week"), 0);
+    EXPECT_EQ(count_rows("stats_misc_month"), 0);
+  }
+
+  //! A database from before the rollups gets them built when it is opened.
+  TEST_F(SqliteStoreTest, rollups_are_built_for_older_databases)
+  {
+    using namespace std::chrono;
+
+    append_days(sqlite_store(), year{2025} / 6 / 20, year{2025} / 8 / 10);
+
+    execute("DROP TABLE stats_misc_week;"
+            "DROP TABLE stats_misc_month;"
+            "UPDATE schema_info SET value = '1' WHERE key = 'schema_version';");
+
+    auto store = sqlite_store();
+    EXPECT_EQ(query_int("SELECT value FROM schema_info WHERE key = 'schema_version'"), 3);
+    EXPECT_EQ(store->get_total_misc(0, year{2025} / 7 / 1, year{2025} / 7 / 31), 3100);
+    EXPECT_EQ(store->get_total_misc(0, year{2025} / 6 / 1, year{2025} / 8 / 31), 5200);
+  }
+
+  //! Days written by an older Workrave, which knows nothing of the rollups,
+  //! are counted in them all the same.
+  TEST_F(SqliteStoreTest, rollups_count_days_written_after_downgrade)
+  {
+    using namespace std::chrono;
+
+    append_days(sqlite_store(), year{2025} / 7 / 1, year{2025} / 7 / 31);
+
+    execute("PRAGMA foreign_keys = ON;"
+            "UPDATE stats_misc SET value = 300 WHERE counter = 0 AND day = '2025-07-15';"
+            "DELETE FROM stats_day WHERE day = '2025-07-31';");
+
+    auto store = sqlite_store();
+    EXPECT_EQ(store->get_total_misc(0, year{2025} / 7 / 1, year{2025} / 7 / 31), 3200);
+    EXPECT_EQ(store->get_total_misc(0, year{2025} / 7 / 14, year{2025} / 7 / 20), 900);
+    EXPECT_EQ(query_int("SELECT COUNT(*) FROM stats_misc_month WHERE value <> 0"), 6);
+  }
+
+  //! A schema version that is not a number must not stop the database from opening.
+  TEST_F(SqliteStoreTest, unreadable_schema_version)
+  {
+    using namespace std::chrono;
+
+    append_days(sqlite_store(), year{2025} / 7 / 1, year{2025} / 7 / 31);
+
+    execute("UPDATE schema_info SET value = 'two' WHERE key = 'schema_version';"
+            "DELETE FROM stats_misc_month;");
+
+    auto store = sqlite_store();
+    EXPECT_EQ(query_int("SELECT value FROM schema_info WHERE key = 'schema_version'"), 3);
+    EXPECT_EQ(store->get_total_misc(0, year{2025} / 7 / 1, year{2025} / 7 / 31), 3100);
+  }
+
   //! Working past midnight leaves a day whose stop time is on the next date.
   TEST_F(SqliteStoreTest, day_crossing_midnight)
   {
@@ -277,7 +533,7 @@ namespace
     ASSERT_TRUE(today.has_value());
     EXPECT_EQ(today->date(), reference_date(14));
     EXPECT_EQ(today->misc_stats[0], 100);
-    EXPECT_EQ(today->break_stats[3][6], 28);
+    EXPECT_EQ(today->get_break(3, 6), 28);
   }
 
   //! Downgrading to an older Workrave must not mean losing everything: the text
@@ -346,6 +602,21 @@ namespace
     EXPECT_EQ(history[1].date(), reference_date(13));
   }
 
+  //! A history longer than a single import batch arrives complete.
+  TEST_F(MigrationTest, import_large_history)
+  {
+    const int count = 1000;
+    write("historystats", make_long_history(count));
+
+    auto history = sqlite_store()->load_history();
+    ASSERT_EQ(history.size(), static_cast<size_t>(count));
+    EXPECT_EQ(history.front().date(), reference_date(12));
+    EXPECT_EQ(history.back().misc_stats[0], count - 1);
+
+    // Nothing changed, so nothing is imported again.
+    EXPECT_EQ(sqlite_store()->load_history().size(), static_cast<size_t>(count));
+  }
+
   //! Statistics from before the import must survive it.
   TEST_F(MigrationTest, import_does_not_lose_counters)
   {
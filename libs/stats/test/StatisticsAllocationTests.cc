@@ -0,0 +1,117 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+// Counts heap allocations by replacing the global operator new, which is why
+// this test has a binary of its own.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <string>
+
+#include <unistd.h>
+
+#include "utils/Paths.hh"
+
+#include "Statistics.hh"
+
+using namespace workrave::stats;
+
+namespace
+{
+  //! Heap allocations made by the current thread.
+  thread_local int64_t allocation_count = 0;
+} // namespace
+
+void *
+operator new(std::size_t size)
+{
+  allocation_count++;
+  if (void *p = std::malloc(size == 0 ? 1 : size))
+    {
+      return p;
+    }
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void *p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+namespace
+{
+  class StatisticsAllocationTest : public ::testing::Test
+  {
+  protected:
+    StatisticsAllocationTest()
+    {
+      directory = std::filesystem::temp_directory_path() / ("workrave-stats-allocation-test-" + std::to_string(::getpid()));
+      std::filesystem::remove_all(directory);
+      workrave::utils::Paths::set_portable_directory(directory.string());
+    }
+
+    ~StatisticsAllocationTest() override
+    {
+      std::filesystem::remove_all(directory);
+    }
+
+    StatisticsAllocationTest(const StatisticsAllocationTest &) = delete;
+    StatisticsAllocationTest &operator=(const StatisticsAllocationTest &) = delete;
+    StatisticsAllocationTest(StatisticsAllocationTest &&) = delete;
+    StatisticsAllocationTest &operator=(StatisticsAllocationTest &&) = delete;
+
+    std::filesystem::path directory;
+  };
+
+  //! Saving the day in progress, which converts it with Statistics::to_record(),
+  //! must not touch the heap once the store is warmed up.
+  TEST_F(StatisticsAllocationTest, save_does_not_allocate)
+  {
+    auto statistics = std::make_shared<Statistics>([] { return false; });
+    statistics->init();
+    statistics->save();
+
+    const int64_t before = allocation_count;
+
+    for (int64_t i = 1; i <= 10; i++)
+      {
+        statistics->total_active_time().set(std::chrono::seconds{i});
+        statistics->total_overdue(workrave::BREAK_ID_REST_BREAK).set(std::chrono::seconds{2 * i});
+        statistics->save();
+      }
+
+    EXPECT_EQ(allocation_count - before, 0);
+
+    const Date today = date_of(local_now());
+    EXPECT_EQ(statistics->get_total_active_time(today, today), std::chrono::seconds{10});
+  }
+} // namespace
@@ -66,6 +66,32 @@ namespace workrave::stats::test
     return std::chrono::year{2025} / 7 / mday;
   }
 
+  //! A historystats of consecutive days from the reference day on, the i-th
+  //! day holding i in misc counter 0.
+  inline std::string make_long_history(int count)
+  {
+    using namespace std::chrono;
+
+    std::ostringstream text;
+    text << "WorkRaveStats 4\n";
+
+    sys_days day{reference_date()};
+    for (int i = 0; i < count; i++, day += days{1})
+      {
+        const year_month_day date{day};
+        const unsigned mday = static_cast<unsigned>(date.day());
+        const unsigned mon = static_cast<unsigned>(date.month()) - 1;
+        const int year = static_cast<int>(date.year()) - 1900;
+
+        text << "D " << mday << " " << mon << " " << year << " 9 15 " << mday << " " << mon << " " << year << " 17 42\n"
+             << "B 0 7 1 2 3 4 5 6 7 \n"
+             << "B 1 7 8 9 10 11 12 13 14 \n"
+             << "m 6 " << i << " 200 300 400 500 600 \n";
+      }
+
+    return text.str();
+  }
+
   //! The reference day, optionally moved to another day of the month.
   inline DailyStatsRecord make_record(int mday = 12)
   {
@@ -75,14 +101,13 @@ namespace workrave::stats::test
     record.start = to_local_time(reference_date(mday), hours{9} + minutes{15});
     record.stop = to_local_time(reference_date(mday), hours{17} + minutes{42});
 
-    record.break_stats.resize(4);
+    // Four breaks, one more than Workrave knows about, of seven counters each.
     int64_t value = 1;
-    for (auto &break_stats: record.break_stats)
+    for (size_t break_id = 0; break_id < 4; break_id++)
       {
-        break_stats.resize(7);
-        for (auto &counter: break_stats)
+        for (size_t counter = 0; counter < 7; counter++)
           {
-            counter = value++;
+            record.set_break(break_id, counter, value++);
           }
       }
 
@@ -206,6 +231,50 @@ namespace workrave::stats::test
     EXPECT_FALSE(store->load_date(gap).has_value());
   }
 
+  //! load_range(), which both stores must answer the same way.
+  template<typename Store>
+  inline void check_load_range(const std::shared_ptr<Store> &store)
+  {
+    // Counters that are zero are not stored, so this day has two breaks and one miscellaneous counter.
+    DailyStatsRecord shorter = make_record(14);
+    shorter.extra_counters.clear();
+    shorter.break_stats[2] = {};
+    shorter.misc_stats = {50, 0, 0, 0, 0, 0};
+
+    store->append_history(make_record(12));
+    store->append_history(shorter);
+    store->save_today(make_record(16));
+
+    DailyStatsColumns columns = store->load_range(reference_date(12), reference_date(16));
+    ASSERT_EQ(columns.dates.size(), 3U);
+    EXPECT_EQ(columns.dates[0], reference_date(12));
+    EXPECT_EQ(columns.dates[1], reference_date(14));
+    EXPECT_EQ(columns.dates[2], reference_date(16));
+
+    ASSERT_EQ(columns.misc_stats.size(), 6U);
+    EXPECT_EQ(columns.misc_stats[0], (std::vector<int64_t>{100, 50, 100}));
+    EXPECT_EQ(columns.misc_stats[5], (std::vector<int64_t>{600, 0, 600}));
+
+    // Reference day has break 3 as [22, ..., 28]; the shorter day has no break 3 at all.
+    ASSERT_EQ(columns.break_stats.size(), 4U);
+    ASSERT_EQ(columns.break_stats[0].size(), 7U);
+    ASSERT_EQ(columns.break_stats[3].size(), 7U);
+    EXPECT_EQ(columns.break_stats[3][6], (std::vector<int64_t>{28, 0, 28}));
+    EXPECT_EQ(columns.break_stats[0][0], (std::vector<int64_t>{1, 1, 1}));
+
+    columns = store->load_range(reference_date(13), reference_date(15));
+    ASSERT_EQ(columns.dates.size(), 1U);
+    EXPECT_EQ(columns.dates[0], reference_date(14));
+    ASSERT_EQ(columns.break_stats.size(), 2U);
+    ASSERT_EQ(columns.misc_stats.size(), 1U);
+    EXPECT_EQ(columns.misc_stats[0], (std::vector<int64_t>{50}));
+
+    columns = store->load_range(std::chrono::year{2025} / 8 / 1, std::chrono::year{2025} / 8 / std::chrono::last);
+    EXPECT_TRUE(columns.dates.empty());
+    EXPECT_TRUE(columns.break_stats.empty());
+    EXPECT_TRUE(columns.misc_stats.empty());
+  }
+
   //! set_break_counter() must take effect on today immediately, without a
   //! save_today() in between.
   inline void check_break_counter_updates(const IStatisticsStore::Ptr &store)
@@ -224,8 +293,8 @@ namespace workrave::stats::test
 
     today = store->load_today();
     ASSERT_TRUE(today.has_value());
-    ASSERT_GT(today->break_stats[workrave::BREAK_ID_DAILY_LIMIT].size(), 7U);
-    EXPECT_EQ(today->break_stats[workrave::BREAK_ID_DAILY_LIMIT][7], 3);
+    ASSERT_GT(today->counter_count(workrave::BREAK_ID_DAILY_LIMIT), 7U);
+    EXPECT_EQ(today->get_break(workrave::BREAK_ID_DAILY_LIMIT, 7), 3);
   }
 
   //! Without a day in progress there is nothing to update.
@@ -0,0 +1,41 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef WORKRAVE_LIBS_UTILS_ATOMICFILE_HH
+#define WORKRAVE_LIBS_UTILS_ATOMICFILE_HH
+
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+
+namespace workrave::utils
+{
+  //! Replaces files so that a crash leaves either the old or the new contents.
+  /*!
+   *  The contents go to a temporary file next to the target, which is
+   *  flushed to disk and then renamed over the target. The directory is
+   *  flushed as well, so the rename itself survives a crash.
+   */
+  class AtomicFile
+  {
+  public:
+    //! Replaces the file at path by contents. On failure, sets ec and leaves the file as it was.
+    static bool write(const std::filesystem::path &path, std::string_view contents, std::error_code &ec);
+  };
+} // namespace workrave::utils
+
+#endif // WORKRAVE_LIBS_UTILS_ATOMICFILE_HH
@@ -0,0 +1,62 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef WORKRAVE_LIBS_UTILS_SNAPSHOTFILE_HH
+#define WORKRAVE_LIBS_UTILS_SNAPSHOTFILE_HH
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace workrave::utils
+{
+  //! A small binary file of named rows of integers.
+  /*!
+   *  The file starts with a magic and a format version, and ends with a
+   *  CRC-32 of everything before it. It is replaced through AtomicFile, and
+   *  read back with a single read. A
+   *  file that was cut short or otherwise damaged fails the checksum and is
+   *  rejected as a whole, never half applied.
+   */
+  class SnapshotFile
+  {
+  public:
+    struct Record
+    {
+      std::string id;
+      std::vector<int64_t> values;
+
+      bool operator==(const Record &other) const = default;
+    };
+
+    //! The largest file read back; far more than any snapshot needs.
+    static constexpr size_t MAX_SIZE = 64 * 1024;
+
+    //! Replaces the file at path with the records. Returns false on failure, leaving the old file in place.
+    static bool write(const std::filesystem::path &path, const std::vector<Record> &records);
+
+    //! The records of the file at path, or nullopt if it is missing, damaged or of an unknown version.
+    static std::optional<std::vector<Record>> read(const std::filesystem::path &path);
+
+    //! The CRC-32 (IEEE 802.3) of a buffer.
+    static uint32_t crc32(const uint8_t *data, size_t size);
+  };
+} // namespace workrave::utils
+
+#endif // WORKRAVE_LIBS_UTILS_SNAPSHOTFILE_HH
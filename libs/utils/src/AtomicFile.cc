@@ -0,0 +1,127 @@
+// Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "utils/AtomicFile.hh"
+
+#include <cerrno>
+#include <cstdio>
+
+#if defined(PLATFORM_OS_WINDOWS)
+#  include <io.h>
+#else
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+  bool
+  flush_to_disk(std::FILE *file)
+  {
+    if (std::fflush(file) != 0)
+      {
+        return false;
+      }
+#if defined(PLATFORM_OS_WINDOWS)
+    return _commit(_fileno(file)) == 0;
+#else
+    return ::fsync(::fileno(file)) == 0;
+#endif
+  }
+
+  //! Makes a rename in dir survive a crash.
+  void
+  flush_directory(const std::filesystem::path &dir)
+  {
+#if !defined(PLATFORM_OS_WINDOWS)
+    const int fd = ::open(dir.empty() ? "." : dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0)
+      {
+        ::fsync(fd);
+        ::close(fd);
+      }
+#else
+    (void)dir;
+#endif
+  }
+
+  std::error_code
+  last_error()
+  {
+    return {errno != 0 ? errno : EIO, std::generic_category()};
+  }
+} // namespace
+
+namespace workrave::utils
+{
+  bool
+  AtomicFile::write(const std::filesystem::path &path, std::string_view contents, std::error_code &ec)
+  {
+    ec.clear();
+
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+
+    errno = 0;
+    std::FILE *file = std::fopen(temp.string().c_str(), "wb");
+    if (file == nullptr)
+      {
+        ec = last_error();
+        return false;
+      }
+
+    bool ok = std::fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    ok = flush_to_disk(file) && ok;
+    if (!ok)
+      {
+        ec = last_error();
+      }
+    if (std::fclose(file) != 0 && ok)
+      {
+        ec = last_error();
+        ok = false;
+      }
+
+    if (ok)
+      {
+        // Keep the permissions of the file that is replaced.
+        std::error_code status_ec;
+        const auto status = std::filesystem::status(path, status_ec);
+        if (std::filesystem::exists(status))
+          {
+            std::filesystem::permissions(temp, status.permissions(), status_ec);
+          }
+
+        std::filesystem::rename(temp, path, ec);
+        ok = !ec;
+      }
+
+    if (!ok)
+      {
+        std::error_code remove_ec;
+        std::filesystem::remove(temp, remove_ec);
+        return false;
+      }
+
+    flush_directory(path.parent_path());
+    return true;
+  }
+} // namespace workrave::utils
@@ -0,0 +1,275 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "utils/SnapshotFile.hh"
+
+#include <array>
+#include <fstream>
+#include <limits>
+#include <string_view>
+#include <system_error>
+
+#include "utils/AtomicFile.hh"
+
+#include <spdlog/spdlog.h>
+
+namespace
+{
+  const std::array<uint8_t, 4> MAGIC{'W', 'R', 'S', 'N'};
+  const uint32_t FORMAT_VERSION = 1;
+
+  //! Encodes integers little-endian, whatever the byte order of the host.
+  class Writer
+  {
+  public:
+    void put_u8(uint8_t value)
+    {
+      buffer.push_back(value);
+    }
+
+    void put_u32(uint32_t value)
+    {
+      for (int i = 0; i < 4; i++)
+        {
+          buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    void put_i64(int64_t value)
+    {
+      const auto bits = static_cast<uint64_t>(value);
+      for (int i = 0; i < 8; i++)
+        {
+          buffer.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+        }
+    }
+
+    void put_bytes(const uint8_t *data, size_t size)
+    {
+      buffer.insert(buffer.end(), data, data + size);
+    }
+
+    std::vector<uint8_t> buffer;
+  };
+
+  //! Decodes what Writer encoded, failing rather than reading past the end.
+  class Reader
+  {
+  public:
+    Reader(const uint8_t *data, size_t size)
+      : data(data)
+      , size(size)
+    {
+    }
+
+    bool get_u8(uint8_t &value)
+    {
+      if (!has(1))
+        {
+          return false;
+        }
+      value = data[pos++];
+      return true;
+    }
+
+    bool get_u32(uint32_t &value)
+    {
+      if (!has(4))
+        {
+          return false;
+        }
+      value = 0;
+      for (int i = 0; i < 4; i++)
+        {
+          value |= static_cast<uint32_t>(data[pos++]) << (8 * i);
+        }
+      return true;
+    }
+
+    bool get_i64(int64_t &value)
+    {
+      if (!has(8))
+        {
+          return false;
+        }
+      uint64_t bits = 0;
+      for (int i = 0; i < 8; i++)
+        {
+          bits |= static_cast<uint64_t>(data[pos++]) << (8 * i);
+        }
+      value = static_cast<int64_t>(bits);
+      return true;
+    }
+
+    bool get_string(std::string &value, size_t length)
+    {
+      if (!has(length))
+        {
+          return false;
+        }
+      value.assign(reinterpret_cast<const char *>(data + pos), length);
+      pos += length;
+      return true;
+    }
+
+    [[nodiscard]] bool at_end() const
+    {
+      return pos == size;
+    }
+
+  private:
+    [[nodiscard]] bool has(size_t count) const
+    {
+      return size - pos >= count;
+    }
+
+  private:
+    const uint8_t *data;
+    size_t size;
+    size_t pos{0};
+  };
+} // namespace
+
+namespace workrave::utils
+{
+  uint32_t
+  SnapshotFile::crc32(const uint8_t *data, size_t size)
+  {
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < size; i++)
+      {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+          {
+            crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+          }
+      }
+    return ~crc;
+  }
+
+  bool
+  SnapshotFile::write(const std::filesystem::path &path, const std::vector<Record> &records)
+  {
+    Writer writer;
+    writer.put_bytes(MAGIC.data(), MAGIC.size());
+    writer.put_u32(FORMAT_VERSION);
+    writer.put_u32(static_cast<uint32_t>(records.size()));
+
+    for (const Record &record: records)
+      {
+        if (record.id.size() > std::numeric_limits<uint8_t>::max() || record.values.size() > std::numeric_limits<uint8_t>::max())
+          {
+            spdlog::error("snapshot record {} is too large", record.id);
+            return false;
+          }
+
+        writer.put_u8(static_cast<uint8_t>(record.id.size()));
+        writer.put_bytes(reinterpret_cast<const uint8_t *>(record.id.data()), record.id.size());
+        writer.put_u8(static_cast<uint8_t>(record.values.size()));
+        for (int64_t value: record.values)
+          {
+            writer.put_i64(value);
+          }
+      }
+
+    writer.put_u32(crc32(writer.buffer.data(), writer.buffer.size()));
+
+    std::error_code ec;
+    const std::string_view contents(reinterpret_cast<const char *>(writer.buffer.data()), writer.buffer.size());
+    if (!AtomicFile::write(path, contents, ec))
+      {
+        spdlog::warn("failed to replace {}: {}", path.string(), ec.message());
+        return false;
+      }
+    return true;
+  }
+
+  std::optional<std::vector<SnapshotFile::Record>>
+  SnapshotFile::read(const std::filesystem::path &path)
+  {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+      {
+        return std::nullopt;
+      }
+
+    std::vector<uint8_t> buffer(MAX_SIZE);
+    file.read(reinterpret_cast<char *>(buffer.data()), buffer.size());
+    const auto size = static_cast<size_t>(file.gcount());
+
+    if (size < MAGIC.size() + 12 || size == buffer.size())
+      {
+        spdlog::warn("ignoring {}: unexpected size", path.string());
+        return std::nullopt;
+      }
+
+    Reader checksum_reader(buffer.data() + size - 4, 4);
+    uint32_t checksum = 0;
+    if (!checksum_reader.get_u32(checksum) || checksum != crc32(buffer.data(), size - 4))
+      {
+        spdlog::warn("ignoring {}: checksum mismatch", path.string());
+        return std::nullopt;
+      }
+
+    Reader reader(buffer.data(), size - 4);
+
+    std::array<uint8_t, 4> magic{};
+    uint32_t version = 0;
+    uint32_t count = 0;
+    for (uint8_t &byte: magic)
+      {
+        reader.get_u8(byte);
+      }
+    if (magic != MAGIC || !reader.get_u32(version) || version != FORMAT_VERSION || !reader.get_u32(count))
+      {
+        spdlog::warn("ignoring {}: unknown format", path.string());
+        return std::nullopt;
+      }
+
+    std::vector<Record> records;
+    for (uint32_t i = 0; i < count; i++)
+      {
+        Record record;
+        uint8_t id_length = 0;
+        uint8_t value_count = 0;
+        if (!reader.get_u8(id_length) || !reader.get_string(record.id, id_length) || !reader.get_u8(value_count))
+          {
+            return std::nullopt;
+          }
+
+        record.values.resize(value_count);
+        for (int64_t &value: record.values)
+          {
+            if (!reader.get_i64(value))
+              {
+                return std::nullopt;
+              }
+          }
+        records.push_back(std::move(record));
+      }
+
+    if (!reader.at_end())
+      {
+        return std::nullopt;
+      }
+    return records;
+  }
+} // namespace workrave::utils
@@ -0,0 +1,146 @@
+// Copyright (C) 2026 Rob Caelers
+// All rights reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/SnapshotFile.hh"
+
+using namespace workrave::utils;
+
+class SnapshotFileTest : public ::testing::Test
+{
+protected:
+  SnapshotFileTest()
+  {
+    std::string name = "workrave-snapshot-test";
+    const auto *info = ::testing::UnitTest::GetInstance()->current_test_info();
+    if (info != nullptr)
+      {
+        name += std::string("-") + info->name();
+      }
+    directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    path = directory / "state.bin";
+  }
+
+  ~SnapshotFileTest() override
+  {
+    std::filesystem::remove_all(directory);
+  }
+
+  SnapshotFileTest(const SnapshotFileTest &) = delete;
+  SnapshotFileTest &operator=(const SnapshotFileTest &) = delete;
+  SnapshotFileTest(SnapshotFileTest &&) = delete;
+  SnapshotFileTest &operator=(SnapshotFileTest &&) = delete;
+
+  std::string read_raw() const
+  {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  }
+
+  void write_raw(const std::string &data) const
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << data;
+  }
+
+  std::filesystem::path directory;
+  std::filesystem::path path;
+};
+
+namespace
+{
+  std::vector<SnapshotFile::Record> make_records()
+  {
+    return {{"micro_pause", {1700000000, 120, 1699999000, 0, 1, -1, 0, 3600}},
+            {"rest_break", {1700000000, -5, 1699990000, 42, 0, 1699000000, 7, 3600}},
+            {"daily_limit", {}}};
+  }
+} // namespace
+
+TEST_F(SnapshotFileTest, round_trip)
+{
+  ASSERT_TRUE(SnapshotFile::write(path, make_records()));
+
+  auto records = SnapshotFile::read(path);
+  ASSERT_TRUE(records.has_value());
+  EXPECT_EQ(records.value(), make_records());
+  EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+}
+
+TEST_F(SnapshotFileTest, overwrite_replaces_previous)
+{
+  ASSERT_TRUE(SnapshotFile::write(path, make_records()));
+
+  std::vector<SnapshotFile::Record> records{{"micro_pause", {1, 2, 3}}};
+  ASSERT_TRUE(SnapshotFile::write(path, records));
+  EXPECT_EQ(SnapshotFile::read(path), records);
+}
+
+TEST_F(SnapshotFileTest, missing_file)
+{
+  EXPECT_FALSE(SnapshotFile::read(path).has_value());
+}
+
+TEST_F(SnapshotFileTest, truncated_file_is_rejected)
+{
+  ASSERT_TRUE(SnapshotFile::write(path, make_records()));
+  std::string data = read_raw();
+
+  for (size_t size = 0; size < data.size(); size++)
+    {
+      write_raw(data.substr(0, size));
+      EXPECT_FALSE(SnapshotFile::read(path).has_value()) << "size " << size;
+    }
+}
+
+TEST_F(SnapshotFileTest, corrupted_file_is_rejected)
+{
+  ASSERT_TRUE(SnapshotFile::write(path, make_records()));
+  std::string data = read_raw();
+
+  for (size_t offset = 0; offset < data.size(); offset++)
+    {
+      std::string damaged = data;
+      damaged[offset] = static_cast<char>(damaged[offset] ^ 0x10);
+      write_raw(damaged);
+      EXPECT_FALSE(SnapshotFile::read(path).has_value()) << "offset " << offset;
+    }
+}
+
+TEST_F(SnapshotFileTest, text_file_is_rejected)
+{
+  write_raw("WorkRaveState 3\nmicro_pause 1700000000 120\n");
+  EXPECT_FALSE(SnapshotFile::read(path).has_value());
+}
+
+TEST_F(SnapshotFileTest, crc32_check_value)
+{
+  const std::string check = "123456789";
+  EXPECT_EQ(SnapshotFile::crc32(reinterpret_cast<const uint8_t *>(check.data()), check.size()), 0xCBF43926U);
+}
@@ -163,6 +163,8 @@ Application::main()
   init_platform_post();
 
   connect(toolkit->signal_timer(), this, [this] { on_timer(); });
+  connect(core->signal_heartbeat_needed(), this, [this] { toolkit->trigger_timer(); });
+  connect(core->signal_rpc_calls_pending(), this, [this] { toolkit->post([this] { core->dispatch_rpc_calls(); }); });
   connect(toolkit->signal_session_idle_changed(), this, [this](auto idle) { on_idle_changed(idle); });
   connect(toolkit->signal_main_window_closed(), this, [this] { on_main_window_closed(); });
   connect(toolkit->signal_status_icon_activated(), this, [this] { on_status_icon_activate(); });
@@ -664,6 +666,7 @@ Application::on_timer()
   std::string tip = get_timers_tooltip();
 
   core->heartbeat();
+  toolkit->set_timer_delay(core->get_next_heartbeat_delay());
 
   // TODO: tip changed.
   // applet_control->set_tooltip(tip);
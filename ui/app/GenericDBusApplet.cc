@@ -23,6 +23,8 @@
 
 #include "GenericDBusApplet.hh"
 
+#include <algorithm>
+
 #include "ui/TimerBoxControl.hh"
 #include "ui/GUIConfig.hh"
 #include "commonui/Text.hh"
@@ -34,6 +36,7 @@ GenericDBusApplet::GenericDBusApplet(std::shared_ptr<IPluginContext> context)
   , menu_model(context->get_menu_model())
   , menu_helper(menu_model)
   , apphold(context->get_toolkit())
+  , timer_refresh(context->get_toolkit())
 {
   TRACE_ENTRY();
 
@@ -49,6 +52,7 @@ GenericDBusApplet::GenericDBusApplet(std::shared_ptr<IPluginContext> context)
       i.bar_secondary_val = 0;
       i.bar_secondary_max = 0;
     }
+  sent_data = data;
 
   GUIConfig::trayicon_enabled().connect(this, [this](bool) { send_tray_icon_enabled(); });
 
@@ -66,6 +70,12 @@ GenericDBusApplet::signal_timers_updated()
   return timers_updated_signal;
 }
 
+boost::signals2::signal<void(GenericDBusApplet::TimerChanges)> &
+GenericDBusApplet::signal_timers_changed()
+{
+  return timers_changed_signal;
+}
+
 boost::signals2::signal<void(GenericDBusApplet::MenuItems)> &
 GenericDBusApplet::signal_menu_updated()
 {
@@ -138,7 +148,34 @@ void
 GenericDBusApplet::update_view()
 {
   TRACE_ENTRY();
-  timers_updated_signal(data[BREAK_ID_MICRO_BREAK], data[BREAK_ID_REST_BREAK], data[BREAK_ID_DAILY_LIMIT]);
+  const bool all_changes_enabled = !active_bus_names.empty()
+                                   && std::all_of(active_bus_names.begin(), active_bus_names.end(), [this](const std::string &name) {
+                                        return timer_changes_senders.contains(name);
+                                      });
+  if (!all_changes_enabled)
+    {
+      timers_updated_signal(data[BREAK_ID_MICRO_BREAK], data[BREAK_ID_REST_BREAK], data[BREAK_ID_DAILY_LIMIT]);
+    }
+
+  if (timer_changes_senders.empty())
+    {
+      return;
+    }
+
+  TimerChanges changes;
+  for (uint32_t i = 0; i < data.size(); i++)
+    {
+      if (data[i] != sent_data[i])
+        {
+          changes.push_back(TimerChange{i, data[i]});
+          sent_data[i] = data[i];
+        }
+    }
+
+  if (!changes.empty())
+    {
+      timers_changed_signal(changes);
+    }
 }
 
 void
@@ -154,26 +191,25 @@ void
 GenericDBusApplet::applet_embed(bool enabled, const std::string &sender)
 {
   TRACE_ENTRY_PAR(enabled, sender);
-  embedded = enabled;
-
-  name_watches.clear();
-  active_bus_names.clear();
+  timer_changes_senders.erase(sender);
 
-  if (!sender.empty())
+  if (enabled)
     {
-      if (name_watcher)
+      embedded = true;
+      if (!sender.empty() && name_watcher)
         {
-          name_watches.emplace(sender,
-                               name_watcher(sender, [this, sender](bool present) { bus_name_presence(sender, present); }));
+          if (!name_watches.contains(sender))
+            {
+              name_watches.emplace(sender,
+                                   name_watcher(sender, [this, sender](bool present) { bus_name_presence(sender, present); }));
+            }
           bus_name_presence(sender, true);
         }
     }
-
-  if (!enabled)
+  else
     {
-      TRACE_MSG("Disabling");
-      apphold.release();
-      visible = false;
+      name_watches.erase(sender);
+      bus_name_presence(sender, false);
     }
 }
 
@@ -191,6 +227,32 @@ GenericDBusApplet::get_tray_icon_enabled(bool &enabled) const
   enabled = GUIConfig::applet_icon_enabled()();
 }
 
+void
+GenericDBusApplet::get_timers(TimerData &micro, TimerData &rest, TimerData &daily) const
+{
+  micro = data[BREAK_ID_MICRO_BREAK];
+  rest = data[BREAK_ID_REST_BREAK];
+  daily = data[BREAK_ID_DAILY_LIMIT];
+}
+
+void
+GenericDBusApplet::set_timer_changes_enabled(bool enabled, const std::string &sender)
+{
+  TRACE_ENTRY_PAR(enabled, sender);
+  if (enabled)
+    {
+      timer_changes_senders.insert(sender);
+    }
+  else
+    {
+      timer_changes_senders.erase(sender);
+    }
+
+  // The applet fetches the full frame with GetTimers after enabling; changes
+  // are relative to what it holds from then on.
+  sent_data = data;
+}
+
 void
 GenericDBusApplet::applet_command(int command)
 {
@@ -231,17 +293,20 @@ GenericDBusApplet::bus_name_presence(const std::string &name, bool present)
           TRACE_MSG("Enabling");
           visible = true;
           apphold.hold();
+          timer_refresh.hold();
         }
     }
   else
     {
       active_bus_names.erase(name);
+      timer_changes_senders.erase(name);
       if (active_bus_names.empty())
         {
           TRACE_MSG("Disabling");
           visible = false;
           embedded = false;
           apphold.release();
+          timer_refresh.release();
         }
     }
 }
@@ -30,6 +30,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <boost/signals2/signal.hpp>
 
@@ -40,6 +41,7 @@
 #include "ui/TimerBoxControl.hh"
 #include "utils/Signals.hh"
 #include "ui/AppHold.hh"
+#include "ui/TimerRefreshHold.hh"
 #include "ui/Plugin.hh"
 
 #if defined(HAVE_DBUS)
@@ -71,8 +73,20 @@ public:
     uint32_t bar_primary_color;
     uint32_t bar_primary_val;
     uint32_t bar_primary_max;
+
+    bool operator==(const TimerData &other) const = default;
   };
 
+  // One timer of a TimersChanged delta; `timer` indexes the frame returned by
+  // GetTimers and sent by TimersUpdated.
+  struct TimerChange
+  {
+    uint32_t timer{};
+    TimerData data;
+  };
+
+  using TimerChanges = std::vector<TimerChange>;
+
   struct MenuItem
   {
     MenuItem() = default;
@@ -128,9 +142,23 @@ public:
   // @rpc(name="GetTrayIconEnabled")
   // @rpc.param(enabled, dir=out)
   virtual void get_tray_icon_enabled(bool &enabled) const;
+  // @rpc(name="GetTimers")
+  // @rpc.param(micro, dir=out)
+  // @rpc.param(rest, dir=out)
+  // @rpc.param(daily, dir=out)
+  virtual void get_timers(TimerData &micro, TimerData &rest, TimerData &daily) const;
+  // Switches the applet that embedded as sender from a full TimersUpdated
+  // frame every tick to TimersChanged, which carries only the timers that
+  // changed and is not sent at all while nothing changes. TimersUpdated is
+  // still sent while any other embedded applet has not switched. Reset by
+  // Embed from the same sender.
+  // @rpc(name="SetTimerChangesEnabled")
+  virtual void set_timer_changes_enabled(bool enabled, const std::string &sender);
 
   // @rpc.signal(name="TimersUpdated", fields="micro,rest,daily")
   boost::signals2::signal<void(TimerData, TimerData, TimerData)> &signal_timers_updated();
+  // @rpc.signal(name="TimersChanged", fields="timers")
+  boost::signals2::signal<void(TimerChanges)> &signal_timers_changed();
   // @rpc.signal(name="MenuUpdated", fields="menuitems")
   boost::signals2::signal<void(MenuItems)> &signal_menu_updated();
   // @rpc.signal(name="MenuItemUpdated", fields="menuitem")
@@ -171,9 +199,12 @@ private:
   MenuModel::Ptr menu_model;
   MenuHelper menu_helper;
   AppHold apphold;
+  TimerRefreshHold timer_refresh;
   bool visible{false};
   bool embedded{false};
   std::array<TimerData, workrave::BREAK_ID_SIZEOF> data;
+  std::array<TimerData, workrave::BREAK_ID_SIZEOF> sent_data;
+  std::set<std::string> timer_changes_senders;
   std::set<std::string> active_bus_names;
 #if defined(HAVE_DBUS)
   NameWatcher name_watcher;
@@ -181,6 +212,7 @@ private:
 #endif
   std::shared_ptr<TimerBoxControl> control;
   boost::signals2::signal<void(TimerData, TimerData, TimerData)> timers_updated_signal;
+  boost::signals2::signal<void(TimerChanges)> timers_changed_signal;
   boost::signals2::signal<void(MenuItems)> menu_updated_signal;
   boost::signals2::signal<void(MenuItem)> menu_item_updated_signal;
   boost::signals2::signal<void(bool)> tray_icon_updated_signal;
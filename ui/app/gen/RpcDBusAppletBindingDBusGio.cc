@@ -10,6 +10,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -46,6 +47,15 @@ struct GioSignature<GenericDBusApplet::MenuItem>
   }
 };
 
+template<>
+struct GioFields<GenericDBusApplet::MenuItem>
+{
+  static auto tie(const GenericDBusApplet::MenuItem &value)
+  {
+    return std::tie(value.text, value.dynamic_text, value.action, value.command, value.type, value.flags);
+  }
+};
+
 template<>
 struct GioCodec<GenericDBusApplet::MenuItem>
 {
@@ -71,22 +81,8 @@ struct GioCodec<GenericDBusApplet::MenuItem>
 
   static GVariant *encode(const GenericDBusApplet::MenuItem &value)
   {
-    GVariant *fields[] = {
-
-      GioCodec<std::string>::encode(value.text),
-
-      GioCodec<std::string>::encode(value.dynamic_text),
-
-      GioCodec<std::string>::encode(value.action),
-
-      GioCodec<uint32_t>::encode(value.command),
-
-      GioCodec<uint8_t>::encode(value.type),
-
-      GioCodec<uint8_t>::encode(value.flags),
-
-    };
-    return g_variant_new_tuple(fields, 6);
+    return std::apply([](const auto &...fields) { return gio_encode_tuple(fields...); },
+                      GioFields<GenericDBusApplet::MenuItem>::tie(value));
   }
 };
 } // namespace workrave::rpc::dbus
@@ -121,6 +117,15 @@ struct GioSignature<GenericDBusApplet::TimerData>
   }
 };
 
+template<>
+struct GioFields<GenericDBusApplet::TimerData>
+{
+  static auto tie(const GenericDBusApplet::TimerData &value)
+  {
+    return std::tie(value.bar_text, value.slot, value.bar_secondary_color, value.bar_secondary_val, value.bar_secondary_max, value.bar_primary_color, value.bar_primary_val, value.bar_primary_max);
+  }
+};
+
 template<>
 struct GioCodec<GenericDBusApplet::TimerData>
 {
@@ -150,31 +155,65 @@ struct GioCodec<GenericDBusApplet::TimerData>
 
   static GVariant *encode(const GenericDBusApplet::TimerData &value)
   {
-    GVariant *fields[] = {
+    return std::apply([](const auto &...fields) { return gio_encode_tuple(fields...); },
+                      GioFields<GenericDBusApplet::TimerData>::tie(value));
+  }
+};
+} // namespace workrave::rpc::dbus
+
+namespace workrave::rpc::dbus
+{
+template<>
+struct GioSignature<GenericDBusApplet::TimerChange>
+{
+  static std::string value()
+  {
+    std::string result = "(";
 
-      GioCodec<std::string>::encode(value.bar_text),
+    result += GioSignature<uint32_t>::value();
 
-      GioCodec<int>::encode(value.slot),
+    result += GioSignature<GenericDBusApplet::TimerData>::value();
 
-      GioCodec<uint32_t>::encode(value.bar_secondary_color),
+    result += ")";
+    return result;
+  }
+};
 
-      GioCodec<uint32_t>::encode(value.bar_secondary_val),
+template<>
+struct GioFields<GenericDBusApplet::TimerChange>
+{
+  static auto tie(const GenericDBusApplet::TimerChange &value)
+  {
+    return std::tie(value.timer, value.data);
+  }
+};
 
-      GioCodec<uint32_t>::encode(value.bar_secondary_max),
+template<>
+struct GioCodec<GenericDBusApplet::TimerChange>
+{
+  static GenericDBusApplet::TimerChange decode(GVariant *variant)
+  {
+    gio_require_type(variant, GioSignature<GenericDBusApplet::TimerChange>::value());
+    GenericDBusApplet::TimerChange result{};
 
-      GioCodec<uint32_t>::encode(value.bar_primary_color),
+    result.timer = gio_decode_child<uint32_t>(variant, 0);
 
-      GioCodec<uint32_t>::encode(value.bar_primary_val),
+    result.data = gio_decode_child<GenericDBusApplet::TimerData>(variant, 1);
 
-      GioCodec<uint32_t>::encode(value.bar_primary_max),
+    return result;
+  }
 
-    };
-    return g_variant_new_tuple(fields, 8);
+  static GVariant *encode(const GenericDBusApplet::TimerChange &value)
+  {
+    return std::apply([](const auto &...fields) { return gio_encode_tuple(fields...); },
+                      GioFields<GenericDBusApplet::TimerChange>::tie(value));
   }
 };
 } // namespace workrave::rpc::dbus
 
 
+
+
 namespace workrave::ui::rpc
 {
 
@@ -193,6 +232,11 @@ org_workrave_AppletInterface::org_workrave_AppletInterface(::workrave::rpc::dbus
       emit_TimersUpdated(micro, rest, daily);
     }));
 
+  signal_connections_.emplace_back(implementation_.signal_timers_changed().connect(
+    [this](std::vector<GenericDBusApplet::TimerChange> timers) {
+      emit_TimersChanged(timers);
+    }));
+
   signal_connections_.emplace_back(implementation_.signal_menu_updated().connect(
     [this](std::list<GenericDBusApplet::MenuItem> menuitems) {
       emit_MenuUpdated(menuitems);
@@ -260,6 +304,24 @@ org_workrave_AppletInterface::introspection() const noexcept
 
   "    </method>\n"
 
+  "    <method name=\"GetTimers\">\n"
+
+  "      <arg type=\"(siuuuuuu)\" name=\"micro\" direction=\"out\" />\n"
+
+  "      <arg type=\"(siuuuuuu)\" name=\"rest\" direction=\"out\" />\n"
+
+  "      <arg type=\"(siuuuuuu)\" name=\"daily\" direction=\"out\" />\n"
+
+  "    </method>\n"
+
+  "    <method name=\"SetTimerChangesEnabled\">\n"
+
+  "      <arg type=\"b\" name=\"enabled\" direction=\"in\" />\n"
+
+  "      <arg type=\"s\" name=\"sender\" direction=\"in\" />\n"
+
+  "    </method>\n"
+
 
   "    <signal name=\"TimersUpdated\">\n"
 
@@ -271,6 +333,12 @@ org_workrave_AppletInterface::introspection() const noexcept
 
   "    </signal>\n"
 
+  "    <signal name=\"TimersChanged\">\n"
+
+  "      <arg type=\"a(u(siuuuuuu))\" name=\"timers\" />\n"
+
+  "    </signal>\n"
+
   "    <signal name=\"MenuUpdated\">\n"
 
   "      <arg type=\"a(sssuyy)\" name=\"menuitems\" />\n"
@@ -298,7 +366,7 @@ org_workrave_AppletInterface::dispatch(std::string_view method, GVariant *parame
 {
   using Method = void (org_workrave_AppletInterface::*)(GVariant *, GDBusMethodInvocation *);
   struct Entry { std::string_view name; Method method; };
-  static constexpr std::array<Entry, 6> methods = { {
+  static constexpr std::array<Entry, 8> methods = { {
 
     {.name = "Embed", .method = &org_workrave_AppletInterface::dispatch_Embed},
 
@@ -312,6 +380,10 @@ org_workrave_AppletInterface::dispatch(std::string_view method, GVariant *parame
 
     {.name = "GetTrayIconEnabled", .method = &org_workrave_AppletInterface::dispatch_GetTrayIconEnabled},
 
+    {.name = "GetTimers", .method = &org_workrave_AppletInterface::dispatch_GetTimers},
+
+    {.name = "SetTimerChangesEnabled", .method = &org_workrave_AppletInterface::dispatch_SetTimerChangesEnabled},
+
   } };
   for (const auto &entry: methods)
     {
@@ -527,55 +599,121 @@ org_workrave_AppletInterface::dispatch_GetTrayIconEnabled(GVariant *parameters,
 
 
 void
-org_workrave_AppletInterface::emit_TimersUpdated(GenericDBusApplet::TimerData micro, GenericDBusApplet::TimerData rest, GenericDBusApplet::TimerData daily)
+org_workrave_AppletInterface::dispatch_GetTimers(GVariant *parameters, GDBusMethodInvocation *invocation)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
+  if (parameters == nullptr || !g_variant_is_of_type(parameters, G_VARIANT_TYPE_TUPLE)
+      || g_variant_n_children(parameters) != 0)
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::invalid_args),
+        "Incorrect number of input parameters for org.workrave.AppletInterface.GetTimers");
+    }
 
-  values.push_back(::workrave::rpc::dbus::GioCodec<GenericDBusApplet::TimerData>::encode(micro));
+  GenericDBusApplet::TimerData p_micro{};
 
-  values.push_back(::workrave::rpc::dbus::GioCodec<GenericDBusApplet::TimerData>::encode(rest));
 
-  values.push_back(::workrave::rpc::dbus::GioCodec<GenericDBusApplet::TimerData>::encode(daily));
+  GenericDBusApplet::TimerData p_rest{};
 
-  server_.emit_signal(path_, "org.workrave.AppletInterface", "TimersUpdated",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+
+  GenericDBusApplet::TimerData p_daily{};
+
+
+
+  implementation_.get_timers(p_micro, p_rest, p_daily);
+
+
+  std::vector<GVariant *> reply_values;
+  ::workrave::rpc::dbus::GioUnixFdList reply_fd_list;
+
+
+
+  reply_values.push_back(::workrave::rpc::dbus::GioCodec<GenericDBusApplet::TimerData>::encode(p_micro));
+
+
+
+  reply_values.push_back(::workrave::rpc::dbus::GioCodec<GenericDBusApplet::TimerData>::encode(p_rest));
+
+
+
+  reply_values.push_back(::workrave::rpc::dbus::GioCodec<GenericDBusApplet::TimerData>::encode(p_daily));
+
+
+  GVariant *reply = g_variant_new_tuple(
+    reply_values.empty() ? nullptr : reply_values.data(), reply_values.size());
+  ::workrave::rpc::dbus::gio_return_method_value(invocation, reply, reply_fd_list.get());
 }
+
+
 void
-org_workrave_AppletInterface::emit_MenuUpdated(std::list<GenericDBusApplet::MenuItem> menuitems)
+org_workrave_AppletInterface::dispatch_SetTimerChangesEnabled(GVariant *parameters, GDBusMethodInvocation *invocation)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
+  if (parameters == nullptr || !g_variant_is_of_type(parameters, G_VARIANT_TYPE_TUPLE)
+      || g_variant_n_children(parameters) != 2)
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::invalid_args),
+        "Incorrect number of input parameters for org.workrave.AppletInterface.SetTimerChangesEnabled");
+    }
+
+  bool p_enabled{};
 
-  values.push_back(::workrave::rpc::dbus::GioCodec<std::list<GenericDBusApplet::MenuItem>>::encode(menuitems));
+  p_enabled = ::workrave::rpc::dbus::gio_decode_child<bool>(parameters, 0);
 
+
+  std::string p_sender{};
+
+  p_sender = ::workrave::rpc::dbus::gio_decode_child<std::string>(parameters, 1);
+
+
+
+  implementation_.set_timer_changes_enabled(p_enabled, p_sender);
+
+
+  std::vector<GVariant *> reply_values;
+  ::workrave::rpc::dbus::GioUnixFdList reply_fd_list;
+
+
+
+
+  GVariant *reply = g_variant_new_tuple(
+    reply_values.empty() ? nullptr : reply_values.data(), reply_values.size());
+  ::workrave::rpc::dbus::gio_return_method_value(invocation, reply, reply_fd_list.get());
+}
+
+
+void
+org_workrave_AppletInterface::emit_TimersUpdated(GenericDBusApplet::TimerData micro, GenericDBusApplet::TimerData rest, GenericDBusApplet::TimerData daily)
+{
+  server_.emit_signal(path_, "org.workrave.AppletInterface", "TimersUpdated",
+                      ::workrave::rpc::dbus::gio_encode_tuple(micro, rest, daily),
+                      nullptr);
+}
+void
+org_workrave_AppletInterface::emit_TimersChanged(std::vector<GenericDBusApplet::TimerChange> timers)
+{
+  server_.emit_signal(path_, "org.workrave.AppletInterface", "TimersChanged",
+                      ::workrave::rpc::dbus::gio_encode_tuple(timers),
+                      nullptr);
+}
+void
+org_workrave_AppletInterface::emit_MenuUpdated(std::list<GenericDBusApplet::MenuItem> menuitems)
+{
   server_.emit_signal(path_, "org.workrave.AppletInterface", "MenuUpdated",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+                      ::workrave::rpc::dbus::gio_encode_tuple(menuitems),
+                      nullptr);
 }
 void
 org_workrave_AppletInterface::emit_MenuItemUpdated(GenericDBusApplet::MenuItem menuitem)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
-
-  values.push_back(::workrave::rpc::dbus::GioCodec<GenericDBusApplet::MenuItem>::encode(menuitem));
-
   server_.emit_signal(path_, "org.workrave.AppletInterface", "MenuItemUpdated",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+                      ::workrave::rpc::dbus::gio_encode_tuple(menuitem),
+                      nullptr);
 }
 void
 org_workrave_AppletInterface::emit_TrayIconUpdated(bool enabled)
 {
-  std::vector<GVariant *> values;
-  ::workrave::rpc::dbus::GioUnixFdList fd_list;
-
-  values.push_back(::workrave::rpc::dbus::GioCodec<bool>::encode(enabled));
-
   server_.emit_signal(path_, "org.workrave.AppletInterface", "TrayIconUpdated",
-                      g_variant_new_tuple(values.empty() ? nullptr : values.data(), values.size()),
-                      fd_list.get());
+                      ::workrave::rpc::dbus::gio_encode_tuple(enabled),
+                      nullptr);
 }
 } // namespace workrave::ui::rpc
@@ -47,9 +47,15 @@ private:
 
   void dispatch_GetTrayIconEnabled(GVariant *parameters, GDBusMethodInvocation *invocation);
 
+  void dispatch_GetTimers(GVariant *parameters, GDBusMethodInvocation *invocation);
+
+  void dispatch_SetTimerChangesEnabled(GVariant *parameters, GDBusMethodInvocation *invocation);
+
 
   void emit_TimersUpdated(GenericDBusApplet::TimerData micro, GenericDBusApplet::TimerData rest, GenericDBusApplet::TimerData daily);
 
+  void emit_TimersChanged(std::vector<GenericDBusApplet::TimerChange> timers);
+
   void emit_MenuUpdated(std::list<GenericDBusApplet::MenuItem> menuitems);
 
   void emit_MenuItemUpdated(GenericDBusApplet::MenuItem menuitem);
@@ -164,6 +164,93 @@ struct QtCodec<GenericDBusApplet::TimerData>
   return arg;
 }
 
+namespace workrave::rpc::dbus
+{
+template<>
+struct QtCodec<GenericDBusApplet::TimerChange>
+{
+  static GenericDBusApplet::TimerChange decode(const QVariant &variant)
+  {
+    const auto arg = variant.value<QDBusArgument>();
+    GenericDBusApplet::TimerChange result{};
+    arg.beginStructure();
+
+    result.timer = QtCodec<uint32_t>::decode(arg.asVariant());
+
+    result.data = QtCodec<GenericDBusApplet::TimerData>::decode(arg.asVariant());
+
+    arg.endStructure();
+    return result;
+  }
+  static void append(QDBusArgument &arg, const GenericDBusApplet::TimerChange &value)
+  {
+    arg.beginStructure();
+
+    QtCodec<uint32_t>::append(arg, value.timer);
+
+    QtCodec<GenericDBusApplet::TimerData>::append(arg, value.data);
+
+    arg.endStructure();
+  }
+  static QVariant encode(const GenericDBusApplet::TimerChange &value)
+  {
+    QDBusArgument arg;
+    append(arg, value);
+    return QVariant::fromValue(arg);
+  }
+};
+} // namespace workrave::rpc::dbus
+
+// See the enum case above for why these are at global scope, not nested in
+// workrave::rpc::dbus: ADL needs to find them from GenericDBusApplet::TimerChange's own associated
+// namespace, not this library's.
+[[maybe_unused]] static QDBusArgument &operator<<(QDBusArgument &arg, const GenericDBusApplet::TimerChange &data)
+{
+  workrave::rpc::dbus::QtCodec<GenericDBusApplet::TimerChange>::append(arg, data);
+  return arg;
+}
+
+[[maybe_unused]] static const QDBusArgument &operator>>(const QDBusArgument &arg, GenericDBusApplet::TimerChange &data)
+{
+  data = workrave::rpc::dbus::QtCodec<GenericDBusApplet::TimerChange>::decode(QVariant::fromValue(arg));
+  return arg;
+}
+
+namespace workrave::rpc::dbus
+{
+template<>
+struct QtCodec<std::vector<GenericDBusApplet::TimerChange>>
+{
+  static std::vector<GenericDBusApplet::TimerChange> decode(const QVariant &variant)
+  {
+    const auto arg = variant.value<QDBusArgument>();
+    std::vector<GenericDBusApplet::TimerChange> result;
+    arg.beginArray();
+    while (!arg.atEnd())
+      {
+        result.push_back(QtCodec<GenericDBusApplet::TimerChange>::decode(arg.asVariant()));
+      }
+    arg.endArray();
+    return result;
+  }
+  static void append(QDBusArgument &arg, const std::vector<GenericDBusApplet::TimerChange> &value)
+  {
+    arg.beginArray(qMetaTypeId<QVariant>());
+    for (const auto &item : value)
+      {
+        QtCodec<GenericDBusApplet::TimerChange>::append(arg, item);
+      }
+    arg.endArray();
+  }
+  static QVariant encode(const std::vector<GenericDBusApplet::TimerChange> &value)
+  {
+    QDBusArgument arg;
+    append(arg, value);
+    return QVariant::fromValue(arg);
+  }
+};
+} // namespace workrave::rpc::dbus
+
 
 namespace workrave::ui::rpc
 {
@@ -183,11 +270,18 @@ org_workrave_AppletInterface::org_workrave_AppletInterface(::workrave::rpc::dbus
 
   qDBusRegisterMetaType<GenericDBusApplet::TimerData>();
 
+  qDBusRegisterMetaType<GenericDBusApplet::TimerChange>();
+
   signal_connections_.emplace_back(implementation_.signal_timers_updated().connect(
     [this](GenericDBusApplet::TimerData micro, GenericDBusApplet::TimerData rest, GenericDBusApplet::TimerData daily) {
       emit_TimersUpdated(micro, rest, daily);
     }));
 
+  signal_connections_.emplace_back(implementation_.signal_timers_changed().connect(
+    [this](std::vector<GenericDBusApplet::TimerChange> timers) {
+      emit_TimersChanged(timers);
+    }));
+
   signal_connections_.emplace_back(implementation_.signal_menu_updated().connect(
     [this](std::list<GenericDBusApplet::MenuItem> menuitems) {
       emit_MenuUpdated(menuitems);
@@ -296,6 +390,42 @@ org_workrave_AppletInterface::introspection() const noexcept
 
   "\n"
 
+  "    <method name=\"GetTimers\">\n"
+
+  "\n"
+
+  "      <arg type=\"(siuuuuuu)\" name=\"micro\" direction=\"out\" />\n"
+
+  "\n"
+
+  "      <arg type=\"(siuuuuuu)\" name=\"rest\" direction=\"out\" />\n"
+
+  "\n"
+
+  "      <arg type=\"(siuuuuuu)\" name=\"daily\" direction=\"out\" />\n"
+
+  "\n"
+
+  "    </method>\n"
+
+  "\n"
+
+  "    <method name=\"SetTimerChangesEnabled\">\n"
+
+  "\n"
+
+  "      <arg type=\"b\" name=\"enabled\" direction=\"in\" />\n"
+
+  "\n"
+
+  "      <arg type=\"s\" name=\"sender\" direction=\"in\" />\n"
+
+  "\n"
+
+  "    </method>\n"
+
+  "\n"
+
   "\n"
 
   "    <signal name=\"TimersUpdated\">\n"
@@ -318,6 +448,18 @@ org_workrave_AppletInterface::introspection() const noexcept
 
   "\n"
 
+  "    <signal name=\"TimersChanged\">\n"
+
+  "\n"
+
+  "      <arg type=\"a(u(siuuuuuu))\" name=\"timers\" />\n"
+
+  "\n"
+
+  "    </signal>\n"
+
+  "\n"
+
   "    <signal name=\"MenuUpdated\">\n"
 
   "\n"
@@ -367,7 +509,7 @@ org_workrave_AppletInterface::dispatch(const QDBusMessage &message, const QDBusC
     std::string_view name;
     Method method;
   };
-  static constexpr std::array<Entry, 6> methods =
+  static constexpr std::array<Entry, 8> methods =
   { {
 
       {.name = "Embed", .method = &org_workrave_AppletInterface::dispatch_Embed},
@@ -382,6 +524,10 @@ org_workrave_AppletInterface::dispatch(const QDBusMessage &message, const QDBusC
 
       {.name = "GetTrayIconEnabled", .method = &org_workrave_AppletInterface::dispatch_GetTrayIconEnabled},
 
+      {.name = "GetTimers", .method = &org_workrave_AppletInterface::dispatch_GetTimers},
+
+      {.name = "SetTimerChangesEnabled", .method = &org_workrave_AppletInterface::dispatch_SetTimerChangesEnabled},
+
   } };
 
   const std::string method_name = message.member().toStdString();
@@ -651,6 +797,110 @@ org_workrave_AppletInterface::dispatch_GetTrayIconEnabled(const QDBusMessage &me
 }
 
 
+void
+org_workrave_AppletInterface::dispatch_GetTimers(const QDBusMessage &message, const QDBusConnection &connection)
+{
+
+  GenericDBusApplet::TimerData p_micro{};
+
+  GenericDBusApplet::TimerData p_rest{};
+
+  GenericDBusApplet::TimerData p_daily{};
+
+
+
+  const auto num_in_args = message.arguments().size();
+  if (num_in_args != 0)
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::invalid_args),
+        "Incorrect number of input parameters for org.workrave.AppletInterface.GetTimers");
+    }
+
+
+
+
+
+
+
+
+
+
+  implementation_.get_timers(p_micro, p_rest, p_daily);
+
+
+  QDBusMessage reply = message.createReply();
+
+
+
+  reply << ::workrave::rpc::dbus::QtCodec<GenericDBusApplet::TimerData>::encode(p_micro);
+
+
+
+  reply << ::workrave::rpc::dbus::QtCodec<GenericDBusApplet::TimerData>::encode(p_rest);
+
+
+
+  reply << ::workrave::rpc::dbus::QtCodec<GenericDBusApplet::TimerData>::encode(p_daily);
+
+
+
+  if (!connection.send(reply))
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::failed),
+        "Failed to send reply for org.workrave.AppletInterface.GetTimers");
+    }
+}
+
+
+void
+org_workrave_AppletInterface::dispatch_SetTimerChangesEnabled(const QDBusMessage &message, const QDBusConnection &connection)
+{
+
+  bool p_enabled{};
+
+  std::string p_sender{};
+
+
+
+  const auto num_in_args = message.arguments().size();
+  if (num_in_args != 2)
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::invalid_args),
+        "Incorrect number of input parameters for org.workrave.AppletInterface.SetTimerChangesEnabled");
+    }
+
+
+
+  p_enabled = ::workrave::rpc::dbus::QtCodec<bool>::decode(message.arguments().at(0));
+
+
+
+  p_sender = ::workrave::rpc::dbus::QtCodec<std::string>::decode(message.arguments().at(1));
+
+
+
+
+  implementation_.set_timer_changes_enabled(p_enabled, p_sender);
+
+
+  QDBusMessage reply = message.createReply();
+
+
+
+
+
+  if (!connection.send(reply))
+    {
+      throw ::workrave::rpc::dbus::Error(
+        std::string(::workrave::rpc::dbus::error_names::failed),
+        "Failed to send reply for org.workrave.AppletInterface.SetTimerChangesEnabled");
+    }
+}
+
+
 void
 org_workrave_AppletInterface::emit_TimersUpdated(GenericDBusApplet::TimerData micro, GenericDBusApplet::TimerData rest, GenericDBusApplet::TimerData daily)
 {
@@ -665,6 +915,15 @@ org_workrave_AppletInterface::emit_TimersUpdated(GenericDBusApplet::TimerData mi
   server_.emit_signal(path_, "org.workrave.AppletInterface", "TimersUpdated", arguments);
 }
 void
+org_workrave_AppletInterface::emit_TimersChanged(std::vector<GenericDBusApplet::TimerChange> timers)
+{
+  QVariantList arguments;
+
+  arguments << ::workrave::rpc::dbus::QtCodec<std::vector<GenericDBusApplet::TimerChange>>::encode(timers);
+
+  server_.emit_signal(path_, "org.workrave.AppletInterface", "TimersChanged", arguments);
+}
+void
 org_workrave_AppletInterface::emit_MenuUpdated(std::list<GenericDBusApplet::MenuItem> menuitems)
 {
   QVariantList arguments;
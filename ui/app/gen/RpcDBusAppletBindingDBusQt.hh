@@ -45,9 +45,15 @@ private:
 
   void dispatch_GetTrayIconEnabled(const QDBusMessage &message, const QDBusConnection &connection);
 
+  void dispatch_GetTimers(const QDBusMessage &message, const QDBusConnection &connection);
+
+  void dispatch_SetTimerChangesEnabled(const QDBusMessage &message, const QDBusConnection &connection);
+
 
   void emit_TimersUpdated(GenericDBusApplet::TimerData micro, GenericDBusApplet::TimerData rest, GenericDBusApplet::TimerData daily);
 
+  void emit_TimersChanged(std::vector<GenericDBusApplet::TimerChange> timers);
+
   void emit_MenuUpdated(std::list<GenericDBusApplet::MenuItem> menuitems);
 
   void emit_MenuItemUpdated(GenericDBusApplet::MenuItem menuitem);
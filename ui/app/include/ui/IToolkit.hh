@@ -18,6 +18,7 @@
 #ifndef WORKRAVE_UI_ITOOLKIT_HH
 #define WORKRAVE_UI_ITOOLKIT_HH
 
+#include <chrono>
 #include <memory>
 #include <boost/signals2.hpp>
 
@@ -71,6 +72,20 @@ public:
 
   virtual const char *get_display_name() const = 0;
   virtual void create_oneshot_timer(int ms, std::function<void()> func) = 0;
+
+  //! Fires signal_timer() next after delay, or after a second while the timer refresh is held. Main thread only.
+  virtual void set_timer_delay(std::chrono::milliseconds delay) = 0;
+
+  //! Keeps signal_timer() firing every second, for views that show the timers. Main thread only.
+  virtual void hold_timer_refresh() = 0;
+  virtual void release_timer_refresh() = 0;
+
+  //! Fires signal_timer() as soon as possible. May be called from any thread.
+  virtual void trigger_timer() = 0;
+
+  //! Runs func on the main loop. May be called from any thread.
+  virtual void post(std::function<void()> func) = 0;
+
   virtual void show_notification(const std::string &id,
                                  const std::string &title,
                                  const std::string &balloon,
@@ -48,6 +48,7 @@ using namespace std;
 
 MainWindow::MainWindow(std::shared_ptr<IApplicationContext> app)
   : app(app)
+  , timer_refresh(app->get_toolkit())
 {
   init();
 }
@@ -72,6 +73,7 @@ MainWindow::open_window()
       stick();
       show_all();
       deiconify();
+      timer_refresh.hold();
 
       set_position(Gtk::WIN_POS_NONE);
       set_gravity(Gdk::GRAVITY_NORTH_WEST);
@@ -105,6 +107,8 @@ MainWindow::close_window()
       iconify();
     }
 
+  timer_refresh.release();
+
   GUIConfig::timerbox_enabled("main_window").set(false);
 }
 
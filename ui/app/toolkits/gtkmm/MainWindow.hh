@@ -25,6 +25,7 @@
 
 #include "ui/IApplicationContext.hh"
 #include "ui/IToolkit.hh"
+#include "ui/TimerRefreshHold.hh"
 #include "commonui/MenuModel.hh"
 #include "ToolkitMenu.hh"
 
@@ -78,6 +79,9 @@ private:
   //! View that displays the timerbox.
   TimerBoxGtkView *timer_box_view{nullptr};
 
+  //! Keeps the timerbox up to date while the window is open.
+  TimerRefreshHold timer_refresh;
+
   std::shared_ptr<ToolkitMenu> menu;
 
 #if defined(PLATFORM_OS_UNIX)
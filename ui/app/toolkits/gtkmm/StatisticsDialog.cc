@@ -19,9 +19,11 @@
 #  include "config.h"
 #endif
 
+#include <algorithm>
 #include <array>
 #include <optional>
 #include <sstream>
+#include <utility>
 
 #include <ctime>
 #include <cstring>
@@ -283,6 +285,45 @@ namespace
     // Gtk counts months from zero.
     return std::chrono::year{static_cast<int>(year)} / (month + 1) / day;
   }
+
+  //! The first and last day of the week the given date is in.
+  std::pair<workrave::stats::IStatistics::Date, workrave::stats::IStatistics::Date> week_of(
+    const workrave::stats::IStatistics::Date &date)
+  {
+    using namespace std::chrono;
+
+    const auto weekday_of_date = weekday{sys_days{date}};
+    const int offset = (static_cast<int>(weekday_of_date.c_encoding()) - Locale::get_week_start() + 7) % 7;
+
+    const workrave::stats::IStatistics::Date from{local_days{date} - days{offset}};
+    const workrave::stats::IStatistics::Date to{local_days{from} + days{6}};
+    return {from, to};
+  }
+
+  //! The first and last day of the month the given date is in.
+  std::pair<workrave::stats::IStatistics::Date, workrave::stats::IStatistics::Date> month_of(
+    const workrave::stats::IStatistics::Date &date)
+  {
+    using namespace std::chrono;
+
+    return {date.year() / date.month() / 1, date.year() / date.month() / last};
+  }
+
+  //! The active time of the days in the range that lie between from and to.
+  int64_t active_time_within(const workrave::stats::IStatistics::RangeStats &range,
+                             const workrave::stats::IStatistics::Date &from,
+                             const workrave::stats::IStatistics::Date &to)
+  {
+    std::chrono::seconds total{0};
+    for (size_t i = 0; i < range.dates.size(); i++)
+      {
+        if (date_is_within(range.dates[i], from, to))
+          {
+            total += range.active_time[i];
+          }
+      }
+    return total.count();
+  }
 } // namespace
 
 void
@@ -353,37 +394,24 @@ StatisticsDialog::display_statistics(IStatistics::DailyStats *stats)
 }
 
 void
-StatisticsDialog::display_week_statistics()
+StatisticsDialog::display_week_statistics(const IStatistics::RangeStats &range,
+                                          const IStatistics::Date &from,
+                                          const IStatistics::Date &to)
 {
-  using namespace std::chrono;
-
-  const IStatistics::Date date = to_date(calendar);
-
-  const auto weekday_of_date = weekday{sys_days{date}};
-  const int offset = (static_cast<int>(weekday_of_date.c_encoding()) - Locale::get_week_start() + 7) % 7;
-
-  const IStatistics::Date from{local_days{date} - days{offset}};
-  const IStatistics::Date to{local_days{from} + days{6}};
-
   update_usage_real_time |= date_is_within(today_date(), from, to);
 
-  const int64_t total_week = statistics->get_total_active_time(from, to).count();
+  const int64_t total_week = active_time_within(range, from, to);
   weekly_usage_time_label->set_text(total_week > 0 ? Text::time_to_string(total_week) : "");
 }
 
 void
-StatisticsDialog::display_month_statistics()
+StatisticsDialog::display_month_statistics(const IStatistics::RangeStats &range,
+                                           const IStatistics::Date &from,
+                                           const IStatistics::Date &to)
 {
-  using namespace std::chrono;
-
-  const IStatistics::Date date = to_date(calendar);
-
-  const IStatistics::Date from{date.year() / date.month() / 1};
-  const IStatistics::Date to{date.year() / date.month() / last};
-
   update_usage_real_time |= date_is_within(today_date(), from, to);
 
-  const int64_t total_month = statistics->get_total_active_time(from, to).count();
+  const int64_t total_month = active_time_within(range, from, to);
   monthly_usage_time_label->set_text(total_month > 0 ? Text::time_to_string(total_month) : "");
 }
 
@@ -446,9 +474,15 @@ StatisticsDialog::display_calendar_date()
       clear_display_statistics();
     }
 
+  // The week can stick out of the month at either end, so a single range
+  // covering both answers the two totals with one query.
+  const auto [week_from, week_to] = week_of(date);
+  const auto [month_from, month_to] = month_of(date);
+  const IStatistics::RangeStats range = statistics->get_range(std::min(week_from, month_from), std::max(week_to, month_to));
+
   update_usage_real_time = false;
-  display_week_statistics();
-  display_month_statistics();
+  display_week_statistics(range, week_from, week_to);
+  display_month_statistics(range, month_from, month_to);
 
   std::optional<IStatistics::Date> first = statistics->get_first_date();
   std::optional<IStatistics::Date> last = statistics->get_last_date();
@@ -102,8 +102,12 @@ private:
   void display_calendar_date();
   void display_statistics(workrave::stats::IStatistics::DailyStats *stats);
   void clear_display_statistics();
-  void display_week_statistics();
-  void display_month_statistics();
+  void display_week_statistics(const workrave::stats::IStatistics::RangeStats &range,
+                               const workrave::stats::IStatistics::Date &from,
+                               const workrave::stats::IStatistics::Date &to);
+  void display_month_statistics(const workrave::stats::IStatistics::RangeStats &range,
+                                const workrave::stats::IStatistics::Date &from,
+                                const workrave::stats::IStatistics::Date &to);
   bool on_timer();
 };
 
@@ -102,7 +102,7 @@ Toolkit::init(std::shared_ptr<IApplicationContext> app)
     status_icon->signal_balloon_activated().connect(sigc::mem_fun(*this, &Toolkit::on_status_icon_balloon_activated)));
 #endif
 
-  Glib::signal_timeout().connect(sigc::mem_fun(*this, &Toolkit::on_timer), 1000);
+  arm_timer();
 
   init_multihead();
   init_debug();
@@ -457,6 +457,76 @@ Toolkit::create_oneshot_timer(int ms, std::function<void()> func)
     }
 }
 
+void
+Toolkit::set_timer_delay(std::chrono::milliseconds delay)
+{
+  timer_delay = delay;
+  arm_timer();
+}
+
+void
+Toolkit::hold_timer_refresh()
+{
+  if (timer_refresh_count++ == 0)
+    {
+      arm_timer();
+    }
+}
+
+void
+Toolkit::release_timer_refresh()
+{
+  // The next tick goes back to the delay of the core.
+  timer_refresh_count--;
+}
+
+void
+Toolkit::trigger_timer()
+{
+  post([this]() { on_timer(); });
+}
+
+//! Starts the timer at the delay in effect, unless it already repeats at that delay.
+void
+Toolkit::arm_timer()
+{
+  const std::chrono::milliseconds interval = timer_refresh_count > 0 ? std::min(timer_delay, std::chrono::milliseconds{1000})
+                                                                      : timer_delay;
+  if (interval == timer_interval && timer_connection.connected())
+    {
+      return;
+    }
+
+  timer_interval = interval;
+  timer_connection.disconnect();
+  timer_connection = Glib::signal_timeout().connect(sigc::mem_fun(*this, &Toolkit::on_timer), static_cast<unsigned int>(interval.count()));
+}
+
+void
+Toolkit::post(std::function<void()> func)
+{
+  struct Call
+  {
+    std::weak_ptr<void> alive;
+    std::function<void()> func;
+  };
+
+  // Unlike Glib::signal_idle(), g_idle_add_full() may be called from any thread. The call is
+  // dropped if the toolkit is gone by the time it runs, and freed even if it never runs.
+  g_idle_add_full(
+    G_PRIORITY_DEFAULT_IDLE,
+    [](gpointer data) -> gboolean {
+      auto *call = static_cast<Call *>(data);
+      if (!call->alive.expired())
+        {
+          call->func();
+        }
+      return G_SOURCE_REMOVE;
+    },
+    new Call{tracker.tracker_object(), std::move(func)},
+    [](gpointer data) { delete static_cast<Call *>(data); });
+}
+
 void
 Toolkit::show_notification(const std::string &id,
                            const std::string &title,
@@ -18,6 +18,7 @@
 #ifndef TOOLKIT_HH
 #define TOOLKIT_HH
 
+#include <chrono>
 #include <memory>
 #include <map>
 #include <vector>
@@ -94,6 +95,11 @@ public:
 
   const char *get_display_name() const override;
   void create_oneshot_timer(int ms, std::function<void()> func) override;
+  void set_timer_delay(std::chrono::milliseconds delay) override;
+  void hold_timer_refresh() override;
+  void release_timer_refresh() override;
+  void trigger_timer() override;
+  void post(std::function<void()> func) override;
   void show_notification(const std::string &id,
                          const std::string &title,
                          const std::string &balloon,
@@ -128,6 +134,7 @@ private:
   std::vector<Glib::RefPtr<Gdk::Monitor>> get_unique_monitors() const;
 
   bool on_timer();
+  void arm_timer();
   void on_main_window_closed();
   void on_status_icon_balloon_activated(const std::string &id);
   void on_status_icon_activated();
@@ -161,6 +168,11 @@ private:
   std::list<sigc::connection> event_connections;
   workrave::utils::Trackable tracker;
 
+  sigc::connection timer_connection;
+  std::chrono::milliseconds timer_interval{0};
+  std::chrono::milliseconds timer_delay{1000};
+  int timer_refresh_count{0};
+
   boost::signals2::signal<void()> timer_signal;
   boost::signals2::signal<void()> main_window_closed_signal;
   boost::signals2::signal<void(bool)> session_idle_changed_signal;
@@ -30,6 +30,7 @@
 X11SystrayAppletWindow::X11SystrayAppletWindow(std::shared_ptr<IPluginContext> context)
   : context(context)
   , apphold(context->get_toolkit())
+  , timer_refresh(context->get_toolkit())
 {
   enabled = GUIConfig::applet_fallback_enabled()();
   GUIConfig::applet_fallback_enabled().connect(tracker, [this](bool enabled) { on_enabled_changed(); });
@@ -184,6 +185,7 @@ X11SystrayAppletWindow::deactivate()
       view = nullptr;
 
       apphold.release();
+      timer_refresh.release();
     }
 
   applet_active = false;
@@ -195,6 +197,7 @@ X11SystrayAppletWindow::on_delete_event(GdkEventAny *event)
   (void)event;
   deactivate();
   apphold.release();
+  timer_refresh.release();
   return true;
 }
 
@@ -221,6 +224,7 @@ X11SystrayAppletWindow::on_embedded()
       applet_orientation = orientation;
 
       view->set_geometry(applet_orientation, applet_size);
+      timer_refresh.hold();
     }
 
   apphold.hold();
@@ -33,6 +33,7 @@
 #include "ToolkitMenu.hh"
 #include "TimerBoxGtkView.hh"
 #include "ui/AppHold.hh"
+#include "ui/TimerRefreshHold.hh"
 
 class X11SystrayAppletWindow
   : public sigc::trackable
@@ -50,6 +51,7 @@ public:
 private:
   std::shared_ptr<IPluginContext> context;
   AppHold apphold;
+  TimerRefreshHold timer_refresh;
   std::shared_ptr<ToolkitMenu> menu;
 
   TimerBoxGtkView *view{nullptr};
@@ -166,6 +166,9 @@ DebugDialog::active_core_debug_state_html() const
 
   out << "<h3>Active core state</h3>";
   out << "<p>user-active=" << bool_text(core->is_user_active()) << "</p>";
+
+  const auto input = core->get_input_statistics();
+  out << "<p>input-events received=" << input.events_received << " forwarded=" << input.events_forwarded << "</p>";
   out << "<table cellspacing=\"0\" cellpadding=\"4\" border=\"1\">"
       << "<tr bgcolor=\"#e8e8e8\"><th align=\"left\">break</th><th>elapsed</th><th>idle</th><th>limit</th>"
       << "<th>auto-reset</th><th>enabled</th><th>running</th><th>taking</th><th>active</th></tr>";
@@ -40,6 +40,7 @@
 MainWindow::MainWindow(std::shared_ptr<IApplicationContext> app, QWidget *parent)
   : QWidget(parent)
   , app(app)
+  , timer_refresh(app->get_toolkit())
 {
   setWindowTitle("Workrave");
   setWindowIcon(QIcon(Ui::get_status_icon_filename(OperationModeIcon::Normal)));
@@ -210,6 +211,7 @@ MainWindow::open_window()
   raise();
   activateWindow();
   move_to_start_position();
+  timer_refresh.hold();
   GUIConfig::timerbox_enabled("main_window").set(true);
 }
 
@@ -226,6 +228,7 @@ MainWindow::close_window()
       showMinimized();
     }
 
+  timer_refresh.release();
   GUIConfig::timerbox_enabled("main_window").set(false);
 }
 
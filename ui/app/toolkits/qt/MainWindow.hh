@@ -23,6 +23,7 @@
 #include "ui/TimerBoxControl.hh"
 #include "ui/IApplicationContext.hh"
 #include "ui/GUIConfig.hh"
+#include "ui/TimerRefreshHold.hh"
 #include "utils/Signals.hh"
 
 #include "TimerBoxView.hh"
@@ -62,6 +63,7 @@ private:
 
 private:
   std::shared_ptr<IApplicationContext> app;
+  TimerRefreshHold timer_refresh;
   std::shared_ptr<ToolkitMenu> menu;
   std::shared_ptr<TimerBoxControl> timer_box_control;
   TimerBoxView *timer_box_view{nullptr};
@@ -63,6 +63,23 @@ namespace
             static_cast<int>(clock.minutes().count()),
             static_cast<int>(clock.seconds().count())};
   }
+
+  //! The active time of the days in the range that lie between first and last.
+  int64_t active_time_within(const workrave::stats::IStatistics::RangeStats &range, const QDate &first, const QDate &last)
+  {
+    const workrave::stats::IStatistics::Date from = to_date(first);
+    const workrave::stats::IStatistics::Date to = to_date(last);
+
+    std::chrono::seconds total{0};
+    for (size_t i = 0; i < range.dates.size(); i++)
+      {
+        if (range.dates[i] >= from && range.dates[i] <= to)
+          {
+            total += range.active_time[i];
+          }
+      }
+    return total.count();
+  }
 } // namespace
 
 // ── StatisticsBridge ──────────────────────────────────────────────────────────
@@ -355,8 +372,7 @@ StatisticsBridge::updateStats()
   daily_usage_ = daily > 0 ? formatTime(daily) : QString{};
 
   // ── Week / month usage ─────────────────────────────────────────────────────
-  updateWeekUsage();
-  updateMonthUsage();
+  updateUsage();
 }
 
 void
@@ -369,14 +385,15 @@ StatisticsBridge::clearStats()
   monthly_usage_.clear();
 }
 
-// ── updateWeekUsage ───────────────────────────────────────────────────────────
+// ── updateUsage ───────────────────────────────────────────────────────────────
 
 void
-StatisticsBridge::updateWeekUsage()
+StatisticsBridge::updateUsage()
 {
   if (selected_year_ == 0)
     {
       weekly_usage_.clear();
+      monthly_usage_.clear();
       return;
     }
 
@@ -385,31 +402,22 @@ StatisticsBridge::updateWeekUsage()
 
   // Qt: dayOfWeek() and firstDayOfWeek() are both 1=Mon … 7=Sun.
   const int offset = (selected.dayOfWeek() - locale.firstDayOfWeek() + 7) % 7;
-  const QDate first = selected.addDays(-offset);
-  const QDate last = first.addDays(6);
-
-  const int64_t total = statistics_->get_total_active_time(to_date(first), to_date(last)).count();
+  const QDate week_first = selected.addDays(-offset);
+  const QDate week_last = week_first.addDays(6);
 
-  weekly_usage_ = (total > 0) ? formatTime(total) : QString{};
-}
-
-// ── updateMonthUsage ──────────────────────────────────────────────────────────
-
-void
-StatisticsBridge::updateMonthUsage()
-{
-  if (selected_year_ == 0)
-    {
-      monthly_usage_.clear();
-      return;
-    }
+  const QDate month_first(selected_year_, selected_month_, 1);
+  const QDate month_last = month_first.addDays(month_first.daysInMonth() - 1);
 
-  const int days_in_month = QDate(selected_year_, selected_month_, 1).daysInMonth();
+  // The week can stick out of the month at either end, so a single range
+  // covering both answers the two totals with one query.
+  const workrave::stats::IStatistics::RangeStats range = statistics_->get_range(to_date(std::min(week_first, month_first)),
+                                                                               to_date(std::max(week_last, month_last)));
 
-  const QDate first(selected_year_, selected_month_, 1);
-  const int64_t total = statistics_->get_total_active_time(to_date(first), to_date(first.addDays(days_in_month - 1))).count();
+  const int64_t week_total = active_time_within(range, week_first, week_last);
+  weekly_usage_ = (week_total > 0) ? formatTime(week_total) : QString{};
 
-  monthly_usage_ = (total > 0) ? formatTime(total) : QString{};
+  const int64_t month_total = active_time_within(range, month_first, month_last);
+  monthly_usage_ = (month_total > 0) ? formatTime(month_total) : QString{};
 }
 
 // ── tick ──────────────────────────────────────────────────────────────────────
@@ -141,8 +141,7 @@ private:
   void selectDate(const Date &date);
   void updateNavigation();
   void updateStats();
-  void updateWeekUsage();
-  void updateMonthUsage();
+  void updateUsage();
   void clearStats();
 
   static QString formatTime(int64_t secs);
@@ -21,6 +21,8 @@
 
 #include "Toolkit.hh"
 
+#include <algorithm>
+
 #include <QApplication>
 #include <QDir>
 #include <QFile>
@@ -82,7 +84,7 @@ Toolkit::init(std::shared_ptr<IApplicationContext> app)
   });
 
   connect(heartbeat_timer, SIGNAL(timeout()), this, SLOT(on_timer()));
-  heartbeat_timer->start(1000);
+  arm_timer();
 }
 
 void
@@ -311,6 +313,55 @@ Toolkit::create_oneshot_timer(int ms, std::function<void()> func)
   QTimer::singleShot(ms, this, [func = std::move(func)]() { func(); });
 }
 
+void
+Toolkit::set_timer_delay(std::chrono::milliseconds delay)
+{
+  timer_delay = delay;
+  arm_timer();
+}
+
+void
+Toolkit::hold_timer_refresh()
+{
+  if (timer_refresh_count++ == 0)
+    {
+      arm_timer();
+    }
+}
+
+void
+Toolkit::release_timer_refresh()
+{
+  // The next tick goes back to the delay of the core.
+  timer_refresh_count--;
+}
+
+void
+Toolkit::trigger_timer()
+{
+  QMetaObject::invokeMethod(this, [this]() { on_timer(); }, Qt::QueuedConnection);
+}
+
+//! Starts the timer at the delay in effect, unless it already repeats at that delay.
+void
+Toolkit::arm_timer()
+{
+  const std::chrono::milliseconds interval = timer_refresh_count > 0 ? std::min(timer_delay, std::chrono::milliseconds{1000})
+                                                                      : timer_delay;
+  if (heartbeat_timer->interval() == interval.count() && heartbeat_timer->isActive())
+    {
+      return;
+    }
+
+  heartbeat_timer->start(static_cast<int>(interval.count()));
+}
+
+void
+Toolkit::post(std::function<void()> func)
+{
+  QMetaObject::invokeMethod(this, [func = std::move(func)]() { func(); }, Qt::QueuedConnection);
+}
+
 void
 Toolkit::show_notification(const std::string &id,
                            const std::string &title,
@@ -18,6 +18,7 @@
 #ifndef TOOLKIT_HH
 #define TOOLKIT_HH
 
+#include <chrono>
 #include <memory>
 #include <map>
 #include <optional>
@@ -73,6 +74,11 @@ public:
 
   auto get_display_name() const -> const char * override;
   void create_oneshot_timer(int ms, std::function<void()> func) override;
+  void set_timer_delay(std::chrono::milliseconds delay) override;
+  void hold_timer_refresh() override;
+  void release_timer_refresh() override;
+  void trigger_timer() override;
+  void post(std::function<void()> func) override;
   void show_notification(const std::string &id,
                          const std::string &title,
                          const std::string &balloon,
@@ -102,6 +108,7 @@ private:
   void show_main_window();
   void show_preferences();
   void show_statistics();
+  void arm_timer();
   auto can_close() const -> bool;
 
   void on_main_window_closed();
@@ -126,6 +133,8 @@ private:
   int hold_count{0};
 
   QTimer *heartbeat_timer{nullptr};
+  std::chrono::milliseconds timer_delay{1000};
+  int timer_refresh_count{0};
 
   std::shared_ptr<MenuModel> menu_model;
   std::shared_ptr<SoundTheme> sound_theme;
@@ -0,0 +1,56 @@
+/* Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WORKRAVE_APPLET_COMMON_TIMERSTATUS_H
+#define WORKRAVE_APPLET_COMMON_TIMERSTATUS_H
+
+/* Reader of the timer status segment that Workrave rewrites on every
+ * heartbeat. Reading costs a memcpy, so it may be polled at any rate.
+ *
+ * Depends only on libc, so it can be used outside the applets as well.
+ */
+
+#include "core/TimerStatus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _WorkraveTimerStatusReader WorkraveTimerStatusReader;
+
+typedef enum WorkraveTimerStatusResult
+{
+  WORKRAVE_TIMER_STATUS_OK = 0,
+  /* The writer kept updating the segment; try again later. */
+  WORKRAVE_TIMER_STATUS_BUSY,
+  /* Workrave exited or restarted; close the reader and open it again. */
+  WORKRAVE_TIMER_STATUS_CLOSED,
+} WorkraveTimerStatusResult;
+
+/* Maps the segment at path, or in $XDG_RUNTIME_DIR if path is NULL.
+ * Returns NULL if Workrave is not running or publishes an incompatible version.
+ */
+WorkraveTimerStatusReader *workrave_timer_status_open(const char *path);
+
+WorkraveTimerStatusResult workrave_timer_status_read(WorkraveTimerStatusReader *reader, WorkraveTimerStatusData *data);
+
+void workrave_timer_status_close(WorkraveTimerStatusReader *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORKRAVE_APPLET_COMMON_TIMERSTATUS_H */
@@ -68,6 +68,7 @@ struct _WorkraveTimerboxControlPrivate
 
   gboolean workrave_running;
   gboolean alive;
+  gboolean timer_changes;
 
   gboolean tray_icon_enabled;
   enum WorkraveTimerboxControlTrayIconMode tray_icon_mode;
@@ -110,6 +111,10 @@ static void on_dbus_core_ready(GObject *object, GAsyncResult *res, gpointer user
 static void on_dbus_control_ready(GObject *object, GAsyncResult *res, gpointer user_data);
 static void on_dbus_signal(GDBusProxy *proxy, gchar *sender_name, gchar *signal_name, GVariant *parameters, gpointer user_data);
 static void on_update_timers(WorkraveTimerboxControl *self, GVariant *parameters);
+static void on_timers_changed(WorkraveTimerboxControl *self, GVariant *parameters);
+static void on_get_timers_reply(GObject *object, GAsyncResult *res, gpointer user_data);
+static void workrave_timerbox_control_update_time_bar(WorkraveTimerboxControl *self, int timer, const TimerData *td);
+static void workrave_timerbox_control_update_timers(WorkraveTimerboxControl *self, GVariant *timers);
 static void on_bus_acquired(GDBusConnection *connection, const gchar *name, gpointer user_data);
 static void on_workrave_appeared(GDBusConnection *connection, const gchar *name, const gchar *name_owner, gpointer user_data);
 static void on_workrave_vanished(GDBusConnection *connection, const gchar *name, gpointer user_data);
@@ -282,6 +287,7 @@ workrave_timerbox_control_init(WorkraveTimerboxControl *self)
   priv->watch_id = 0;
   priv->workrave_running = FALSE;
   priv->alive = FALSE;
+  priv->timer_changes = FALSE;
   priv->tray_icon_enabled = FALSE;
   priv->tray_icon_mode = WORKRAVE_TIMERBOX_CONTROL_TRAY_ICON_MODE_FOLLOW;
   priv->tray_icon_visible_when_not_running = FALSE;
@@ -353,6 +359,42 @@ workrave_timerbox_control_finalize(GObject *object)
   return;
 }
 
+// Asks Workrave to send TimersChanged with only the timers that changed
+// instead of a full TimersUpdated every second, and fetches the current
+// timers once. Older versions of Workrave keep sending TimersUpdated.
+static void
+workrave_timerbox_control_enable_timer_changes(WorkraveTimerboxControl *self)
+{
+  WorkraveTimerboxControlPrivate *priv = workrave_timerbox_control_get_instance_private(self);
+
+  GError *error = NULL;
+  GVariant *result = g_dbus_proxy_call_sync(priv->applet_proxy,
+                                            "SetTimerChangesEnabled",
+                                            g_variant_new("(bs)", TRUE, WORKRAVE_DBUS_NAME),
+                                            G_DBUS_CALL_FLAGS_NONE,
+                                            -1,
+                                            NULL,
+                                            &error);
+  if (error != NULL)
+    {
+      g_error_free(error);
+      return;
+    }
+  g_variant_unref(result);
+
+  result = g_dbus_proxy_call_sync(priv->applet_proxy, "GetTimers", NULL, G_DBUS_CALL_FLAGS_NONE, -1, NULL, &error);
+  if (error != NULL)
+    {
+      g_warning("Could not request timers for %s: %s", WORKRAVE_DBUS_APPLET_NAME, error->message);
+      g_error_free(error);
+      return;
+    }
+
+  priv->timer_changes = TRUE;
+  workrave_timerbox_control_update_timers(self, result);
+  g_variant_unref(result);
+}
+
 static void
 workrave_timerbox_control_start(WorkraveTimerboxControl *self)
 {
@@ -397,6 +439,11 @@ workrave_timerbox_control_start(WorkraveTimerboxControl *self)
         }
     }
 
+  if (error == NULL)
+    {
+      workrave_timerbox_control_enable_timer_changes(self);
+    }
+
   if (error == NULL)
     {
       GVariant *
@@ -473,6 +520,7 @@ workrave_timerbox_control_stop(WorkraveTimerboxControl *self)
         }
 
       priv->alive = FALSE;
+      priv->timer_changes = FALSE;
 
       workrave_timerbox_control_update_show_tray_icon(self);
       workrave_timerbox_set_enabled(priv->timerbox, FALSE);
@@ -560,6 +608,45 @@ workrave_timerbox_control_create_dbus(WorkraveTimerboxControl *self)
                            self);
 }
 
+static void
+workrave_timerbox_control_disable_timers(WorkraveTimerboxControl *self)
+{
+  WorkraveTimerboxControlPrivate *priv = workrave_timerbox_control_get_instance_private(self);
+
+  workrave_timerbox_set_enabled(priv->timerbox, FALSE);
+  workrave_timerbox_set_force_icon(priv->timerbox, priv->tray_icon_visible_when_not_running);
+  workrave_timerbox_update(priv->timerbox, priv->image);
+}
+
+static void
+on_get_timers_reply(GObject *object, GAsyncResult *res, gpointer user_data)
+{
+  WorkraveTimerboxControl *self = WORKRAVE_TIMERBOX_CONTROL(user_data);
+  WorkraveTimerboxControlPrivate *priv = workrave_timerbox_control_get_instance_private(self);
+
+  GError *error = NULL;
+  GVariant *result = g_dbus_proxy_call_finish(G_DBUS_PROXY(object), res, &error);
+
+  if (error != NULL)
+    {
+      if (priv->alive)
+        {
+          workrave_timerbox_control_disable_timers(self);
+        }
+      g_error_free(error);
+    }
+  else
+    {
+      if (priv->alive)
+        {
+          workrave_timerbox_control_update_timers(self, result);
+        }
+      g_variant_unref(result);
+    }
+
+  g_object_unref(self);
+}
+
 static gboolean
 on_timer(gpointer user_data)
 {
@@ -568,9 +655,23 @@ on_timer(gpointer user_data)
 
   if (priv->alive && priv->update_count == 0)
     {
-      workrave_timerbox_set_enabled(priv->timerbox, FALSE);
-      workrave_timerbox_set_force_icon(priv->timerbox, priv->tray_icon_visible_when_not_running);
-      workrave_timerbox_update(priv->timerbox, priv->image);
+      if (priv->timer_changes)
+        {
+          // No changes are sent while the timers are unchanged; check that
+          // Workrave still responds.
+          g_dbus_proxy_call(priv->applet_proxy,
+                            "GetTimers",
+                            NULL,
+                            G_DBUS_CALL_FLAGS_NONE,
+                            -1,
+                            NULL,
+                            on_get_timers_reply,
+                            g_object_ref(self));
+        }
+      else
+        {
+          workrave_timerbox_control_disable_timers(self);
+        }
     }
   priv->update_count = 0;
 
@@ -675,6 +776,11 @@ on_dbus_signal(GDBusProxy *proxy, gchar *sender_name, gchar *signal_name, GVaria
       on_update_timers(self, parameters);
     }
 
+  else if (g_strcmp0(signal_name, "TimersChanged") == 0)
+    {
+      on_timers_changed(self, parameters);
+    }
+
   else if (g_strcmp0(signal_name, "MenuUpdated") == 0)
     {
       g_signal_emit(self, signals[MENU_CHANGED], 0, parameters);
@@ -714,9 +820,73 @@ on_update_timers(WorkraveTimerboxControl *self, GVariant *parameters)
 
   priv->update_count++;
 
+  workrave_timerbox_control_update_timers(self, parameters);
+}
+
+static void
+on_timers_changed(WorkraveTimerboxControl *self, GVariant *parameters)
+{
+  WorkraveTimerboxControlPrivate *priv = workrave_timerbox_control_get_instance_private(self);
+
+  if (!priv->alive)
+    {
+      workrave_timerbox_control_start(self);
+    }
+
+  priv->update_count++;
+
+  GVariantIter *iter;
+  guint32 timer;
+  TimerData td;
+
+  g_variant_get(parameters, "(a(u(siuuuuuu)))", &iter);
+  while (g_variant_iter_loop(iter,
+                             "(u(siuuuuuu))",
+                             &timer,
+                             &td.bar_text,
+                             &td.slot,
+                             &td.bar_secondary_color,
+                             &td.bar_secondary_val,
+                             &td.bar_secondary_max,
+                             &td.bar_primary_color,
+                             &td.bar_primary_val,
+                             &td.bar_primary_max))
+    {
+      if (timer < BREAK_ID_SIZEOF)
+        {
+          workrave_timerbox_set_slot(priv->timerbox, timer, td.slot);
+          workrave_timerbox_control_update_time_bar(self, timer, &td);
+        }
+    }
+  g_variant_iter_free(iter);
+
+  workrave_timerbox_update(priv->timerbox, priv->image);
+}
+
+static void
+workrave_timerbox_control_update_time_bar(WorkraveTimerboxControl *self, int timer, const TimerData *td)
+{
+  WorkraveTimerboxControlPrivate *priv = workrave_timerbox_control_get_instance_private(self);
+
+  WorkraveTimebar *timebar = workrave_timerbox_get_time_bar(priv->timerbox, timer);
+  if (timebar != NULL)
+    {
+      workrave_timerbox_set_enabled(priv->timerbox, TRUE);
+      workrave_timerbox_control_update_show_tray_icon(self);
+      workrave_timebar_set_progress(timebar, td->bar_primary_val, td->bar_primary_max, td->bar_primary_color);
+      workrave_timebar_set_secondary_progress(timebar, td->bar_secondary_val, td->bar_secondary_max, td->bar_secondary_color);
+      workrave_timebar_set_text(timebar, td->bar_text);
+    }
+}
+
+static void
+workrave_timerbox_control_update_timers(WorkraveTimerboxControl *self, GVariant *timers)
+{
+  WorkraveTimerboxControlPrivate *priv = workrave_timerbox_control_get_instance_private(self);
+
   TimerData td[BREAK_ID_SIZEOF];
 
-  g_variant_get(parameters,
+  g_variant_get(timers,
                 "((siuuuuuu)(siuuuuuu)(siuuuuuu))",
                 &td[BREAK_ID_MICRO_BREAK].bar_text,
                 &td[BREAK_ID_MICRO_BREAK].slot,
@@ -750,18 +920,7 @@ on_update_timers(WorkraveTimerboxControl *self, GVariant *parameters)
 
   for (int i = 0; i < BREAK_ID_SIZEOF; i++)
     {
-      WorkraveTimebar *timebar = workrave_timerbox_get_time_bar(priv->timerbox, i);
-      if (timebar != NULL)
-        {
-          workrave_timerbox_set_enabled(priv->timerbox, TRUE);
-          workrave_timerbox_control_update_show_tray_icon(self);
-          workrave_timebar_set_progress(timebar, td[i].bar_primary_val, td[i].bar_primary_max, td[i].bar_primary_color);
-          workrave_timebar_set_secondary_progress(timebar,
-                                                  td[i].bar_secondary_val,
-                                                  td[i].bar_secondary_max,
-                                                  td[i].bar_secondary_color);
-          workrave_timebar_set_text(timebar, td[i].bar_text);
-        }
+      workrave_timerbox_control_update_time_bar(self, i, &td[i]);
     }
 
   workrave_timerbox_update(priv->timerbox, priv->image);
@@ -0,0 +1,131 @@
+/* Copyright (C) 2026 Rob Caelers <robc@krandor.nl>
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "timerstatus.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* An update is a memcpy of ~100 bytes, so a reader that keeps colliding with
+ * it is better off trying again on its next poll.
+ */
+#define MAX_READ_ATTEMPTS 16
+
+struct _WorkraveTimerStatusReader
+{
+  const WorkraveTimerStatusSegment *segment;
+};
+
+WorkraveTimerStatusReader *
+workrave_timer_status_open(const char *path)
+{
+  char default_path[PATH_MAX];
+  if (path == NULL)
+    {
+      const char *runtime_dir = getenv("XDG_RUNTIME_DIR");
+      if (runtime_dir == NULL || *runtime_dir == '\0')
+        {
+          return NULL;
+        }
+      int len = snprintf(default_path, sizeof(default_path), "%s/%s", runtime_dir, WORKRAVE_TIMER_STATUS_FILENAME);
+      if (len < 0 || (size_t)len >= sizeof(default_path))
+        {
+          return NULL;
+        }
+      path = default_path;
+    }
+
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    {
+      return NULL;
+    }
+
+  struct stat st;
+  void *addr = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(WorkraveTimerStatusSegment))
+    {
+      addr = mmap(NULL, sizeof(WorkraveTimerStatusSegment), PROT_READ, MAP_SHARED, fd, 0);
+    }
+  close(fd);
+
+  if (addr == MAP_FAILED)
+    {
+      return NULL;
+    }
+
+  const WorkraveTimerStatusSegment *segment = addr;
+  if (__atomic_load_n(&segment->magic, __ATOMIC_ACQUIRE) != WORKRAVE_TIMER_STATUS_MAGIC
+      || segment->version != WORKRAVE_TIMER_STATUS_VERSION || segment->size != sizeof(WorkraveTimerStatusSegment))
+    {
+      munmap(addr, sizeof(WorkraveTimerStatusSegment));
+      return NULL;
+    }
+
+  WorkraveTimerStatusReader *reader = malloc(sizeof(WorkraveTimerStatusReader));
+  if (reader == NULL)
+    {
+      munmap(addr, sizeof(WorkraveTimerStatusSegment));
+      return NULL;
+    }
+  reader->segment = segment;
+  return reader;
+}
+
+WorkraveTimerStatusResult
+workrave_timer_status_read(WorkraveTimerStatusReader *reader, WorkraveTimerStatusData *data)
+{
+  const WorkraveTimerStatusSegment *segment = reader->segment;
+
+  for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++)
+    {
+      uint32_t before = __atomic_load_n(&segment->sequence, __ATOMIC_ACQUIRE);
+      if (before & 1)
+        {
+          continue;
+        }
+
+      memcpy(data, (const void *)&segment->data, sizeof(*data));
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+      if (__atomic_load_n(&segment->sequence, __ATOMIC_RELAXED) == before)
+        {
+          return data->updated == 0 ? WORKRAVE_TIMER_STATUS_CLOSED : WORKRAVE_TIMER_STATUS_OK;
+        }
+    }
+  return WORKRAVE_TIMER_STATUS_BUSY;
+}
+
+void
+workrave_timer_status_close(WorkraveTimerStatusReader *reader)
+{
+  if (reader != NULL)
+    {
+      munmap((void *)reader->segment, sizeof(WorkraveTimerStatusSegment));
+      free(reader);
+    }
+}
@@ -34,11 +34,23 @@ const IndicatorIface =
     <method name="GetTrayIconEnabled"> \
         <arg type="b" name="enabled" direction="out" /> \
     </method> \
+    <method name="GetTimers"> \
+        <arg type="(siuuuuuu)" name="micro" direction="out" /> \
+        <arg type="(siuuuuuu)" name="rest" direction="out" /> \
+        <arg type="(siuuuuuu)" name="daily" direction="out" /> \
+    </method> \
+    <method name="SetTimerChangesEnabled"> \
+        <arg type="b" name="enabled" direction="in" /> \
+        <arg type="s" name="sender" direction="in" /> \
+    </method> \
     <signal name="TimersUpdated"> \
         <arg type="(siuuuuuu)" /> \
         <arg type="(siuuuuuu)" /> \
         <arg type="(siuuuuuu)" /> \
     </signal> \
+    <signal name="TimersChanged"> \
+        <arg type="a(u(siuuuuuu))" /> \
+    </signal> \
     <signal name="MenuUpdated"> \
         <arg type="a(sssuyy)" /> \
     </signal> \
@@ -190,6 +202,7 @@ const WorkraveButton = GObject.registerClass(
       this._menu_entries = {};
       this._watchid = 0;
       this._alive = false;
+      this._timer_changes = false;
 
       this._area = new St.DrawingArea({
         style_class: "workrave-area",
@@ -241,6 +254,10 @@ const WorkraveButton = GObject.registerClass(
         "TimersUpdated",
         this._onTimersUpdated.bind(this),
       );
+      this._timers_changed_id = this._ui_proxy.connectSignal(
+        "TimersChanged",
+        this._onTimersChanged.bind(this),
+      );
       this._menu_updated_id = this._ui_proxy.connectSignal(
         "MenuUpdated",
         this._onMenuUpdated.bind(this),
@@ -352,6 +369,7 @@ const WorkraveButton = GObject.registerClass(
       }
       if (this._ui_proxy != null) {
         this._ui_proxy.disconnectSignal(this._timers_updated_id);
+        this._ui_proxy.disconnectSignal(this._timers_changed_id);
         this._ui_proxy.disconnectSignal(this._menu_updated_id);
         this._ui_proxy.disconnectSignal(this._menu_item_updated_id);
         this._ui_proxy.disconnectSignal(this._trayicon_updated_id);
@@ -377,6 +395,11 @@ const WorkraveButton = GObject.registerClass(
           this._onGetTrayIconEnabledReply.bind(this),
         );
         this._ui_proxy.EmbedRemote(true, this._bus_name);
+        this._ui_proxy.SetTimerChangesEnabledRemote(
+          true,
+          this._bus_name,
+          this._onSetTimerChangesEnabledReply.bind(this),
+        );
         this._core_proxy.GetOperationModeRemote(
           this._onGetOperationModeReply.bind(this),
         );
@@ -417,6 +440,7 @@ const WorkraveButton = GObject.registerClass(
         this._timerbox.set_enabled(false);
         this._timerbox.set_force_icon(false);
         this._alive = false;
+        this._timer_changes = false;
         this._updateMenu(null);
         this._resizeTimerboxArea();
       }
@@ -433,7 +457,11 @@ const WorkraveButton = GObject.registerClass(
         return false;
       }
 
-      if (this._update_count == 0) {
+      if (this._update_count == 0 && this._timer_changes) {
+        // No changes are sent while the timers are unchanged; check that
+        // Workrave still responds.
+        this._ui_proxy.GetTimersRemote(this._onGetTimersReply.bind(this));
+      } else if (this._update_count == 0) {
         console.log("workrave-applet: timeout (not updated)");
         this._timerbox.set_enabled(false);
         this._area.queue_repaint();
@@ -460,44 +488,58 @@ const WorkraveButton = GObject.registerClass(
       }
 
       this._update_count++;
+      this._updateTimers([microbreak, restbreak, daily]);
+    }
 
-      this._timerbox.set_slot(0, microbreak[1]);
-      this._timerbox.set_slot(1, restbreak[1]);
-      this._timerbox.set_slot(2, daily[1]);
+    _onTimersChanged(emitter, senderName, [timers]) {
+      if (!this._alive) {
+        console.log("workrave-applet: not alive, but timers got changed");
+        this._start();
+      }
 
-      var timebar = this._timerbox.get_time_bar(0);
-      if (timebar != null) {
-        this._timerbox.set_enabled(true);
-        timebar.set_progress(microbreak[6], microbreak[7], microbreak[5]);
-        timebar.set_secondary_progress(
-          microbreak[3],
-          microbreak[4],
-          microbreak[2],
-        );
-        timebar.set_text(microbreak[0]);
+      this._update_count++;
+      for (const [timer, data] of timers) {
+        this._updateTimer(timer, data);
       }
+      this._resizeTimerboxArea();
+    }
+
+    _updateTimers(timers) {
+      timers.forEach((data, timer) => this._updateTimer(timer, data));
+      this._resizeTimerboxArea();
+    }
 
-      timebar = this._timerbox.get_time_bar(1);
+    _updateTimer(timer, data) {
+      this._timerbox.set_slot(timer, data[1]);
+
+      var timebar = this._timerbox.get_time_bar(timer);
       if (timebar != null) {
         this._timerbox.set_enabled(true);
-        timebar.set_progress(restbreak[6], restbreak[7], restbreak[5]);
-        timebar.set_secondary_progress(
-          restbreak[3],
-          restbreak[4],
-          restbreak[2],
-        );
-        timebar.set_text(restbreak[0]);
+        timebar.set_progress(data[6], data[7], data[5]);
+        timebar.set_secondary_progress(data[3], data[4], data[2]);
+        timebar.set_text(data[0]);
       }
+    }
 
-      timebar = this._timerbox.get_time_bar(2);
-      if (timebar != null) {
-        this._timerbox.set_enabled(true);
-        timebar.set_progress(daily[6], daily[7], daily[5]);
-        timebar.set_secondary_progress(daily[3], daily[4], daily[2]);
-        timebar.set_text(daily[0]);
+    _onSetTimerChangesEnabledReply(result, excp) {
+      // Older versions of Workrave keep sending TimersUpdated.
+      if (excp == null) {
+        this._timer_changes = true;
+        this._ui_proxy.GetTimersRemote(this._onGetTimersReply.bind(this));
       }
+    }
 
-      this._resizeTimerboxArea();
+    _onGetTimersReply(timers, excp) {
+      if (!this._alive) {
+        return;
+      }
+      if (excp != null) {
+        console.log("workrave-applet: timeout (no reply)");
+        this._timerbox.set_enabled(false);
+        this._area.queue_repaint();
+        return;
+      }
+      this._updateTimers(timers);
     }
 
     _onGetMenuReply([menuitems], excp) {
@@ -96,6 +96,7 @@ struct _IndicatorWorkravePrivate
 
   gboolean workrave_running;
   gboolean alive;
+  gboolean timer_changes;
   gboolean force_icon;
   guint timer;
   guint startup_timer;
@@ -144,6 +145,10 @@ static void on_dbus_ui_ready(GObject *object, GAsyncResult *res, gpointer user_d
 static void on_dbus_core_ready(GObject *object, GAsyncResult *res, gpointer user_data);
 static void on_dbus_signal(GDBusProxy *proxy, gchar *sender_name, gchar *signal_name, GVariant *parameters, gpointer user_data);
 static void on_update_indicator(IndicatorWorkrave *self, GVariant *parameters);
+static void on_timers_changed(IndicatorWorkrave *self, GVariant *parameters);
+static void on_get_timers_reply(GObject *object, GAsyncResult *res, gpointer user_data);
+static void indicator_workrave_update_time_bar(IndicatorWorkrave *self, int timer, const TimerData *td);
+static void indicator_workrave_update_timers(IndicatorWorkrave *self, GVariant *timers);
 static void on_bus_acquired(GDBusConnection *connection, const gchar *name, gpointer user_data);
 static void on_workrave_appeared(GDBusConnection *connection, const gchar *name, const gchar *name_owner, gpointer user_data);
 static void on_workrave_vanished(GDBusConnection *connection, const gchar *name, gpointer user_data);
@@ -185,6 +190,7 @@ indicator_workrave_init(IndicatorWorkrave *self)
   priv->watch_id = 0;
   priv->workrave_running = FALSE;
   priv->alive = FALSE;
+  priv->timer_changes = FALSE;
   priv->force_icon = FALSE;
   priv->timer = 0;
   priv->startup_timer = 0;
@@ -299,6 +305,42 @@ get_accessible_desc(IndicatorObject *io)
   return name;
 }
 
+// Asks Workrave to send TimersChanged with only the timers that changed
+// instead of a full TimersUpdated every second, and fetches the current
+// timers once. Older versions of Workrave keep sending TimersUpdated.
+static void
+indicator_workrave_enable_timer_changes(IndicatorWorkrave *self)
+{
+  IndicatorWorkravePrivate *priv = indicator_workrave_get_instance_private(self);
+
+  GError *error = NULL;
+  GVariant *result = g_dbus_proxy_call_sync(priv->workrave_ui_proxy,
+                                            "SetTimerChangesEnabled",
+                                            g_variant_new("(bs)", TRUE, DBUS_NAME),
+                                            G_DBUS_CALL_FLAGS_NONE,
+                                            -1,
+                                            NULL,
+                                            &error);
+  if (error != NULL)
+    {
+      g_error_free(error);
+      return;
+    }
+  g_variant_unref(result);
+
+  result = g_dbus_proxy_call_sync(priv->workrave_ui_proxy, "GetTimers", NULL, G_DBUS_CALL_FLAGS_NONE, -1, NULL, &error);
+  if (error != NULL)
+    {
+      g_warning("Could not request timers for %s: %s", WORKRAVE_INDICATOR_SERVICE_NAME, error->message);
+      g_error_free(error);
+      return;
+    }
+
+  priv->timer_changes = TRUE;
+  indicator_workrave_update_timers(self, result);
+  g_variant_unref(result);
+}
+
 static void
 indicator_workrave_start(IndicatorWorkrave *self)
 {
@@ -343,6 +385,11 @@ indicator_workrave_start(IndicatorWorkrave *self)
         }
     }
 
+  if (error == NULL)
+    {
+      indicator_workrave_enable_timer_changes(self);
+    }
+
   if (error == NULL)
     {
       GVariant *result = g_dbus_proxy_call_sync(priv->workrave_ui_proxy,
@@ -430,6 +477,7 @@ indicator_workrave_stop(IndicatorWorkrave *self)
       workrave_timerbox_set_force_icon(priv->timerbox, FALSE);
       workrave_timerbox_update(priv->timerbox, priv->image);
       priv->alive = FALSE;
+      priv->timer_changes = FALSE;
     }
 }
 
@@ -501,6 +549,45 @@ indicator_workrave_create_dbus(IndicatorWorkrave *self)
                            self);
 }
 
+static void
+indicator_workrave_disable_timers(IndicatorWorkrave *self)
+{
+  IndicatorWorkravePrivate *priv = indicator_workrave_get_instance_private(self);
+
+  workrave_timerbox_set_enabled(priv->timerbox, FALSE);
+  workrave_timerbox_set_force_icon(priv->timerbox, FALSE);
+  workrave_timerbox_update(priv->timerbox, priv->image);
+}
+
+static void
+on_get_timers_reply(GObject *object, GAsyncResult *res, gpointer user_data)
+{
+  IndicatorWorkrave *self = INDICATOR_WORKRAVE(user_data);
+  IndicatorWorkravePrivate *priv = indicator_workrave_get_instance_private(self);
+
+  GError *error = NULL;
+  GVariant *result = g_dbus_proxy_call_finish(G_DBUS_PROXY(object), res, &error);
+
+  if (error != NULL)
+    {
+      if (priv->alive)
+        {
+          indicator_workrave_disable_timers(self);
+        }
+      g_error_free(error);
+    }
+  else
+    {
+      if (priv->alive)
+        {
+          indicator_workrave_update_timers(self, result);
+        }
+      g_variant_unref(result);
+    }
+
+  g_object_unref(self);
+}
+
 static gboolean
 on_timer(gpointer user_data)
 {
@@ -509,9 +596,23 @@ on_timer(gpointer user_data)
 
   if (priv->alive && priv->update_count == 0)
     {
-      workrave_timerbox_set_enabled(priv->timerbox, FALSE);
-      workrave_timerbox_set_force_icon(priv->timerbox, FALSE);
-      workrave_timerbox_update(priv->timerbox, priv->image);
+      if (priv->timer_changes)
+        {
+          // No changes are sent while the timers are unchanged; check that
+          // Workrave still responds.
+          g_dbus_proxy_call(priv->workrave_ui_proxy,
+                            "GetTimers",
+                            NULL,
+                            G_DBUS_CALL_FLAGS_NONE,
+                            -1,
+                            NULL,
+                            on_get_timers_reply,
+                            g_object_ref(self));
+        }
+      else
+        {
+          indicator_workrave_disable_timers(self);
+        }
     }
   priv->update_count = 0;
 
@@ -587,6 +688,11 @@ on_dbus_signal(GDBusProxy *proxy, gchar *sender_name, gchar *signal_name, GVaria
       on_update_indicator(self, parameters);
     }
 
+  else if (g_strcmp0(signal_name, "TimersChanged") == 0)
+    {
+      on_timers_changed(self, parameters);
+    }
+
   else if (g_strcmp0(signal_name, "TrayIconUpdated") == 0)
     {
       g_variant_get(parameters, "(b)", &priv->force_icon);
@@ -615,9 +721,73 @@ on_update_indicator(IndicatorWorkrave *self, GVariant *parameters)
 
   priv->update_count++;
 
+  indicator_workrave_update_timers(self, parameters);
+}
+
+static void
+on_timers_changed(IndicatorWorkrave *self, GVariant *parameters)
+{
+  IndicatorWorkravePrivate *priv = indicator_workrave_get_instance_private(self);
+
+  if (!priv->alive)
+    {
+      indicator_workrave_start(self);
+    }
+
+  priv->update_count++;
+
+  GVariantIter *iter;
+  guint32 timer;
+  TimerData td;
+
+  g_variant_get(parameters, "(a(u(siuuuuuu)))", &iter);
+  while (g_variant_iter_loop(iter,
+                             "(u(siuuuuuu))",
+                             &timer,
+                             &td.bar_text,
+                             &td.slot,
+                             &td.bar_secondary_color,
+                             &td.bar_secondary_val,
+                             &td.bar_secondary_max,
+                             &td.bar_primary_color,
+                             &td.bar_primary_val,
+                             &td.bar_primary_max))
+    {
+      if (timer < BREAK_ID_SIZEOF)
+        {
+          workrave_timerbox_set_slot(priv->timerbox, timer, td.slot);
+          indicator_workrave_update_time_bar(self, timer, &td);
+        }
+    }
+  g_variant_iter_free(iter);
+
+  workrave_timerbox_update(priv->timerbox, priv->image);
+}
+
+static void
+indicator_workrave_update_time_bar(IndicatorWorkrave *self, int timer, const TimerData *td)
+{
+  IndicatorWorkravePrivate *priv = indicator_workrave_get_instance_private(self);
+
+  WorkraveTimebar *timebar = workrave_timerbox_get_time_bar(priv->timerbox, timer);
+  if (timebar != NULL)
+    {
+      workrave_timerbox_set_enabled(priv->timerbox, TRUE);
+      workrave_timerbox_set_force_icon(priv->timerbox, priv->force_icon);
+      workrave_timebar_set_progress(timebar, td->bar_primary_val, td->bar_primary_max, td->bar_primary_color);
+      workrave_timebar_set_secondary_progress(timebar, td->bar_secondary_val, td->bar_secondary_max, td->bar_secondary_color);
+      workrave_timebar_set_text(timebar, td->bar_text);
+    }
+}
+
+static void
+indicator_workrave_update_timers(IndicatorWorkrave *self, GVariant *timers)
+{
+  IndicatorWorkravePrivate *priv = indicator_workrave_get_instance_private(self);
+
   TimerData td[BREAK_ID_SIZEOF];
 
-  g_variant_get(parameters,
+  g_variant_get(timers,
                 "((siuuuuuu)(siuuuuuu)(siuuuuuu))",
                 &td[BREAK_ID_MICRO_BREAK].bar_text,
                 &td[BREAK_ID_MICRO_BREAK].slot,
@@ -651,18 +821,7 @@ on_update_indicator(IndicatorWorkrave *self, GVariant *parameters)
 
   for (int i = 0; i < BREAK_ID_SIZEOF; i++)
     {
-      WorkraveTimebar *timebar = workrave_timerbox_get_time_bar(priv->timerbox, i);
-      if (timebar != NULL)
-        {
-          workrave_timerbox_set_enabled(priv->timerbox, TRUE);
-          workrave_timerbox_set_force_icon(priv->timerbox, priv->force_icon);
-          workrave_timebar_set_progress(timebar, td[i].bar_primary_val, td[i].bar_primary_max, td[i].bar_primary_color);
-          workrave_timebar_set_secondary_progress(timebar,
-                                                  td[i].bar_secondary_val,
-                                                  td[i].bar_secondary_max,
-                                                  td[i].bar_secondary_color);
-          workrave_timebar_set_text(timebar, td[i].bar_text);
-        }
+      indicator_workrave_update_time_bar(self, i, &td[i]);
     }
 
   workrave_timerbox_update(priv->timerbox, priv->image);